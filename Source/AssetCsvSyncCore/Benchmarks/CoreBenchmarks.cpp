@@ -0,0 +1,251 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+// Synthetic workloads for the cell codecs, on char16_t text like TCHAR on Linux. Each benchmark reports bytes
+// processed, so throughput can be compared across runs:
+//   AssetCsvSyncCoreBenchmarks --benchmark_filter=ParseCsvLine --benchmark_repetitions=5
+
+#include "AssetCsvSyncCore/CellCodec.h"
+#include "AssetCsvSyncCore/CsvCodec.h"
+#include "AssetCsvSyncCore/NumberFormat.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+	using FChar = char16_t;
+	using FText = std::basic_string<FChar>;
+	using FView = std::basic_string_view<FChar>;
+
+	FText Widen(std::string_view Text)
+	{
+		return FText(Text.begin(), Text.end());
+	}
+
+	struct FAppend
+	{
+		FText& Out;
+
+		void operator()(const FChar* Data, size_t Len) const { Out.append(Data, Len); }
+	};
+
+	// Cell shapes found in table exports: numbers, names, asset paths, struct text with commas (quoted) and
+	// free text with quotes.
+	FText MakeCell(std::mt19937& Random, int QuotedPercent)
+	{
+		static const char* const Plain[] = { "12", "-3.5", "true", "Sword_01", "/Game/Data/Items/DA_Sword.DA_Sword", "" };
+		static const char* const Quoted[] = { "(X=1.000000,Y=2.000000,Z=3.000000)", "A \"legendary\" blade", "Line one\nLine two" };
+		if (static_cast<int>(Random() % 100) < QuotedPercent)
+			return Widen(Quoted[Random() % 3]);
+		return Widen(Plain[Random() % 6]);
+	}
+
+	FText MakeRecord(int NumCells, int QuotedPercent, uint32_t Seed)
+	{
+		std::mt19937 Random(Seed);
+		FText Record;
+		FAppend Append{ Record };
+		for (int i = 0; i < NumCells; ++i)
+		{
+			if (i > 0)
+			{
+				Record.push_back(u',');
+			}
+			const FText Cell = MakeCell(Random, QuotedPercent);
+			AssetCsvSync::Core::AppendCsvCell(FView(Cell), Append);
+		}
+		return Record;
+	}
+
+	void BM_ParseCsvLine(benchmark::State& State)
+	{
+		const FText Record = MakeRecord(static_cast<int>(State.range(0)), static_cast<int>(State.range(1)), 1);
+		for (auto _ : State)
+		{
+			size_t NumCells = 0;
+			AssetCsvSync::Core::ParseCsvLine(FView(Record), [&NumCells](FView Cell)
+			{
+				benchmark::DoNotOptimize(Cell.data());
+				++NumCells;
+			});
+			benchmark::DoNotOptimize(NumCells);
+		}
+		State.SetBytesProcessed(static_cast<int64_t>(State.iterations()) * static_cast<int64_t>(Record.size() * sizeof(FChar)));
+	}
+	BENCHMARK(BM_ParseCsvLine)->ArgNames({ "Cells", "QuotedPct" })->Args({ 16, 0 })->Args({ 16, 25 })->Args({ 256, 0 })->Args({ 256, 25 })->Args({ 256, 100 });
+
+	void BM_ReadCsvRecord(benchmark::State& State)
+	{
+		FText Content;
+		for (int Row = 0; Row < 1000; ++Row)
+		{
+			Content += MakeRecord(static_cast<int>(State.range(0)), 25, static_cast<uint32_t>(Row));
+			Content.push_back(u'\n');
+		}
+		for (auto _ : State)
+		{
+			size_t Pos = 0;
+			FView Record;
+			size_t NumRecords = 0;
+			while (AssetCsvSync::Core::ReadCsvRecord(FView(Content), Pos, Record))
+			{
+				++NumRecords;
+			}
+			benchmark::DoNotOptimize(NumRecords);
+		}
+		State.SetBytesProcessed(static_cast<int64_t>(State.iterations()) * static_cast<int64_t>(Content.size() * sizeof(FChar)));
+	}
+	BENCHMARK(BM_ReadCsvRecord)->ArgName("Cells")->Arg(16)->Arg(128);
+
+	void BM_EscapeCsvString(benchmark::State& State)
+	{
+		std::mt19937 Random(7);
+		std::vector<FText> Cells;
+		size_t Bytes = 0;
+		for (int i = 0; i < 1024; ++i)
+		{
+			Cells.push_back(MakeCell(Random, static_cast<int>(State.range(0))));
+			Bytes += Cells.back().size() * sizeof(FChar);
+		}
+		FText Out;
+		for (auto _ : State)
+		{
+			Out.clear();
+			for (const FText& Cell : Cells)
+			{
+				AssetCsvSync::Core::AppendCsvCell(FView(Cell), FAppend{ Out });
+			}
+			benchmark::DoNotOptimize(Out.data());
+		}
+		State.SetBytesProcessed(static_cast<int64_t>(State.iterations()) * static_cast<int64_t>(Bytes));
+	}
+	BENCHMARK(BM_EscapeCsvString)->ArgName("QuotedPct")->Arg(0)->Arg(25)->Arg(100);
+
+	std::vector<FText> MakeListItems(int NumItems)
+	{
+		std::vector<FText> Items;
+		for (int i = 0; i < NumItems; ++i)
+		{
+			Items.push_back(Widen(i % 8 == 0 ? "Tag;With;Separators" : (i % 8 == 1 ? "" : "Item_" + std::to_string(i))));
+		}
+		return Items;
+	}
+
+	void BM_JoinListCell(benchmark::State& State)
+	{
+		const std::vector<FText> Items = MakeListItems(static_cast<int>(State.range(0)));
+		FText Out;
+		for (auto _ : State)
+		{
+			Out.clear();
+			AssetCsvSync::Core::JoinListCell<FChar>(Items.size(), [&Items](size_t Index) { return FView(Items[Index]); }, FAppend{ Out });
+			benchmark::DoNotOptimize(Out.data());
+		}
+		State.SetBytesProcessed(static_cast<int64_t>(State.iterations()) * static_cast<int64_t>(Out.size() * sizeof(FChar)));
+	}
+	BENCHMARK(BM_JoinListCell)->ArgName("Items")->Arg(8)->Arg(64)->Arg(1024);
+
+	void BM_ParseListCell(benchmark::State& State)
+	{
+		const std::vector<FText> Items = MakeListItems(static_cast<int>(State.range(0)));
+		FText Cell;
+		AssetCsvSync::Core::JoinListCell<FChar>(Items.size(), [&Items](size_t Index) { return FView(Items[Index]); }, FAppend{ Cell });
+		for (auto _ : State)
+		{
+			size_t NumItems = 0;
+			AssetCsvSync::Core::ParseListCell(FView(Cell), [&NumItems](FView Item)
+			{
+				benchmark::DoNotOptimize(Item.data());
+				++NumItems;
+			});
+			benchmark::DoNotOptimize(NumItems);
+		}
+		State.SetBytesProcessed(static_cast<int64_t>(State.iterations()) * static_cast<int64_t>(Cell.size() * sizeof(FChar)));
+	}
+	BENCHMARK(BM_ParseListCell)->ArgName("Items")->Arg(8)->Arg(64)->Arg(1024);
+
+	// A TMap<FName, float> style map with a few string values mixed in.
+	FText EncodeMap(int NumEntries)
+	{
+		FText Out;
+		FAppend Append{ Out };
+		AssetCsvSync::Core::TMapCellWriter<FChar, FAppend> Writer(Append);
+		for (int i = 0; i < NumEntries; ++i)
+		{
+			const FText Key = Widen("Stat_" + std::to_string(i));
+			if (i % 4 == 0)
+			{
+				Writer.String(FView(Key), FView(Widen("Value \"" + std::to_string(i) + "\"")));
+			}
+			else
+			{
+				Writer.Number(FView(Key), i * 0.1);
+			}
+		}
+		Writer.Finish();
+		return Out;
+	}
+
+	void BM_EncodeMapCell(benchmark::State& State)
+	{
+		const int NumEntries = static_cast<int>(State.range(0));
+		size_t Bytes = 0;
+		for (auto _ : State)
+		{
+			const FText Cell = EncodeMap(NumEntries);
+			Bytes = Cell.size() * sizeof(FChar);
+			benchmark::DoNotOptimize(Cell.data());
+		}
+		State.SetBytesProcessed(static_cast<int64_t>(State.iterations()) * static_cast<int64_t>(Bytes));
+	}
+	BENCHMARK(BM_EncodeMapCell)->ArgName("Entries")->Arg(8)->Arg(64)->Arg(512);
+
+	void BM_ParseMapCell(benchmark::State& State)
+	{
+		const FText Cell = EncodeMap(static_cast<int>(State.range(0)));
+		for (auto _ : State)
+		{
+			size_t NumEntries = 0;
+			const bool bParsed = AssetCsvSync::Core::ParseMapCell(FView(Cell), [&NumEntries](FView Key, AssetCsvSync::Core::EMapCellValue, FView Value)
+			{
+				benchmark::DoNotOptimize(Key.data());
+				benchmark::DoNotOptimize(Value.data());
+				++NumEntries;
+			});
+			benchmark::DoNotOptimize(bParsed);
+			benchmark::DoNotOptimize(NumEntries);
+		}
+		State.SetBytesProcessed(static_cast<int64_t>(State.iterations()) * static_cast<int64_t>(Cell.size() * sizeof(FChar)));
+	}
+	BENCHMARK(BM_ParseMapCell)->ArgName("Entries")->Arg(8)->Arg(64)->Arg(512);
+
+	void BM_FormatDecimal(benchmark::State& State)
+	{
+		std::mt19937 Random(3);
+		std::uniform_real_distribution<double> Distribution(-1e6, 1e6);
+		std::vector<double> Values(1024);
+		for (double& Value : Values)
+		{
+			Value = Distribution(Random);
+		}
+		FText Out;
+		for (auto _ : State)
+		{
+			Out.clear();
+			for (double Value : Values)
+			{
+				AssetCsvSync::Core::FormatDecimal<FChar>(Value, FAppend{ Out });
+			}
+			benchmark::DoNotOptimize(Out.data());
+		}
+		State.SetItemsProcessed(static_cast<int64_t>(State.iterations()) * static_cast<int64_t>(Values.size()));
+	}
+	BENCHMARK(BM_FormatDecimal);
+}
+
+BENCHMARK_MAIN();
@@ -0,0 +1,516 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include "AssetCsvSyncCore/CsvCodec.h"
+#include "AssetCsvSyncCore/NumberFormat.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Container cell codecs, independent of the engine: list cells for arrays and sets, JSON object cells for maps.
+namespace AssetCsvSync::Core
+{
+	// List cells: items separated by ';'. An item is quoted, with its quotes doubled, when it is empty or contains
+	// ';' or a quote, so a single empty item is written `""` and stays distinct from an empty cell (no items).
+	template <typename CharT>
+	bool NeedsListQuotes(std::basic_string_view<CharT> Item)
+	{
+		const CharT Specials[] = { static_cast<CharT>(';'), Private::Quote<CharT> };
+		return Item.empty() || Item.find_first_of(std::basic_string_view<CharT>(Specials, 2)) != std::basic_string_view<CharT>::npos;
+	}
+
+	template <typename CharT, typename AppendFn>
+	void AppendListItem(std::basic_string_view<CharT> Item, AppendFn&& Append)
+	{
+		if (NeedsListQuotes(Item))
+		{
+			Private::AppendQuoted(Item, Append);
+		}
+		else
+		{
+			Append(Item.data(), Item.size());
+		}
+	}
+
+	// Appends GetItem(0) .. GetItem(NumItems - 1) as one list cell, separated (not terminated) by ';'.
+	template <typename CharT, typename GetItemFn, typename AppendFn>
+	void JoinListCell(size_t NumItems, GetItemFn&& GetItem, AppendFn&& Append)
+	{
+		const CharT Separator = static_cast<CharT>(';');
+		for (size_t i = 0; i < NumItems; ++i)
+		{
+			if (i > 0)
+			{
+				Append(&Separator, 1);
+			}
+			AppendListItem<CharT>(GetItem(i), Append);
+		}
+	}
+
+	// Calls OnItem(std::basic_string_view<CharT>) for each item of a list cell. An empty cell has no items.
+	template <typename CharT, typename OnItemFn>
+	void ParseListCell(std::basic_string_view<CharT> Cell, OnItemFn&& OnItem)
+	{
+		if (Cell.empty())
+			return;
+		std::basic_string<CharT> Scratch;
+		Private::SplitQuoted(Cell, static_cast<CharT>(';'), Scratch, OnItem);
+	}
+
+	// Map cells are JSON objects keyed by the map key's cell text.
+	enum class EMapCellValue : uint8_t
+	{
+		String,
+		Number,
+		Bool,
+		Null,
+		// A nested object or array, passed as its JSON text.
+		Raw,
+	};
+
+	namespace Private
+	{
+		template <typename CharT, typename AppendFn>
+		void AppendJsonString(std::basic_string_view<CharT> Value, AppendFn&& Append)
+		{
+			const CharT QuoteChar = Quote<CharT>;
+			Append(&QuoteChar, 1);
+			size_t Start = 0;
+			for (size_t i = 0; i < Value.size(); ++i)
+			{
+				const CharT Char = Value[i];
+				const bool bControl = static_cast<uint32_t>(Char) < 0x20;
+				if (!bControl && Char != QuoteChar && Char != static_cast<CharT>('\\'))
+					continue;
+
+				Append(Value.data() + Start, i - Start);
+				Start = i + 1;
+				char Escape[7] = { '\\', static_cast<char>(Char), 0 };
+				size_t EscapeLen = 2;
+				switch (static_cast<int>(Char))
+				{
+				case '\b': Escape[1] = 'b'; break;
+				case '\f': Escape[1] = 'f'; break;
+				case '\n': Escape[1] = 'n'; break;
+				case '\r': Escape[1] = 'r'; break;
+				case '\t': Escape[1] = 't'; break;
+				case '"':
+				case '\\':
+					break;
+				default:
+					std::snprintf(Escape, sizeof(Escape), "\\u%04x", static_cast<unsigned>(Char));
+					EscapeLen = 6;
+					break;
+				}
+				AppendAscii<CharT>(Escape, EscapeLen, Append);
+			}
+			Append(Value.data() + Start, Value.size() - Start);
+			Append(&QuoteChar, 1);
+		}
+
+		template <typename CharT>
+		void AppendCodePoint(std::basic_string<CharT>& Out, uint32_t CodePoint)
+		{
+			if constexpr (sizeof(CharT) == 1)
+			{
+				if (CodePoint < 0x80)
+				{
+					Out.push_back(static_cast<CharT>(CodePoint));
+				}
+				else if (CodePoint < 0x800)
+				{
+					Out.push_back(static_cast<CharT>(0xC0 | (CodePoint >> 6)));
+					Out.push_back(static_cast<CharT>(0x80 | (CodePoint & 0x3F)));
+				}
+				else if (CodePoint < 0x10000)
+				{
+					Out.push_back(static_cast<CharT>(0xE0 | (CodePoint >> 12)));
+					Out.push_back(static_cast<CharT>(0x80 | ((CodePoint >> 6) & 0x3F)));
+					Out.push_back(static_cast<CharT>(0x80 | (CodePoint & 0x3F)));
+				}
+				else
+				{
+					Out.push_back(static_cast<CharT>(0xF0 | (CodePoint >> 18)));
+					Out.push_back(static_cast<CharT>(0x80 | ((CodePoint >> 12) & 0x3F)));
+					Out.push_back(static_cast<CharT>(0x80 | ((CodePoint >> 6) & 0x3F)));
+					Out.push_back(static_cast<CharT>(0x80 | (CodePoint & 0x3F)));
+				}
+			}
+			else if constexpr (sizeof(CharT) == 2)
+			{
+				if (CodePoint >= 0x10000)
+				{
+					CodePoint -= 0x10000;
+					Out.push_back(static_cast<CharT>(0xD800 | (CodePoint >> 10)));
+					Out.push_back(static_cast<CharT>(0xDC00 | (CodePoint & 0x3FF)));
+				}
+				else
+				{
+					Out.push_back(static_cast<CharT>(CodePoint));
+				}
+			}
+			else
+			{
+				Out.push_back(static_cast<CharT>(CodePoint));
+			}
+		}
+
+		// Reads one JSON value of a map cell. Strings without escapes are returned as slices of the cell.
+		template <typename CharT>
+		struct TJsonCursor
+		{
+			using FView = std::basic_string_view<CharT>;
+
+			static constexpr int MaxDepth = 64;
+
+			FView Text;
+			size_t Pos = 0;
+
+			bool AtEnd() const { return Pos >= Text.size(); }
+			CharT Peek() const { return Text[Pos]; }
+
+			void SkipSpace()
+			{
+				while (!AtEnd() && (Peek() == ' ' || Peek() == '\t' || Peek() == '\n' || Peek() == '\r'))
+				{
+					++Pos;
+				}
+			}
+
+			bool Consume(CharT Char)
+			{
+				SkipSpace();
+				if (AtEnd() || Peek() != Char)
+					return false;
+				++Pos;
+				return true;
+			}
+
+			bool ReadHex4(uint32_t& OutValue)
+			{
+				if (Text.size() - Pos < 4)
+					return false;
+				OutValue = 0;
+				for (int i = 0; i < 4; ++i)
+				{
+					const CharT Char = Text[Pos++];
+					uint32_t Digit = 0;
+					if (Char >= '0' && Char <= '9')
+						Digit = static_cast<uint32_t>(Char - '0');
+					else if (Char >= 'a' && Char <= 'f')
+						Digit = static_cast<uint32_t>(Char - 'a' + 10);
+					else if (Char >= 'A' && Char <= 'F')
+						Digit = static_cast<uint32_t>(Char - 'A' + 10);
+					else
+						return false;
+					OutValue = (OutValue << 4) | Digit;
+				}
+				return true;
+			}
+
+			// At the opening quote.
+			bool ReadString(std::basic_string<CharT>& Scratch, FView& OutValue)
+			{
+				++Pos;
+				const size_t Start = Pos;
+				const CharT Stops[] = { Quote<CharT>, static_cast<CharT>('\\') };
+				size_t Next = Text.find_first_of(FView(Stops, 2), Pos);
+				if (Next == FView::npos)
+					return false;
+				if (Text[Next] == Quote<CharT>)
+				{
+					OutValue = Text.substr(Start, Next - Start);
+					Pos = Next + 1;
+					return true;
+				}
+
+				Scratch.assign(Text.data() + Start, Next - Start);
+				Pos = Next;
+				while (!AtEnd())
+				{
+					const CharT Char = Text[Pos++];
+					if (Char == Quote<CharT>)
+					{
+						OutValue = FView(Scratch);
+						return true;
+					}
+					if (Char != '\\')
+					{
+						Scratch.push_back(Char);
+						continue;
+					}
+					if (AtEnd())
+						return false;
+					const CharT Escaped = Text[Pos++];
+					switch (static_cast<int>(Escaped))
+					{
+					case '"': Scratch.push_back(Quote<CharT>); break;
+					case '\\': Scratch.push_back(static_cast<CharT>('\\')); break;
+					case '/': Scratch.push_back(static_cast<CharT>('/')); break;
+					case 'b': Scratch.push_back(static_cast<CharT>('\b')); break;
+					case 'f': Scratch.push_back(static_cast<CharT>('\f')); break;
+					case 'n': Scratch.push_back(static_cast<CharT>('\n')); break;
+					case 'r': Scratch.push_back(static_cast<CharT>('\r')); break;
+					case 't': Scratch.push_back(static_cast<CharT>('\t')); break;
+					case 'u':
+						{
+							uint32_t CodePoint = 0;
+							if (!ReadHex4(CodePoint))
+								return false;
+							// A surrogate pair spelled as two escapes.
+							uint32_t Low = 0;
+							if (CodePoint >= 0xD800 && CodePoint < 0xDC00 && Text.size() - Pos >= 6 && Text[Pos] == '\\' && Text[Pos + 1] == 'u')
+							{
+								const size_t Saved = Pos;
+								Pos += 2;
+								if (ReadHex4(Low) && Low >= 0xDC00 && Low < 0xE000)
+								{
+									CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+								}
+								else
+								{
+									Pos = Saved;
+								}
+							}
+							const bool bLoneSurrogate = CodePoint >= 0xD800 && CodePoint < 0xE000;
+							if (bLoneSurrogate && sizeof(CharT) != 2)
+							{
+								CodePoint = 0xFFFD;
+							}
+							AppendCodePoint(Scratch, CodePoint);
+						}
+						break;
+					default:
+						return false;
+					}
+				}
+				return false;
+			}
+
+			bool ReadLiteral(const char* Word)
+			{
+				for (; *Word; ++Word, ++Pos)
+				{
+					if (AtEnd() || Peek() != static_cast<CharT>(*Word))
+						return false;
+				}
+				return true;
+			}
+
+			static bool IsDigit(CharT Char) { return Char >= '0' && Char <= '9'; }
+
+			bool ReadDigits()
+			{
+				const size_t Start = Pos;
+				while (!AtEnd() && IsDigit(Peek()))
+				{
+					++Pos;
+				}
+				return Pos > Start;
+			}
+
+			// JSON number grammar: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+			bool ReadNumber()
+			{
+				if (!AtEnd() && Peek() == '-')
+				{
+					++Pos;
+				}
+				if (AtEnd())
+					return false;
+				if (Peek() == '0')
+				{
+					++Pos;
+				}
+				else if (!ReadDigits())
+				{
+					return false;
+				}
+				if (!AtEnd() && Peek() == '.')
+				{
+					++Pos;
+					if (!ReadDigits())
+						return false;
+				}
+				if (!AtEnd() && (Peek() == 'e' || Peek() == 'E'))
+				{
+					++Pos;
+					if (!AtEnd() && (Peek() == '+' || Peek() == '-'))
+					{
+						++Pos;
+					}
+					if (!ReadDigits())
+						return false;
+				}
+				return true;
+			}
+
+			// Skips any value; used for nested objects and arrays.
+			bool SkipValue(std::basic_string<CharT>& Scratch, int Depth)
+			{
+				SkipSpace();
+				if (AtEnd() || Depth > MaxDepth)
+					return false;
+
+				FView Ignored;
+				const CharT Char = Peek();
+				if (Char == Quote<CharT>)
+					return ReadString(Scratch, Ignored);
+				if (Char == 't')
+					return ReadLiteral("true");
+				if (Char == 'f')
+					return ReadLiteral("false");
+				if (Char == 'n')
+					return ReadLiteral("null");
+				if (Char != '{' && Char != '[')
+					return ReadNumber();
+
+				const CharT Close = static_cast<CharT>(Char == '{' ? '}' : ']');
+				++Pos;
+				if (Consume(Close))
+					return true;
+				do
+				{
+					if (Char == '{')
+					{
+						SkipSpace();
+						if (AtEnd() || Peek() != Quote<CharT> || !ReadString(Scratch, Ignored) || !Consume(static_cast<CharT>(':')))
+							return false;
+					}
+					if (!SkipValue(Scratch, Depth + 1))
+						return false;
+				}
+				while (Consume(static_cast<CharT>(',')));
+				return Consume(Close);
+			}
+		};
+	}
+
+	// Writes a map cell as a condensed JSON object: {"Key":Value,...}.
+	template <typename CharT, typename AppendFn>
+	class TMapCellWriter
+	{
+	public:
+		explicit TMapCellWriter(AppendFn& InAppend)
+			: Append(InAppend)
+		{
+		}
+
+		void String(std::basic_string_view<CharT> Key, std::basic_string_view<CharT> Value)
+		{
+			AppendKey(Key);
+			Private::AppendJsonString(Value, Append);
+		}
+
+		void Integer(std::basic_string_view<CharT> Key, int64_t Value)
+		{
+			AppendKey(Key);
+			FormatInteger<CharT>(Value, Append);
+		}
+
+		void Number(std::basic_string_view<CharT> Key, double Value)
+		{
+			AppendKey(Key);
+			FormatShortestDouble<CharT>(Value, Append);
+		}
+
+		void Bool(std::basic_string_view<CharT> Key, bool bValue)
+		{
+			AppendKey(Key);
+			AppendAscii<CharT>(bValue ? "true" : "false", bValue ? 4 : 5, Append);
+		}
+
+		// Closes the object; an empty map is written as {}.
+		void Finish()
+		{
+			AppendAscii<CharT>(NumEntries == 0 ? "{}" : "}", NumEntries == 0 ? 2 : 1, Append);
+		}
+
+	private:
+		void AppendKey(std::basic_string_view<CharT> Key)
+		{
+			AppendAscii<CharT>(NumEntries++ == 0 ? "{" : ",", 1, Append);
+			Private::AppendJsonString(Key, Append);
+			AppendAscii<CharT>(":", 1, Append);
+		}
+
+		AppendFn& Append;
+		size_t NumEntries = 0;
+	};
+
+	// Calls OnEntry(Key, EMapCellValue, Value) for each member of a map cell's JSON object, in order. Strings are
+	// unescaped; numbers, true/false, null and nested values are passed as their JSON text. Whitespace between
+	// tokens is allowed, so pretty-printed cells read too. False when the cell is not a JSON object; entries before
+	// the error have been passed by then.
+	template <typename CharT, typename OnEntryFn>
+	bool ParseMapCell(std::basic_string_view<CharT> Cell, OnEntryFn&& OnEntry)
+	{
+		using FView = std::basic_string_view<CharT>;
+		Private::TJsonCursor<CharT> Cursor{ Cell };
+		std::basic_string<CharT> KeyScratch;
+		std::basic_string<CharT> ValueScratch;
+
+		if (!Cursor.Consume(static_cast<CharT>('{')))
+			return false;
+		if (!Cursor.Consume(static_cast<CharT>('}')))
+		{
+			do
+			{
+				FView Key;
+				Cursor.SkipSpace();
+				if (Cursor.AtEnd() || Cursor.Peek() != Private::Quote<CharT> || !Cursor.ReadString(KeyScratch, Key) || !Cursor.Consume(static_cast<CharT>(':')))
+					return false;
+
+				Cursor.SkipSpace();
+				if (Cursor.AtEnd())
+					return false;
+				const CharT First = Cursor.Peek();
+				const size_t Start = Cursor.Pos;
+				FView Value;
+				EMapCellValue Kind = EMapCellValue::Number;
+				if (First == Private::Quote<CharT>)
+				{
+					Kind = EMapCellValue::String;
+					if (!Cursor.ReadString(ValueScratch, Value))
+						return false;
+				}
+				else
+				{
+					bool bRead = false;
+					if (First == '{' || First == '[')
+					{
+						Kind = EMapCellValue::Raw;
+						bRead = Cursor.SkipValue(ValueScratch, 1);
+					}
+					else if (First == 't' || First == 'f')
+					{
+						Kind = EMapCellValue::Bool;
+						bRead = Cursor.ReadLiteral(First == 't' ? "true" : "false");
+					}
+					else if (First == 'n')
+					{
+						Kind = EMapCellValue::Null;
+						bRead = Cursor.ReadLiteral("null");
+					}
+					else
+					{
+						bRead = Cursor.ReadNumber();
+					}
+					if (!bRead)
+						return false;
+					Value = Cell.substr(Start, Cursor.Pos - Start);
+				}
+				OnEntry(Key, Kind, Value);
+			}
+			while (Cursor.Consume(static_cast<CharT>(',')));
+
+			if (!Cursor.Consume(static_cast<CharT>('}')))
+				return false;
+		}
+		Cursor.SkipSpace();
+		return Cursor.AtEnd();
+	}
+}
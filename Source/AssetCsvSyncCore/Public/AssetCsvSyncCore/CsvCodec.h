@@ -0,0 +1,177 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// CSV records and cells, independent of the engine and templated on the character type so the editor can run them
+// on TCHAR text directly. Output goes through Append(const CharT* Data, size_t Len); parsed cells are passed as
+// views that are only valid during the callback.
+namespace AssetCsvSync::Core
+{
+	namespace Private
+	{
+		template <typename CharT>
+		constexpr CharT Quote = static_cast<CharT>('"');
+
+		// Appends Value in quotes, doubling the quotes inside it.
+		template <typename CharT, typename AppendFn>
+		void AppendQuoted(std::basic_string_view<CharT> Value, AppendFn&& Append)
+		{
+			const CharT QuoteChar = Quote<CharT>;
+			Append(&QuoteChar, 1);
+			size_t Start = 0;
+			for (size_t Next = Value.find(QuoteChar); Next != std::basic_string_view<CharT>::npos; Next = Value.find(QuoteChar, Start))
+			{
+				Append(Value.data() + Start, Next + 1 - Start);
+				Append(&QuoteChar, 1);
+				Start = Next + 1;
+			}
+			Append(Value.data() + Start, Value.size() - Start);
+			Append(&QuoteChar, 1);
+		}
+
+		// Splits Text at Separator outside quotes. A quote opens or closes quoting anywhere in a field, a doubled quote
+		// inside quotes is a literal quote, and the quotes themselves are dropped. Fields without quotes are passed as
+		// slices of Text; the others are unescaped into Scratch. There is always at least one field.
+		template <typename CharT, typename OnFieldFn>
+		void SplitQuoted(std::basic_string_view<CharT> Text, CharT Separator, std::basic_string<CharT>& Scratch, OnFieldFn&& OnField)
+		{
+			using FView = std::basic_string_view<CharT>;
+			const CharT QuoteChar = Quote<CharT>;
+			const CharT StopChars[] = { Separator, QuoteChar };
+			const FView Stops(StopChars, 2);
+
+			size_t Start = 0;
+			for (;;)
+			{
+				const size_t Stop = Text.find_first_of(Stops, Start);
+				if (Stop == FView::npos)
+				{
+					OnField(Text.substr(Start));
+					return;
+				}
+				if (Text[Stop] == Separator)
+				{
+					OnField(Text.substr(Start, Stop - Start));
+					Start = Stop + 1;
+					continue;
+				}
+
+				// The field has quotes: copy its runs between them.
+				Scratch.assign(Text.data() + Start, Stop - Start);
+				bool bInQuotes = false;
+				size_t Pos = Stop;
+				while (Pos < Text.size())
+				{
+					const size_t Next = bInQuotes ? Text.find(QuoteChar, Pos) : Text.find_first_of(Stops, Pos);
+					if (Next == FView::npos)
+					{
+						Scratch.append(Text.data() + Pos, Text.size() - Pos);
+						Pos = Text.size();
+						break;
+					}
+					Scratch.append(Text.data() + Pos, Next - Pos);
+					if (!bInQuotes && Text[Next] == Separator)
+					{
+						Pos = Next;
+						break;
+					}
+					if (bInQuotes && Next + 1 < Text.size() && Text[Next + 1] == QuoteChar)
+					{
+						Scratch.push_back(QuoteChar);
+						Pos = Next + 2;
+						continue;
+					}
+					bInQuotes = !bInQuotes;
+					Pos = Next + 1;
+				}
+
+				OnField(FView(Scratch));
+				if (Pos >= Text.size())
+					return;
+				Start = Pos + 1;
+			}
+		}
+	}
+
+	// True when a cell has to be quoted: it contains a comma, a quote or a line break.
+	template <typename CharT>
+	bool NeedsCsvQuotes(std::basic_string_view<CharT> Value)
+	{
+		const CharT Specials[] = { static_cast<CharT>(','), Private::Quote<CharT>, static_cast<CharT>('\n'), static_cast<CharT>('\r') };
+		return Value.find_first_of(std::basic_string_view<CharT>(Specials, 4)) != std::basic_string_view<CharT>::npos;
+	}
+
+	// Appends Value as one CSV cell, quoted with its quotes doubled when NeedsCsvQuotes.
+	template <typename CharT, typename AppendFn>
+	void AppendCsvCell(std::basic_string_view<CharT> Value, AppendFn&& Append)
+	{
+		if (NeedsCsvQuotes(Value))
+		{
+			Private::AppendQuoted(Value, Append);
+		}
+		else
+		{
+			Append(Value.data(), Value.size());
+		}
+	}
+
+	// Calls OnCell(std::basic_string_view<CharT>) for each cell of one record, unquoted. An empty record is one empty cell.
+	template <typename CharT, typename OnCellFn>
+	void ParseCsvLine(std::basic_string_view<CharT> Line, OnCellFn&& OnCell)
+	{
+		std::basic_string<CharT> Scratch;
+		Private::SplitQuoted(Line, static_cast<CharT>(','), Scratch, OnCell);
+	}
+
+	// Reads the record that starts at InOutPos and moves InOutPos past its line break (\n, \r\n or \r). Line breaks
+	// inside quoted cells belong to the record. False when InOutPos is at the end of Content.
+	template <typename CharT>
+	bool ReadCsvRecord(std::basic_string_view<CharT> Content, size_t& InOutPos, std::basic_string_view<CharT>& OutRecord)
+	{
+		using FView = std::basic_string_view<CharT>;
+		if (InOutPos >= Content.size())
+		{
+			OutRecord = FView();
+			return false;
+		}
+
+		const CharT LF = static_cast<CharT>('\n');
+		const CharT CR = static_cast<CharT>('\r');
+		const CharT StopChars[] = { Private::Quote<CharT>, LF, CR };
+		const FView Stops(StopChars, 3);
+		const FView QuoteOnly(StopChars, 1);
+
+		const size_t Start = InOutPos;
+		bool bInQuotes = false;
+		size_t Pos = Start;
+		for (;;)
+		{
+			Pos = Content.find_first_of(bInQuotes ? QuoteOnly : Stops, Pos);
+			if (Pos == FView::npos)
+			{
+				Pos = Content.size();
+				break;
+			}
+			if (Content[Pos] != Private::Quote<CharT>)
+				break;
+			bInQuotes = !bInQuotes;
+			++Pos;
+		}
+
+		OutRecord = Content.substr(Start, Pos - Start);
+		if (Pos < Content.size() && Content[Pos] == CR)
+		{
+			++Pos;
+		}
+		if (Pos < Content.size() && Content[Pos] == LF)
+		{
+			++Pos;
+		}
+		InOutPos = Pos;
+		return true;
+	}
+}
@@ -0,0 +1,92 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+// Number formatting for cells, independent of the engine. Output goes through Append(const CharT* Data, size_t Len).
+namespace AssetCsvSync::Core
+{
+	// Appends ASCII text widened to CharT.
+	template <typename CharT, typename AppendFn>
+	void AppendAscii(const char* Text, size_t Len, AppendFn&& Append)
+	{
+		CharT Buffer[128];
+		while (Len > 0)
+		{
+			const size_t Chunk = Len < 128 ? Len : 128;
+			for (size_t i = 0; i < Chunk; ++i)
+			{
+				Buffer[i] = static_cast<CharT>(Text[i]);
+			}
+			Append(Buffer, Chunk);
+			Text += Chunk;
+			Len -= Chunk;
+		}
+	}
+
+	// Same text as %d / %lld.
+	template <typename CharT, typename AppendFn>
+	void FormatInteger(int64_t Value, AppendFn&& Append)
+	{
+		char Buffer[24];
+		const std::to_chars_result Result = std::to_chars(Buffer, Buffer + sizeof(Buffer), Value);
+		AppendAscii<CharT>(Buffer, static_cast<size_t>(Result.ptr - Buffer), Append);
+	}
+
+	// Same text as FString::SanitizeFloat: fixed notation with six decimals, trailing zeros trimmed down to one
+	// fractional digit, and -0 written as 0.0. Infinities and NaN are written the way printf writes them.
+	template <typename CharT, typename AppendFn>
+	void FormatDecimal(double Value, AppendFn&& Append)
+	{
+		if (Value == 0.0)
+		{
+			Value = 0.0;
+		}
+
+		// The longest fixed-notation double is 309 integer digits, a sign, a point and six decimals.
+		char Buffer[330];
+		int Len = std::snprintf(Buffer, sizeof(Buffer), "%f", Value);
+		if (Len < 0)
+			return;
+		if (std::isfinite(Value))
+		{
+			while (Len > 0 && Buffer[Len - 1] == '0')
+			{
+				--Len;
+			}
+			if (Len > 0 && Buffer[Len - 1] == '.')
+			{
+				++Len;
+			}
+		}
+		AppendAscii<CharT>(Buffer, static_cast<size_t>(Len), Append);
+	}
+
+	// Shortest %.15g to %.17g text that reads back as the same double, as written into JSON map cells.
+	// JSON has no infinities or NaN; those are written as null.
+	template <typename CharT, typename AppendFn>
+	void FormatShortestDouble(double Value, AppendFn&& Append)
+	{
+		if (!std::isfinite(Value))
+		{
+			AppendAscii<CharT>("null", 4, Append);
+			return;
+		}
+
+		char Buffer[32];
+		int Len = 0;
+		for (int Precision = 15; Precision <= 17; ++Precision)
+		{
+			Len = std::snprintf(Buffer, sizeof(Buffer), "%.*g", Precision, Value);
+			if (std::strtod(Buffer, nullptr) == Value)
+				break;
+		}
+		AppendAscii<CharT>(Buffer, static_cast<size_t>(Len), Append);
+	}
+}
@@ -0,0 +1,203 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#include "AssetCsvSyncCore/CellCodec.h"
+#include "CoreTestHelpers.h"
+
+#include <tuple>
+
+namespace AssetCsvSync::Core::Tests
+{
+	template <typename CharT>
+	struct TMapEntry
+	{
+		std::basic_string<CharT> Key;
+		EMapCellValue Kind;
+		std::basic_string<CharT> Value;
+
+		bool operator==(const TMapEntry& Other) const { return std::tie(Key, Kind, Value) == std::tie(Other.Key, Other.Kind, Other.Value); }
+	};
+
+	template <typename CharT>
+	class CellCodecTest : public ::testing::Test
+	{
+	protected:
+		using FEntry = TMapEntry<CharT>;
+
+		static std::basic_string<CharT> Join(const std::vector<std::basic_string<CharT>>& Items)
+		{
+			std::basic_string<CharT> Out;
+			JoinListCell<CharT>(Items.size(), [&Items](size_t Index) { return std::basic_string_view<CharT>(Items[Index]); }, TAppendTo<CharT>{ Out });
+			return Out;
+		}
+
+		static std::vector<std::basic_string<CharT>> Split(const std::basic_string<CharT>& Cell)
+		{
+			std::vector<std::basic_string<CharT>> Items;
+			ParseListCell(std::basic_string_view<CharT>(Cell), TCollect<CharT>{ Items });
+			return Items;
+		}
+
+		static bool ParseMap(const std::basic_string<CharT>& Cell, std::vector<FEntry>& OutEntries)
+		{
+			return ParseMapCell(std::basic_string_view<CharT>(Cell), [&OutEntries](std::basic_string_view<CharT> Key, EMapCellValue Kind, std::basic_string_view<CharT> Value)
+			{
+				OutEntries.push_back(FEntry{ std::basic_string<CharT>(Key), Kind, std::basic_string<CharT>(Value) });
+			});
+		}
+
+		static FEntry Entry(std::string_view Key, EMapCellValue Kind, std::string_view Value)
+		{
+			return FEntry{ Str<CharT>(Key), Kind, Str<CharT>(Value) };
+		}
+	};
+
+	TYPED_TEST_SUITE(CellCodecTest, FCharTypes);
+
+	TYPED_TEST(CellCodecTest, JoinsListItems)
+	{
+		EXPECT_EQ(this->Join({}), Str<TypeParam>(""));
+		EXPECT_EQ(this->Join(Strs<TypeParam>({ "a", "b" })), Str<TypeParam>("a;b"));
+		EXPECT_EQ(this->Join(Strs<TypeParam>({ "" })), Str<TypeParam>("\"\""));
+		EXPECT_EQ(this->Join(Strs<TypeParam>({ "a", "" })), Str<TypeParam>("a;\"\""));
+		EXPECT_EQ(this->Join(Strs<TypeParam>({ "x;y", "q\"" })), Str<TypeParam>("\"x;y\";\"q\"\"\""));
+	}
+
+	TYPED_TEST(CellCodecTest, ParsesListItems)
+	{
+		EXPECT_TRUE(this->Split(Str<TypeParam>("")).empty());
+		EXPECT_EQ(this->Split(Str<TypeParam>("a;b;c")), Strs<TypeParam>({ "a", "b", "c" }));
+		EXPECT_EQ(this->Split(Str<TypeParam>("\"\"")), Strs<TypeParam>({ "" }));
+		EXPECT_EQ(this->Split(Str<TypeParam>("a;")), Strs<TypeParam>({ "a", "" }));
+		EXPECT_EQ(this->Split(Str<TypeParam>("\"x;y\";z")), Strs<TypeParam>({ "x;y", "z" }));
+	}
+
+	TYPED_TEST(CellCodecTest, ListCellsRoundTrip)
+	{
+		const std::vector<std::vector<std::basic_string<TypeParam>>> Lists = {
+			Strs<TypeParam>({ "1", "2", "3" }),
+			Strs<TypeParam>({ "" }),
+			Strs<TypeParam>({ "", "" }),
+			Strs<TypeParam>({ "semi;colon", "\"quoted\"", "(X=1,Y=2)" }),
+		};
+		for (const std::vector<std::basic_string<TypeParam>>& Items : Lists)
+		{
+			EXPECT_EQ(this->Split(this->Join(Items)), Items);
+		}
+	}
+
+	TYPED_TEST(CellCodecTest, WritesCondensedMapCells)
+	{
+		std::basic_string<TypeParam> Out;
+		TAppendTo<TypeParam> Append{ Out };
+		{
+			TMapCellWriter<TypeParam, TAppendTo<TypeParam>> Writer(Append);
+			Writer.Finish();
+		}
+		EXPECT_EQ(Out, Str<TypeParam>("{}"));
+
+		Out.clear();
+		TMapCellWriter<TypeParam, TAppendTo<TypeParam>> Writer(Append);
+		Writer.Integer(Str<TypeParam>("Strength"), 12);
+		Writer.Number(Str<TypeParam>("Speed"), 1.5);
+		Writer.Bool(Str<TypeParam>("Flying"), true);
+		Writer.String(Str<TypeParam>("Name"), Str<TypeParam>("say \"hi\"\n\\"));
+		Writer.Finish();
+		EXPECT_EQ(Out, Str<TypeParam>("{\"Strength\":12,\"Speed\":1.5,\"Flying\":true,\"Name\":\"say \\\"hi\\\"\\n\\\\\"}"));
+	}
+
+	TYPED_TEST(CellCodecTest, EscapesControlCharactersInMapStrings)
+	{
+		std::basic_string<TypeParam> Out;
+		TAppendTo<TypeParam> Append{ Out };
+		TMapCellWriter<TypeParam, TAppendTo<TypeParam>> Writer(Append);
+		Writer.String(Str<TypeParam>("k"), Str<TypeParam>(std::string_view("\x01\t", 2)));
+		Writer.Finish();
+		EXPECT_EQ(Out, Str<TypeParam>("{\"k\":\"\\u0001\\t\"}"));
+	}
+
+	TYPED_TEST(CellCodecTest, ParsesMapCells)
+	{
+		using FEntry = TMapEntry<TypeParam>;
+		std::vector<FEntry> Entries;
+		ASSERT_TRUE(this->ParseMap(Str<TypeParam>("{\"a\":1,\"b\":-2.5e3,\"c\":\"x\\\"y\",\"d\":false,\"e\":null,\"f\":[1,{\"g\":2}]}"), Entries));
+		const std::vector<FEntry> Expected = {
+			this->Entry("a", EMapCellValue::Number, "1"),
+			this->Entry("b", EMapCellValue::Number, "-2.5e3"),
+			this->Entry("c", EMapCellValue::String, "x\"y"),
+			this->Entry("d", EMapCellValue::Bool, "false"),
+			this->Entry("e", EMapCellValue::Null, "null"),
+			this->Entry("f", EMapCellValue::Raw, "[1,{\"g\":2}]"),
+		};
+		EXPECT_EQ(Entries, Expected);
+	}
+
+	TYPED_TEST(CellCodecTest, ParsesPrettyPrintedMapCells)
+	{
+		using FEntry = TMapEntry<TypeParam>;
+		std::vector<FEntry> Entries;
+		ASSERT_TRUE(this->ParseMap(Str<TypeParam>("{\r\n\t\"Fire\": 10,\r\n\t\"Ice\": \"cold\"\r\n}"), Entries));
+		const std::vector<FEntry> Expected = {
+			this->Entry("Fire", EMapCellValue::Number, "10"),
+			this->Entry("Ice", EMapCellValue::String, "cold"),
+		};
+		EXPECT_EQ(Entries, Expected);
+
+		Entries.clear();
+		EXPECT_TRUE(this->ParseMap(Str<TypeParam>(" { } "), Entries));
+		EXPECT_TRUE(Entries.empty());
+	}
+
+	TYPED_TEST(CellCodecTest, RejectsMalformedMapCells)
+	{
+		for (std::string_view Cell : { "", "[]", "{", "{\"a\"}", "{\"a\":}", "{\"a\":01}", "{\"a\":1,}", "{\"a\":tru}", "{\"a\":1} x", "{a:1}", "{\"a\":\"\\q\"}" })
+		{
+			std::vector<TMapEntry<TypeParam>> Entries;
+			EXPECT_FALSE(this->ParseMap(Str<TypeParam>(Cell), Entries)) << Cell;
+		}
+	}
+
+	TYPED_TEST(CellCodecTest, MapCellsRoundTrip)
+	{
+		std::basic_string<TypeParam> Out;
+		TAppendTo<TypeParam> Append{ Out };
+		TMapCellWriter<TypeParam, TAppendTo<TypeParam>> Writer(Append);
+		Writer.Number(Str<TypeParam>("Tenth"), 0.1);
+		Writer.Number(Str<TypeParam>("Third"), 1.0 / 3.0);
+		Writer.Integer(Str<TypeParam>("Big"), 9007199254740993LL);
+		Writer.String(Str<TypeParam>("Quote\"Key"), Str<TypeParam>(""));
+		Writer.Finish();
+
+		using FEntry = TMapEntry<TypeParam>;
+		std::vector<FEntry> Entries;
+		ASSERT_TRUE(this->ParseMap(Out, Entries));
+		ASSERT_EQ(Entries.size(), 4u);
+		EXPECT_EQ(Entries[0].Value, Str<TypeParam>("0.1"));
+		EXPECT_EQ(std::stod(std::string(Entries[1].Value.begin(), Entries[1].Value.end())), 1.0 / 3.0);
+		EXPECT_EQ(Entries[2].Value, Str<TypeParam>("9007199254740993"));
+		EXPECT_EQ(Entries[3], this->Entry("Quote\"Key", EMapCellValue::String, ""));
+	}
+
+	TYPED_TEST(CellCodecTest, DecodesUnicodeEscapes)
+	{
+		std::vector<TMapEntry<TypeParam>> Entries;
+		ASSERT_TRUE(this->ParseMap(Str<TypeParam>("{\"k\":\"\\u00e9\\ud83d\\ude00\"}"), Entries));
+		ASSERT_EQ(Entries.size(), 1u);
+
+		std::basic_string<TypeParam> Expected;
+		Private::AppendCodePoint(Expected, 0xE9);
+		Private::AppendCodePoint(Expected, 0x1F600);
+		EXPECT_EQ(Entries[0].Value, Expected);
+		if constexpr (sizeof(TypeParam) == 1)
+		{
+			EXPECT_EQ(Entries[0].Value, Str<TypeParam>("\xC3\xA9\xF0\x9F\x98\x80"));
+		}
+		else if constexpr (sizeof(TypeParam) == 2)
+		{
+			EXPECT_EQ(Entries[0].Value.size(), 3u);
+		}
+		else
+		{
+			EXPECT_EQ(Entries[0].Value.size(), 2u);
+		}
+	}
+}
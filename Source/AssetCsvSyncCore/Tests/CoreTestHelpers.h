@@ -0,0 +1,49 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace AssetCsvSync::Core::Tests
+{
+	// char is the UTF-8 build, char16_t is TCHAR on Linux and Mac, wchar_t is TCHAR on Windows.
+	using FCharTypes = ::testing::Types<char, char16_t, wchar_t>;
+
+	// Widens ASCII (or, for char, UTF-8) test text.
+	template <typename CharT>
+	std::basic_string<CharT> Str(std::string_view Text)
+	{
+		return std::basic_string<CharT>(Text.begin(), Text.end());
+	}
+
+	template <typename CharT>
+	struct TAppendTo
+	{
+		std::basic_string<CharT>& Out;
+
+		void operator()(const CharT* Data, size_t Len) const { Out.append(Data, Len); }
+	};
+
+	template <typename CharT>
+	struct TCollect
+	{
+		std::vector<std::basic_string<CharT>>& Out;
+
+		void operator()(std::basic_string_view<CharT> Value) const { Out.emplace_back(Value); }
+	};
+
+	template <typename CharT>
+	std::vector<std::basic_string<CharT>> Strs(std::initializer_list<std::string_view> Texts)
+	{
+		std::vector<std::basic_string<CharT>> Out;
+		for (std::string_view Text : Texts)
+		{
+			Out.push_back(Str<CharT>(Text));
+		}
+		return Out;
+	}
+}
@@ -0,0 +1,105 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#include "AssetCsvSyncCore/CsvCodec.h"
+#include "CoreTestHelpers.h"
+
+namespace AssetCsvSync::Core::Tests
+{
+	template <typename CharT>
+	class CsvCodecTest : public ::testing::Test
+	{
+	protected:
+		static std::vector<std::basic_string<CharT>> Parse(std::string_view Line)
+		{
+			const std::basic_string<CharT> Text = Str<CharT>(Line);
+			std::vector<std::basic_string<CharT>> Cells;
+			ParseCsvLine(std::basic_string_view<CharT>(Text), TCollect<CharT>{ Cells });
+			return Cells;
+		}
+
+		static std::basic_string<CharT> Escape(std::string_view Value)
+		{
+			const std::basic_string<CharT> Text = Str<CharT>(Value);
+			std::basic_string<CharT> Out;
+			AppendCsvCell(std::basic_string_view<CharT>(Text), TAppendTo<CharT>{ Out });
+			return Out;
+		}
+
+		static std::vector<std::basic_string<CharT>> Records(std::string_view Content)
+		{
+			const std::basic_string<CharT> Text = Str<CharT>(Content);
+			std::vector<std::basic_string<CharT>> Out;
+			size_t Pos = 0;
+			std::basic_string_view<CharT> Record;
+			while (ReadCsvRecord(std::basic_string_view<CharT>(Text), Pos, Record))
+			{
+				Out.emplace_back(Record);
+			}
+			return Out;
+		}
+	};
+
+	TYPED_TEST_SUITE(CsvCodecTest, FCharTypes);
+
+	TYPED_TEST(CsvCodecTest, ParsesPlainCells)
+	{
+		EXPECT_EQ(this->Parse("a,b,c"), Strs<TypeParam>({ "a", "b", "c" }));
+		EXPECT_EQ(this->Parse(""), Strs<TypeParam>({ "" }));
+		EXPECT_EQ(this->Parse(",,"), Strs<TypeParam>({ "", "", "" }));
+		EXPECT_EQ(this->Parse("a,"), Strs<TypeParam>({ "a", "" }));
+		EXPECT_EQ(this->Parse(" a , b "), Strs<TypeParam>({ " a ", " b " }));
+	}
+
+	TYPED_TEST(CsvCodecTest, ParsesQuotedCells)
+	{
+		EXPECT_EQ(this->Parse("\"a,b\",c"), Strs<TypeParam>({ "a,b", "c" }));
+		EXPECT_EQ(this->Parse("\"say \"\"hi\"\"\""), Strs<TypeParam>({ "say \"hi\"" }));
+		EXPECT_EQ(this->Parse("\"\",x"), Strs<TypeParam>({ "", "x" }));
+		EXPECT_EQ(this->Parse("\"line\nbreak\",\"(X=1,Y=2)\""), Strs<TypeParam>({ "line\nbreak", "(X=1,Y=2)" }));
+		EXPECT_EQ(this->Parse("\"a\",\"b\","), Strs<TypeParam>({ "a", "b", "" }));
+	}
+
+	TYPED_TEST(CsvCodecTest, QuotesOpenAnywhereInACell)
+	{
+		EXPECT_EQ(this->Parse("a\"b,c\"d,e"), Strs<TypeParam>({ "ab,cd", "e" }));
+		EXPECT_EQ(this->Parse("\"unterminated,cell"), Strs<TypeParam>({ "unterminated,cell" }));
+	}
+
+	TYPED_TEST(CsvCodecTest, EscapesOnlyWhenNeeded)
+	{
+		EXPECT_EQ(this->Escape("plain"), Str<TypeParam>("plain"));
+		EXPECT_EQ(this->Escape(""), Str<TypeParam>(""));
+		EXPECT_EQ(this->Escape("a,b"), Str<TypeParam>("\"a,b\""));
+		EXPECT_EQ(this->Escape("say \"hi\""), Str<TypeParam>("\"say \"\"hi\"\"\""));
+		EXPECT_EQ(this->Escape("two\nlines"), Str<TypeParam>("\"two\nlines\""));
+		EXPECT_EQ(this->Escape("cr\r"), Str<TypeParam>("\"cr\r\""));
+	}
+
+	TYPED_TEST(CsvCodecTest, EscapedCellsRoundTrip)
+	{
+		for (std::string_view Value : { "", "a", "a,b", "\"", "\"\"", "x\"y,z\n", ",", "(X=1.0,Y=2.0)" })
+		{
+			const std::basic_string<TypeParam> Escaped = this->Escape(Value);
+			std::basic_string<TypeParam> Line = Escaped + Str<TypeParam>(",") + Escaped;
+			std::vector<std::basic_string<TypeParam>> Cells;
+			ParseCsvLine(std::basic_string_view<TypeParam>(Line), TCollect<TypeParam>{ Cells });
+			ASSERT_EQ(Cells.size(), 2u) << Value;
+			EXPECT_EQ(Cells[0], Str<TypeParam>(Value));
+			EXPECT_EQ(Cells[1], Str<TypeParam>(Value));
+		}
+	}
+
+	TYPED_TEST(CsvCodecTest, ReadsRecordsAcrossLineEndings)
+	{
+		EXPECT_EQ(this->Records("a,b\nc,d\n"), Strs<TypeParam>({ "a,b", "c,d" }));
+		EXPECT_EQ(this->Records("a\r\nb\rc"), Strs<TypeParam>({ "a", "b", "c" }));
+		EXPECT_EQ(this->Records("a\n\nb"), Strs<TypeParam>({ "a", "", "b" }));
+		EXPECT_TRUE(this->Records("").empty());
+	}
+
+	TYPED_TEST(CsvCodecTest, KeepsQuotedLineBreaksInTheRecord)
+	{
+		EXPECT_EQ(this->Records("k,\"multi\nline\"\nnext\n"), Strs<TypeParam>({ "k,\"multi\nline\"", "next" }));
+		EXPECT_EQ(this->Records("\"a\"\"\nb\"\n"), Strs<TypeParam>({ "\"a\"\"\nb\"" }));
+	}
+}
@@ -0,0 +1,72 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#include "AssetCsvSyncCore/NumberFormat.h"
+#include "CoreTestHelpers.h"
+
+#include <cstdint>
+#include <limits>
+
+namespace AssetCsvSync::Core::Tests
+{
+	template <typename CharT>
+	class NumberFormatTest : public ::testing::Test
+	{
+	protected:
+		static std::basic_string<CharT> Integer(int64_t Value)
+		{
+			std::basic_string<CharT> Out;
+			FormatInteger<CharT>(Value, TAppendTo<CharT>{ Out });
+			return Out;
+		}
+
+		static std::basic_string<CharT> Decimal(double Value)
+		{
+			std::basic_string<CharT> Out;
+			FormatDecimal<CharT>(Value, TAppendTo<CharT>{ Out });
+			return Out;
+		}
+
+		static std::basic_string<CharT> Shortest(double Value)
+		{
+			std::basic_string<CharT> Out;
+			FormatShortestDouble<CharT>(Value, TAppendTo<CharT>{ Out });
+			return Out;
+		}
+	};
+
+	TYPED_TEST_SUITE(NumberFormatTest, FCharTypes);
+
+	TYPED_TEST(NumberFormatTest, FormatsIntegers)
+	{
+		EXPECT_EQ(this->Integer(0), Str<TypeParam>("0"));
+		EXPECT_EQ(this->Integer(-42), Str<TypeParam>("-42"));
+		EXPECT_EQ(this->Integer(std::numeric_limits<int64_t>::min()), Str<TypeParam>("-9223372036854775808"));
+		EXPECT_EQ(this->Integer(std::numeric_limits<int64_t>::max()), Str<TypeParam>("9223372036854775807"));
+	}
+
+	// The cell text of float and double properties, unchanged from FString::SanitizeFloat.
+	TYPED_TEST(NumberFormatTest, FormatsDecimalsLikeSanitizeFloat)
+	{
+		EXPECT_EQ(this->Decimal(0.0), Str<TypeParam>("0.0"));
+		EXPECT_EQ(this->Decimal(-0.0), Str<TypeParam>("0.0"));
+		EXPECT_EQ(this->Decimal(1.0), Str<TypeParam>("1.0"));
+		EXPECT_EQ(this->Decimal(100.0), Str<TypeParam>("100.0"));
+		EXPECT_EQ(this->Decimal(-2.5), Str<TypeParam>("-2.5"));
+		EXPECT_EQ(this->Decimal(0.1f), Str<TypeParam>("0.1"));
+		EXPECT_EQ(this->Decimal(1.0 / 3.0), Str<TypeParam>("0.333333"));
+		EXPECT_EQ(this->Decimal(1e-7), Str<TypeParam>("0.0"));
+		EXPECT_EQ(this->Decimal(-1e-7), Str<TypeParam>("-0.0"));
+		EXPECT_EQ(this->Decimal(123456789.0), Str<TypeParam>("123456789.0"));
+		EXPECT_EQ(this->Decimal(std::numeric_limits<double>::max()).size(), 311u);
+		EXPECT_EQ(this->Decimal(std::numeric_limits<double>::infinity()), Str<TypeParam>("inf"));
+	}
+
+	TYPED_TEST(NumberFormatTest, FormatsShortestRoundTripDoubles)
+	{
+		EXPECT_EQ(this->Shortest(0.1), Str<TypeParam>("0.1"));
+		EXPECT_EQ(this->Shortest(2.0), Str<TypeParam>("2"));
+		EXPECT_EQ(this->Shortest(1e300), Str<TypeParam>("1e+300"));
+		EXPECT_EQ(this->Shortest(0.30000000000000004), Str<TypeParam>("0.30000000000000004"));
+		EXPECT_EQ(this->Shortest(std::numeric_limits<double>::quiet_NaN()), Str<TypeParam>("null"));
+	}
+}
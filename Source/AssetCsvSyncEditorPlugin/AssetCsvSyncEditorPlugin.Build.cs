@@ -1,5 +1,6 @@
 // MIT Licensed. Copyright (c) 2026 Olga Taranova
 
+using System.IO;
 using UnrealBuildTool;
 
 public class AssetCsvSyncEditorPlugin : ModuleRules
@@ -8,6 +9,9 @@ public class AssetCsvSyncEditorPlugin : ModuleRules
 	{
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
+		// Engine-independent cell codecs, header only; built and tested on their own by Source/AssetCsvSyncCore/CMakeLists.txt.
+		PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "..", "AssetCsvSyncCore", "Public"));
+
 		PublicDependencyModuleNames.AddRange(new string[] {
 			"Core",
 			"CoreUObject",
@@ -20,12 +24,14 @@ public class AssetCsvSyncEditorPlugin : ModuleRules
 			"PropertyEditor",
 			"UnrealEd",
 			"AssetRegistry",
+			"SourceControl",
 			"Json",
 			"Slate",
 			"SlateCore",
 			"ToolMenus",
 			"LevelEditor",
 			"DesktopPlatform",
+			"SQLiteCore",
 		});
 	}
 }
@@ -0,0 +1,638 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#include "AssetCsvSyncBinaryTable.h"
+
+#include "AssetCsvSyncCoreAdapter.h"
+#include "AssetCsvSyncLog.h"
+
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static const uint32 AssetCsvSync_BinaryMagic = 0x42534341; // "ACSB"
+static const uint32 AssetCsvSync_BinaryVersion = 1;
+static const int64 AssetCsvSync_BinaryHeaderSize = 40;
+static const int64 AssetCsvSync_BinaryColumnEntrySize = 32;
+
+enum class EAssetCsvSyncBinaryCompression : uint8
+{
+	None,
+	Zlib,
+};
+
+static int64 AssetCsvSync_BinaryValueSize(EAssetCsvSyncBinaryKind Kind)
+{
+	switch (Kind)
+	{
+	case EAssetCsvSyncBinaryKind::Int64:
+	case EAssetCsvSyncBinaryKind::Double:
+		return 8;
+	case EAssetCsvSyncBinaryKind::Bool:
+		return 1;
+	default:
+		return 4;
+	}
+}
+
+static int64 AssetCsvSync_Align8(int64 Value)
+{
+	return (Value + 7) & ~int64(7);
+}
+
+bool FAssetCsvSyncBinaryTableWriter::IsBinaryTableFile(const FString& FilePath)
+{
+	return FPaths::GetExtension(FilePath).Equals(TEXT("acsb"), ESearchCase::IgnoreCase);
+}
+
+EAssetCsvSyncBinaryKind FAssetCsvSyncBinaryTableWriter::GetKind(const FProperty* Property)
+{
+	if (Property->IsA<FBoolProperty>())
+		return EAssetCsvSyncBinaryKind::Bool;
+	if (Property->IsA<FNameProperty>() || Property->IsA<FStrProperty>())
+		return EAssetCsvSyncBinaryKind::String;
+	// Enum bytes keep their name text; uint64 does not fit the signed column.
+	const FNumericProperty* NumericProp = CastField<FNumericProperty>(Property);
+	if (!NumericProp || NumericProp->IsEnum() || Property->IsA<FUInt64Property>())
+		return EAssetCsvSyncBinaryKind::Text;
+	return NumericProp->IsInteger() ? EAssetCsvSyncBinaryKind::Int64 : EAssetCsvSyncBinaryKind::Double;
+}
+
+int32 FAssetCsvSyncBinaryTableWriter::AddRow()
+{
+	return Rows++;
+}
+
+FAssetCsvSyncTypedCell FAssetCsvSyncTypedCell::FromProperty(const FProperty* Property, const void* PropertyData)
+{
+	FAssetCsvSyncTypedCell Cell;
+	Cell.Kind = FAssetCsvSyncBinaryTableWriter::GetKind(Property);
+	switch (Cell.Kind)
+	{
+	case EAssetCsvSyncBinaryKind::Int64:
+		Cell.Int = CastField<FNumericProperty>(Property)->GetSignedIntPropertyValue(PropertyData);
+		break;
+	case EAssetCsvSyncBinaryKind::Double:
+		Cell.Double = CastField<FNumericProperty>(Property)->GetFloatingPointPropertyValue(PropertyData);
+		break;
+	case EAssetCsvSyncBinaryKind::Bool:
+		Cell.Int = CastField<FBoolProperty>(Property)->GetPropertyValue(PropertyData) ? 1 : 0;
+		break;
+	case EAssetCsvSyncBinaryKind::String:
+		if (const FNameProperty* NameProp = CastField<FNameProperty>(Property))
+		{
+			Cell.String = NameProp->GetPropertyValue(PropertyData).ToString();
+		}
+		else
+		{
+			Cell.String = CastField<FStrProperty>(Property)->GetPropertyValue(PropertyData);
+		}
+		break;
+	default:
+		checkf(false, TEXT("FromProperty: %s is stored as text"), *Property->GetName());
+		break;
+	}
+	return Cell;
+}
+
+FAssetCsvSyncTypedCell FAssetCsvSyncTypedCell::FromString(EAssetCsvSyncBinaryKind Kind, const FString& Value)
+{
+	FAssetCsvSyncTypedCell Cell;
+	Cell.Kind = Kind;
+	Cell.String = Value;
+	return Cell;
+}
+
+static FString AssetCsvSync_CellText(EAssetCsvSyncBinaryKind Kind, int64 Int, double Double, const FString& String)
+{
+	switch (Kind)
+	{
+	case EAssetCsvSyncBinaryKind::Int64:
+		return LexToString(Int);
+	case EAssetCsvSyncBinaryKind::Double:
+		return AssetCsvSync_FormatDecimal(Double);
+	case EAssetCsvSyncBinaryKind::Bool:
+		return Int != 0 ? TEXT("true") : TEXT("false");
+	default:
+		return String;
+	}
+}
+
+void FAssetCsvSyncBinaryTableWriter::SetCell(int32 Row, const FString& ColumnName, FAssetCsvSyncTypedCell&& Cell)
+{
+	int32 Index = INDEX_NONE;
+	if (const int32* Found = ColumnIndex.Find(ColumnName))
+	{
+		Index = *Found;
+	}
+	else
+	{
+		Index = Columns.AddDefaulted();
+		Columns[Index].Name = ColumnName;
+		Columns[Index].Kind = Cell.Kind;
+		ColumnIndex.Add(ColumnName, Index);
+	}
+
+	FColumn& Column = Columns[Index];
+	if (Column.Kind != Cell.Kind)
+	{
+		Demote(Column);
+		Cell.String = AssetCsvSync_CellText(Cell.Kind, Cell.Int, Cell.Double, Cell.String);
+		Cell.Kind = EAssetCsvSyncBinaryKind::Text;
+	}
+
+	const int64 ValueSize = AssetCsvSync_BinaryValueSize(Column.Kind);
+	if (Column.Present.Num() <= Row)
+	{
+		Column.Present.SetNumZeroed(Row + 1);
+		Column.Values.SetNumZeroed((Row + 1) * ValueSize);
+	}
+	Column.Present[Row] = 1;
+
+	uint8* Value = Column.Values.GetData() + Row * ValueSize;
+	switch (Column.Kind)
+	{
+	case EAssetCsvSyncBinaryKind::Int64:
+		FMemory::Memcpy(Value, &Cell.Int, sizeof(int64));
+		break;
+	case EAssetCsvSyncBinaryKind::Double:
+		FMemory::Memcpy(Value, &Cell.Double, sizeof(double));
+		break;
+	case EAssetCsvSyncBinaryKind::Bool:
+		*Value = static_cast<uint8>(Cell.Int);
+		break;
+	default:
+	{
+		const uint32 Id = AddString(Cell.String);
+		FMemory::Memcpy(Value, &Id, sizeof(uint32));
+		break;
+	}
+	}
+}
+
+void FAssetCsvSyncBinaryTableWriter::Demote(FColumn& Column)
+{
+	if (Column.Kind == EAssetCsvSyncBinaryKind::Text)
+		return;
+
+	const int64 ValueSize = AssetCsvSync_BinaryValueSize(Column.Kind);
+	TArray64<uint8> Ids;
+	Ids.SetNumZeroed(Column.Present.Num() * sizeof(uint32));
+	for (int32 Row = 0; Row < Column.Present.Num(); ++Row)
+	{
+		if (!Column.Present[Row])
+			continue;
+
+		const uint8* Value = Column.Values.GetData() + Row * ValueSize;
+		int64 Int = 0;
+		double Double = 0.0;
+		uint32 Id = 0;
+		switch (Column.Kind)
+		{
+		case EAssetCsvSyncBinaryKind::Int64:
+			FMemory::Memcpy(&Int, Value, sizeof(int64));
+			break;
+		case EAssetCsvSyncBinaryKind::Double:
+			FMemory::Memcpy(&Double, Value, sizeof(double));
+			break;
+		case EAssetCsvSyncBinaryKind::Bool:
+			Int = *Value;
+			break;
+		default:
+			FMemory::Memcpy(&Id, Value, sizeof(uint32));
+			break;
+		}
+		if (Column.Kind != EAssetCsvSyncBinaryKind::String)
+		{
+			Id = AddString(AssetCsvSync_CellText(Column.Kind, Int, Double, FString()));
+		}
+		FMemory::Memcpy(Ids.GetData() + Row * sizeof(uint32), &Id, sizeof(uint32));
+	}
+	Column.Values = MoveTemp(Ids);
+	Column.Kind = EAssetCsvSyncBinaryKind::Text;
+}
+
+uint32 FAssetCsvSyncBinaryTableWriter::AddString(const FString& Value)
+{
+	if (const uint32* Found = StringIds.Find(Value))
+		return *Found;
+	const uint32 Id = Strings.Add(Value);
+	StringIds.Add(Value, Id);
+	return Id;
+}
+
+bool FAssetCsvSyncBinaryTableWriter::Save(const FString& FilePath, const FString& KeyColumn, bool bCompress, FAssetCsvSyncParallelFor ParallelFor)
+{
+	struct FBlock
+	{
+		TArray64<uint8> Bytes;
+		int64 RawSize = 0;
+		EAssetCsvSyncBinaryCompression Compression = EAssetCsvSyncBinaryCompression::None;
+		uint32 NameId = 0;
+	};
+
+	// Column names share the pool with the cells; they are added before the pool is written.
+	TArray<FBlock> Blocks;
+	Blocks.SetNum(Columns.Num());
+	for (int32 Index = 0; Index < Columns.Num(); ++Index)
+	{
+		Blocks[Index].NameId = AddString(Columns[Index].Name);
+	}
+
+	// Columns are laid out and compressed independently.
+	ParallelFor(Columns.Num(), [this, &Blocks, bCompress](int32 Index)
+	{
+		const FColumn& Column = Columns[Index];
+		FBlock& Block = Blocks[Index];
+		const int64 ValueSize = AssetCsvSync_BinaryValueSize(Column.Kind);
+		const int64 PresentSize = AssetCsvSync_Align8(Rows);
+		Block.RawSize = PresentSize + Rows * ValueSize;
+
+		TArray64<uint8> Raw;
+		Raw.SetNumZeroed(Block.RawSize);
+		FMemory::Memcpy(Raw.GetData(), Column.Present.GetData(), Column.Present.Num());
+		FMemory::Memcpy(Raw.GetData() + PresentSize, Column.Values.GetData(), Column.Values.Num());
+
+		// Kept compressed only when it saves at least a tenth; small or random columns stay mappable.
+		if (bCompress && Block.RawSize > 4096 && Block.RawSize <= MAX_int32)
+		{
+			int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, static_cast<int32>(Block.RawSize));
+			TArray64<uint8> Compressed;
+			Compressed.SetNumUninitialized(CompressedSize);
+			if (FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Raw.GetData(), static_cast<int32>(Block.RawSize))
+				&& CompressedSize < Block.RawSize - Block.RawSize / 10)
+			{
+				Compressed.SetNum(CompressedSize);
+				Block.Bytes = MoveTemp(Compressed);
+				Block.Compression = EAssetCsvSyncBinaryCompression::Zlib;
+				return;
+			}
+		}
+		Block.Bytes = MoveTemp(Raw);
+	});
+
+	const int64 DirectoryOffset = AssetCsvSync_BinaryHeaderSize;
+	int64 Offset = AssetCsvSync_Align8(DirectoryOffset + Columns.Num() * AssetCsvSync_BinaryColumnEntrySize);
+	TArray<int64> BlockOffsets;
+	for (const FBlock& Block : Blocks)
+	{
+		BlockOffsets.Add(Offset);
+		Offset = AssetCsvSync_Align8(Offset + Block.Bytes.Num());
+	}
+	const int64 StringOffsetsOffset = Offset;
+	const int64 StringDataOffset = StringOffsetsOffset + (Strings.Num() + 1) * sizeof(uint64);
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!Writer)
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("SaveBinaryTable: Could not open %s for writing"), *FilePath);
+		return false;
+	}
+
+	auto Pad = [&Writer](int64 To)
+	{
+		uint8 Zero = 0;
+		while (Writer->Tell() < To)
+		{
+			Writer->Serialize(&Zero, 1);
+		}
+	};
+
+	uint32 Magic = AssetCsvSync_BinaryMagic;
+	uint32 Version = AssetCsvSync_BinaryVersion;
+	uint32 NumRows = Rows;
+	uint32 NumColumns = Columns.Num();
+	int32 KeyIndex = ColumnIndex.Contains(KeyColumn) ? ColumnIndex.FindChecked(KeyColumn) : INDEX_NONE;
+	uint32 NumStrings = Strings.Num();
+	int64 StringOffsets = StringOffsetsOffset;
+	int64 StringData = StringDataOffset;
+	*Writer << Magic << Version << NumRows << NumColumns << KeyIndex << NumStrings << StringOffsets << StringData;
+
+	for (int32 Index = 0; Index < Blocks.Num(); ++Index)
+	{
+		uint32 NameId = Blocks[Index].NameId;
+		uint8 Kind = static_cast<uint8>(Columns[Index].Kind);
+		uint8 Compression = static_cast<uint8>(Blocks[Index].Compression);
+		uint16 Reserved = 0;
+		int64 BlockOffset = BlockOffsets[Index];
+		int64 StoredSize = Blocks[Index].Bytes.Num();
+		int64 RawSize = Blocks[Index].RawSize;
+		*Writer << NameId << Kind << Compression << Reserved << BlockOffset << StoredSize << RawSize;
+	}
+
+	for (int32 Index = 0; Index < Blocks.Num(); ++Index)
+	{
+		Pad(BlockOffsets[Index]);
+		Writer->Serialize(const_cast<uint8*>(Blocks[Index].Bytes.GetData()), Blocks[Index].Bytes.Num());
+	}
+
+	Pad(StringOffsetsOffset);
+	uint64 StringOffset = 0;
+	for (const FString& String : Strings)
+	{
+		*Writer << StringOffset;
+		StringOffset += FPlatformString::ConvertedLength<UTF8CHAR>(*String, String.Len());
+	}
+	*Writer << StringOffset;
+	for (const FString& String : Strings)
+	{
+		FTCHARToUTF8 Utf8(*String, String.Len());
+		Writer->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+	}
+
+	return Writer->Close();
+}
+
+FAssetCsvSyncBinaryTable::~FAssetCsvSyncBinaryTable()
+{
+	// The region has to go before the file it maps.
+	MappedRegion.Reset();
+	MappedFile.Reset();
+}
+
+TSharedPtr<FAssetCsvSyncBinaryTable, ESPMode::ThreadSafe> FAssetCsvSyncBinaryTable::Open(const FString& FilePath, FAssetCsvSyncParallelFor ParallelFor)
+{
+	TSharedPtr<FAssetCsvSyncBinaryTable, ESPMode::ThreadSafe> Table = MakeShared<FAssetCsvSyncBinaryTable, ESPMode::ThreadSafe>();
+
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+	Table->MappedFile.Reset(PlatformFile.OpenMapped(*FilePath));
+#else
+	FOpenMappedResult Mapped = PlatformFile.OpenMappedEx(*FilePath);
+	if (Mapped.HasValue())
+	{
+		Table->MappedFile = Mapped.StealValue();
+	}
+#endif
+	if (Table->MappedFile && Table->MappedFile->GetFileSize() > 0)
+	{
+		Table->MappedRegion.Reset(Table->MappedFile->MapRegion(0, Table->MappedFile->GetFileSize()));
+	}
+	if (Table->MappedRegion)
+	{
+		Data = Table->MappedRegion->GetMappedPtr();
+		Size = Table->MappedRegion->GetMappedSize();
+	}
+	else
+	{
+		if (!FFileHelper::LoadFileToArray(Table->FileBytes, *FilePath))
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("OpenBinaryTable: Could not load file %s"), *FilePath);
+			return nullptr;
+		}
+		Data = Table->FileBytes.GetData();
+		Size = Table->FileBytes.Num();
+	}
+
+	auto Fail = [&FilePath](const TCHAR* Reason) -> TSharedPtr<FAssetCsvSyncBinaryTable, ESPMode::ThreadSafe>
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("OpenBinaryTable: %s is not a valid binary table (%s)"), *FilePath, Reason);
+		return nullptr;
+	};
+	auto Read = [Data](int64 Offset, auto& Out)
+	{
+		FMemory::Memcpy(&Out, Data + Offset, sizeof(Out));
+	};
+
+	if (Size < AssetCsvSync_BinaryHeaderSize)
+		return Fail(TEXT("truncated header"));
+
+	uint32 Magic = 0, Version = 0, NumRows = 0, NumColumns = 0, NumStrings = 0;
+	int32 KeyIndex = INDEX_NONE;
+	int64 StringOffsetsOffset = 0, StringDataOffset = 0;
+	Read(0, Magic);
+	Read(4, Version);
+	Read(8, NumRows);
+	Read(12, NumColumns);
+	Read(16, KeyIndex);
+	Read(20, NumStrings);
+	Read(24, StringOffsetsOffset);
+	Read(32, StringDataOffset);
+	if (Magic != AssetCsvSync_BinaryMagic)
+		return Fail(TEXT("bad magic"));
+	if (Version != AssetCsvSync_BinaryVersion)
+		return Fail(TEXT("unsupported version"));
+	if (NumRows > MAX_int32 || NumColumns > MAX_int32 || NumStrings > MAX_int32 || KeyIndex >= static_cast<int32>(NumColumns))
+		return Fail(TEXT("bad counts"));
+	if (AssetCsvSync_BinaryHeaderSize + int64(NumColumns) * AssetCsvSync_BinaryColumnEntrySize > Size
+		|| StringOffsetsOffset < 0 || StringDataOffset != StringOffsetsOffset + (int64(NumStrings) + 1) * int64(sizeof(uint64)) || StringDataOffset > Size)
+		return Fail(TEXT("truncated tables"));
+
+	// String pool: offsets must be ascending and end inside the file.
+	const int64 StringDataSize = Size - StringDataOffset;
+	TArray<uint64> StringOffsets;
+	StringOffsets.SetNumUninitialized(NumStrings + 1);
+	FMemory::Memcpy(StringOffsets.GetData(), Data + StringOffsetsOffset, StringOffsets.Num() * sizeof(uint64));
+	for (uint32 Index = 0; Index < NumStrings; ++Index)
+	{
+		if (StringOffsets[Index] > StringOffsets[Index + 1])
+			return Fail(TEXT("bad string offsets"));
+	}
+	if (StringOffsets.Last() > uint64(StringDataSize))
+		return Fail(TEXT("bad string offsets"));
+
+	Table->Rows = NumRows;
+	Table->KeyColumn = KeyIndex;
+	Table->Strings.SetNum(NumStrings);
+	const ANSICHAR* StringData = reinterpret_cast<const ANSICHAR*>(Data + StringDataOffset);
+	ParallelFor(NumStrings, [&Table, &StringOffsets, StringData](int32 Index)
+	{
+		const FUTF8ToTCHAR Converted(StringData + StringOffsets[Index], static_cast<int32>(StringOffsets[Index + 1] - StringOffsets[Index]));
+		Table->Strings[Index] = FString(Converted.Length(), Converted.Get());
+	});
+
+	struct FEntry
+	{
+		uint32 NameId = 0;
+		uint8 Kind = 0;
+		uint8 Compression = 0;
+		int64 Offset = 0;
+		int64 StoredSize = 0;
+		int64 RawSize = 0;
+	};
+	TArray<FEntry> Entries;
+	Entries.SetNum(NumColumns);
+	Table->Columns.SetNum(NumColumns);
+	for (uint32 Index = 0; Index < NumColumns; ++Index)
+	{
+		const int64 EntryOffset = AssetCsvSync_BinaryHeaderSize + Index * AssetCsvSync_BinaryColumnEntrySize;
+		FEntry& Entry = Entries[Index];
+		Read(EntryOffset, Entry.NameId);
+		Read(EntryOffset + 4, Entry.Kind);
+		Read(EntryOffset + 5, Entry.Compression);
+		Read(EntryOffset + 8, Entry.Offset);
+		Read(EntryOffset + 16, Entry.StoredSize);
+		Read(EntryOffset + 24, Entry.RawSize);
+
+		if (Entry.NameId >= NumStrings || Entry.Kind > static_cast<uint8>(EAssetCsvSyncBinaryKind::Text) || Entry.Compression > static_cast<uint8>(EAssetCsvSyncBinaryCompression::Zlib))
+			return Fail(TEXT("bad column entry"));
+		const EAssetCsvSyncBinaryKind Kind = static_cast<EAssetCsvSyncBinaryKind>(Entry.Kind);
+		if (Entry.Offset < 0 || Entry.StoredSize < 0 || Entry.Offset + Entry.StoredSize > Size
+			|| Entry.RawSize != AssetCsvSync_Align8(NumRows) + int64(NumRows) * AssetCsvSync_BinaryValueSize(Kind)
+			|| (Entry.Compression == 0 && Entry.StoredSize != Entry.RawSize))
+			return Fail(TEXT("bad column block"));
+
+		FColumn& Column = Table->Columns[Index];
+		Column.Name = Table->Strings[Entry.NameId];
+		Column.Kind = Kind;
+		Table->ColumnIndex.Add(Column.Name, Index);
+	}
+
+	// Compressed columns are inflated in parallel; the others point into the mapping.
+	TArray<bool> Inflated;
+	Inflated.Init(true, NumColumns);
+	ParallelFor(NumColumns, [&Table, &Entries, &Inflated, Data](int32 Index)
+	{
+		const FEntry& Entry = Entries[Index];
+		FColumn& Column = Table->Columns[Index];
+		const uint8* Block = Data + Entry.Offset;
+		if (Entry.Compression == static_cast<uint8>(EAssetCsvSyncBinaryCompression::Zlib))
+		{
+			Column.Inflated.SetNumUninitialized(Entry.RawSize);
+			Inflated[Index] = Entry.RawSize <= MAX_int32 && Entry.StoredSize <= MAX_int32
+				&& FCompression::UncompressMemory(NAME_Zlib, Column.Inflated.GetData(), static_cast<int32>(Entry.RawSize), Block, static_cast<int32>(Entry.StoredSize));
+			Block = Column.Inflated.GetData();
+		}
+		Column.Present = Block;
+		Column.Values = Block + AssetCsvSync_Align8(Table->Rows);
+	});
+	if (Inflated.Contains(false))
+		return Fail(TEXT("corrupt compressed column"));
+
+	// String ids are checked once here, so cells can be read without bounds checks.
+	TArray<bool> IdsValid;
+	IdsValid.Init(true, NumColumns);
+	ParallelFor(NumColumns, [&Table, &IdsValid, NumStrings](int32 Index)
+	{
+		const FColumn& Column = Table->Columns[Index];
+		if (Column.Kind != EAssetCsvSyncBinaryKind::String && Column.Kind != EAssetCsvSyncBinaryKind::Text)
+			return;
+		for (int32 Row = 0; Row < Table->Rows; ++Row)
+		{
+			uint32 Id = 0;
+			FMemory::Memcpy(&Id, Column.Values + Row * sizeof(uint32), sizeof(uint32));
+			if (Column.Present[Row] && Id >= NumStrings)
+			{
+				IdsValid[Index] = false;
+				return;
+			}
+		}
+	});
+	if (IdsValid.Contains(false))
+		return Fail(TEXT("bad string id"));
+
+	return Table;
+}
+
+int32 FAssetCsvSyncBinaryTable::FindColumn(const FString& Name) const
+{
+	const int32* Found = ColumnIndex.Find(Name);
+	return Found ? *Found : INDEX_NONE;
+}
+
+FString FAssetCsvSyncBinaryTable::GetText(int32 ColumnIndexValue, int32 Row) const
+{
+	const FColumn& Column = Columns[ColumnIndexValue];
+	if (!Column.Present[Row])
+		return FString();
+
+	int64 Int = 0;
+	double Double = 0.0;
+	uint32 Id = 0;
+	switch (Column.Kind)
+	{
+	case EAssetCsvSyncBinaryKind::Int64:
+		FMemory::Memcpy(&Int, Column.Values + Row * sizeof(int64), sizeof(int64));
+		return LexToString(Int);
+	case EAssetCsvSyncBinaryKind::Double:
+		FMemory::Memcpy(&Double, Column.Values + Row * sizeof(double), sizeof(double));
+		return AssetCsvSync_FormatDecimal(Double);
+	case EAssetCsvSyncBinaryKind::Bool:
+		return Column.Values[Row] ? TEXT("true") : TEXT("false");
+	default:
+		FMemory::Memcpy(&Id, Column.Values + Row * sizeof(uint32), sizeof(uint32));
+		return Strings[Id];
+	}
+}
+
+bool FAssetCsvSyncBinaryTable::ReadCell(const FString& ColumnName, int32 Row, FProperty* Property, uint8* PropertyData, FStringToLeaf StringToLeaf) const
+{
+	const int32 Index = FindColumn(ColumnName);
+	if (Index == INDEX_NONE || !Columns[Index].Present[Row])
+		return false;
+
+	const FColumn& Column = Columns[Index];
+	FNumericProperty* NumericProp = CastField<FNumericProperty>(Property);
+	if (NumericProp && NumericProp->IsEnum())
+	{
+		NumericProp = nullptr;
+	}
+
+	switch (Column.Kind)
+	{
+	case EAssetCsvSyncBinaryKind::Int64:
+	{
+		int64 Value = 0;
+		FMemory::Memcpy(&Value, Column.Values + Row * sizeof(int64), sizeof(int64));
+		if (NumericProp && NumericProp->IsInteger())
+		{
+			NumericProp->SetIntPropertyValue(PropertyData, Value);
+			return true;
+		}
+		if (NumericProp)
+		{
+			NumericProp->SetFloatingPointPropertyValue(PropertyData, static_cast<double>(Value));
+			return true;
+		}
+		break;
+	}
+	case EAssetCsvSyncBinaryKind::Double:
+	{
+		double Value = 0.0;
+		FMemory::Memcpy(&Value, Column.Values + Row * sizeof(double), sizeof(double));
+		if (NumericProp && NumericProp->IsFloatingPoint())
+		{
+			NumericProp->SetFloatingPointPropertyValue(PropertyData, Value);
+			return true;
+		}
+		break;
+	}
+	case EAssetCsvSyncBinaryKind::Bool:
+		if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+		{
+			BoolProp->SetPropertyValue(PropertyData, Column.Values[Row] != 0);
+			return true;
+		}
+		break;
+	case EAssetCsvSyncBinaryKind::String:
+	{
+		uint32 Id = 0;
+		FMemory::Memcpy(&Id, Column.Values + Row * sizeof(uint32), sizeof(uint32));
+		if (FNameProperty* NameProp = CastField<FNameProperty>(Property))
+		{
+			NameProp->SetPropertyValue(PropertyData, FName(*Strings[Id]));
+			return true;
+		}
+		if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
+		{
+			StrProp->SetPropertyValue(PropertyData, Strings[Id]);
+			return true;
+		}
+		return StringToLeaf(Property, PropertyData, Strings[Id]);
+	}
+	default:
+	{
+		uint32 Id = 0;
+		FMemory::Memcpy(&Id, Column.Values + Row * sizeof(uint32), sizeof(uint32));
+		return StringToLeaf(Property, PropertyData, Strings[Id]);
+	}
+	}
+
+	// The property's type changed since the export; go through the text like a CSV cell would.
+	return StringToLeaf(Property, PropertyData, GetText(Index, Row));
+}
@@ -0,0 +1,126 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UnrealType.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// Binary columnar tables (.acsb): the same columns and rows as a table CSV, stored one column after another.
+// Numbers and booleans are kept as typed values and names/strings as ids into a shared string pool, so import
+// sets them on the property directly instead of formatting and parsing text. Other leaves (structs, object
+// paths, containers) keep their CSV cell text, pooled as well. Each column block can be zlib compressed.
+//
+// Layout (little endian, blocks 8-byte aligned so an uncompressed file can be used straight from a mapping):
+//   header    Magic, Version, NumRows, NumColumns, KeyColumn, NumStrings, string offsets offset, string data offset
+//   columns   NumColumns x { NameId, Kind, Compression, Reserved, Offset, StoredSize, RawSize }
+//   blocks    per column: NumRows presence bytes (padded to 8), then NumRows fixed-size values
+//   strings   (NumStrings + 1) uint64 offsets into the UTF-8 string data
+enum class EAssetCsvSyncBinaryKind : uint8
+{
+	Int64,
+	Double,
+	Bool,
+	// FName and FString values, set directly.
+	String,
+	// CSV cell text, parsed like a CSV cell.
+	Text,
+};
+
+using FAssetCsvSyncParallelFor = TFunctionRef<void(int32, TFunctionRef<void(int32)>)>;
+
+// One cell on its way into a typed table writer (binary or database). Int holds Int64 and Bool values,
+// String holds names, strings and CSV cell text.
+struct FAssetCsvSyncTypedCell
+{
+	EAssetCsvSyncBinaryKind Kind = EAssetCsvSyncBinaryKind::Text;
+	int64 Int = 0;
+	double Double = 0.0;
+	FString String;
+
+	// Reads a value of a typed kind; the property's kind must not be Text.
+	static FAssetCsvSyncTypedCell FromProperty(const FProperty* Property, const void* PropertyData);
+	static FAssetCsvSyncTypedCell FromString(EAssetCsvSyncBinaryKind Kind, const FString& Value);
+};
+
+class FAssetCsvSyncBinaryTableWriter
+{
+public:
+	static bool IsBinaryTableFile(const FString& FilePath);
+
+	// How a leaf property's values are stored.
+	static EAssetCsvSyncBinaryKind GetKind(const FProperty* Property);
+
+	int32 AddRow();
+	int32 NumRows() const { return Rows; }
+
+	void SetCell(int32 Row, const FString& Column, FAssetCsvSyncTypedCell&& Cell);
+
+	bool Save(const FString& FilePath, const FString& KeyColumn, bool bCompress, FAssetCsvSyncParallelFor ParallelFor);
+
+private:
+	struct FColumn
+	{
+		FString Name;
+		EAssetCsvSyncBinaryKind Kind = EAssetCsvSyncBinaryKind::Text;
+		TArray<uint8> Present;
+		TArray64<uint8> Values;
+	};
+
+	// A column that receives values of another kind falls back to text for all of its cells.
+	void Demote(FColumn& Column);
+	uint32 AddString(const FString& Value);
+
+	TArray<FColumn> Columns;
+	TMap<FString, int32> ColumnIndex;
+	TArray<FString> Strings;
+	TMap<FString, uint32> StringIds;
+	int32 Rows = 0;
+};
+
+// A binary table opened for import. The file is memory mapped (or read when mapping is not available);
+// uncompressed columns are read in place, compressed ones are inflated once when the table is opened.
+// Read-only after Open, so cells can be read from any thread.
+class FAssetCsvSyncBinaryTable
+{
+public:
+	using FStringToLeaf = TFunctionRef<bool(FProperty*, uint8*, const FString&)>;
+
+	static TSharedPtr<FAssetCsvSyncBinaryTable, ESPMode::ThreadSafe> Open(const FString& FilePath, FAssetCsvSyncParallelFor ParallelFor);
+	~FAssetCsvSyncBinaryTable();
+
+	int32 NumRows() const { return Rows; }
+	int32 NumColumns() const { return Columns.Num(); }
+	int32 GetKeyColumn() const { return KeyColumn; }
+	const FString& GetColumnName(int32 Column) const { return Columns[Column].Name; }
+	int32 FindColumn(const FString& Name) const;
+
+	bool IsSet(int32 Column, int32 Row) const { return Columns[Column].Present[Row] != 0; }
+	FString GetText(int32 Column, int32 Row) const;
+
+	// Sets the property from the cell. Typed cells are written straight into matching numeric, bool, name and
+	// string properties; anything else goes through StringToLeaf with the cell's text.
+	bool ReadCell(const FString& Column, int32 Row, FProperty* Property, uint8* PropertyData, FStringToLeaf StringToLeaf) const;
+
+private:
+	struct FColumn
+	{
+		FString Name;
+		EAssetCsvSyncBinaryKind Kind = EAssetCsvSyncBinaryKind::Text;
+		const uint8* Present = nullptr;
+		const uint8* Values = nullptr;
+		TArray64<uint8> Inflated;
+	};
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray64<uint8> FileBytes;
+
+	TArray<FColumn> Columns;
+	TMap<FString, int32> ColumnIndex;
+	TArray<FString> Strings;
+	int32 Rows = 0;
+	int32 KeyColumn = INDEX_NONE;
+};
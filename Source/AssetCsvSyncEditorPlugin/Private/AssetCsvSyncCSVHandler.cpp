@@ -3,6 +3,14 @@
 #include "AssetCsvSyncCSVHandler.h"
 
 #include "AssetCsvSyncLog.h"
+#include "AssetCsvSyncBinaryTable.h"
+#include "AssetCsvSyncCoreAdapter.h"
+#include "AssetCsvSyncSqliteTable.h"
+#include "AssetCsvSyncSchemaSidecar.h"
+#include "AssetCsvSyncClassIndex.h"
+#include "AssetCsvSyncJobs.h"
+#include "AssetCsvSyncJsonLines.h"
+#include "AssetCsvSyncSourceStamp.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Misc/Paths.h"
@@ -11,14 +19,27 @@
 #include "UObject/UObjectGlobals.h"
 #include "UObject/Package.h"
 #include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Engine/StreamableManager.h"
+#include "UObject/GarbageCollection.h"
+#include "Async/ParallelFor.h"
 #include "Misc/PackageName.h"
+#include "Misc/ScopeExit.h"
 #include "UObject/SoftObjectPath.h"
 #include "UObject/SavePackage.h"
+#include "FileHelpers.h"
+#include "ISourceControlModule.h"
+#include "Misc/ScopedSlowTask.h"
 
 #include "AssetCsvSyncEditorPluginSettings.h"
 
 #include "UObject/PropertyPortFlags.h"
 #include "ScopedTransaction.h"
+#include "Editor.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "Misc/Change.h"
+#include "Misc/ITransaction.h"
 
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
@@ -102,12 +123,396 @@ static FString AssetCsvSync_ExportTextAlways(FProperty* Property, const void* Va
 	return Out;
 }
 
+// Owns an initialized, correctly aligned value of a property.
+// Used to parse into a copy first so the live value is only written when it actually changes.
+struct FAssetCsvSyncScratchValue
+{
+	explicit FAssetCsvSyncScratchValue(FProperty* InProperty, const void* CopyFrom = nullptr)
+		: Property(InProperty)
+	{
+		Data = static_cast<uint8*>(FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment()));
+		Property->InitializeValue(Data);
+		if (CopyFrom)
+		{
+			Property->CopySingleValue(Data, CopyFrom);
+		}
+	}
+
+	~FAssetCsvSyncScratchValue()
+	{
+		Property->DestroyValue(Data);
+		FMemory::Free(Data);
+	}
+
+	UE_NONCOPYABLE(FAssetCsvSyncScratchValue);
+
+	FProperty* Property = nullptr;
+	uint8* Data = nullptr;
+};
+
+// Column selection compiled for the export/import walks.
+// Besides the exact column names it holds every "..._" prefix of them, so a walk can tell
+// before formatting a value or resolving an object whether anything below a prefix is selected.
+// A default-constructed filter selects everything.
+struct FAssetCsvSyncColumnFilter
+{
+	FAssetCsvSyncColumnFilter() = default;
+
+	// Export treats an empty column list as "all columns"; import passes bEmptySelectsAll=false
+	// because an empty incoming header set reaches nothing.
+	explicit FAssetCsvSyncColumnFilter(const TArray<FString>& InColumns, bool bEmptySelectsAll = true)
+		: bSelectAll(bEmptySelectsAll && InColumns.Num() == 0)
+	{
+		Columns.Reserve(InColumns.Num());
+		for (const FString& Column : InColumns)
+		{
+			Columns.Add(Column);
+			for (int32 Index = 0; Index < Column.Len(); ++Index)
+			{
+				if (Column[Index] == TEXT('_'))
+				{
+					Prefixes.Add(Column.Left(Index + 1));
+				}
+			}
+		}
+	}
+
+	bool WantsColumn(const FString& ColumnName) const
+	{
+		return bSelectAll || Columns.Contains(ColumnName);
+	}
+
+	// Prefix is a full expansion prefix ending with "_" (e.g. "Stats_" or "Items_0_").
+	bool WantsPrefix(const FString& Prefix) const
+	{
+		return bSelectAll || Prefixes.Contains(Prefix);
+	}
+
+	bool bSelectAll = true;
+	TSet<FString> Columns;
+	TSet<FString> Prefixes;
+};
+
+// Undo record for one top-level property of an object.
+// Apply and Revert both swap the stored value with the live one, which is all linear undo/redo needs,
+// and keeps the transaction buffer proportional to what the import changed instead of the whole object.
+class FAssetCsvSyncPropertyChange : public FCommandChange
+{
+public:
+	FAssetCsvSyncPropertyChange(FProperty* InProperty, const void* OldValue)
+		: Property(InProperty)
+		, Stored(InProperty, OldValue)
+	{
+	}
+
+	virtual void Apply(UObject* Object) override
+	{
+		SwapWithLive(Object);
+	}
+
+	virtual void Revert(UObject* Object) override
+	{
+		SwapWithLive(Object);
+	}
+
+	virtual FString ToString() const override
+	{
+		return FString::Printf(TEXT("AssetCsvSync import: %s"), *Property->GetName());
+	}
+
+private:
+	void SwapWithLive(UObject* Object)
+	{
+		if (!Object)
+			return;
+		void* LiveValue = Property->ContainerPtrToValuePtr<void>(Object);
+		FAssetCsvSyncScratchValue Current(Property, LiveValue);
+		Property->CopySingleValue(LiveValue, Stored.Data);
+		Property->CopySingleValue(Stored.Data, Current.Data);
+
+		FPropertyChangedEvent ChangedEvent(Property, EPropertyChangeType::ValueSet);
+		Object->PostEditChangeProperty(ChangedEvent);
+	}
+
+	FProperty* Property = nullptr;
+	FAssetCsvSyncScratchValue Stored;
+};
+
+// Cells of one table row parsed ahead of time, keyed by column.
+// A staged value is only used when the walk reaches its column with the same property it was parsed for.
+struct FAssetCsvSyncStagedRow
+{
+	const FAssetCsvSyncScratchValue* Find(const FString& Column, const FProperty* Property) const
+	{
+		const TUniquePtr<FAssetCsvSyncScratchValue>* Value = Values.Find(Column);
+		return Value && (*Value)->Property == Property ? Value->Get() : nullptr;
+	}
+
+	// Column -> leaf property learned while applying rows of one class; drives pre-parsing of later rows.
+	TMap<FString, FProperty*>* LearnedColumns = nullptr;
+	TMap<FString, TUniquePtr<FAssetCsvSyncScratchValue>> Values;
+	// JSON Lines cells hold JSON values instead of CSV text; binary cells are read from BinaryTable by column.
+	EAssetCsvSyncTableFormat Format = EAssetCsvSyncTableFormat::Csv;
+	const FAssetCsvSyncBinaryTable* BinaryTable = nullptr;
+	int32 BinaryRow = INDEX_NONE;
+	// Columns the schema sidecar let the import parse up front, and this row's index into them.
+	const TMap<FString, FAssetCsvSyncTypedColumn>* TypedColumns = nullptr;
+	int32 TypedRow = INDEX_NONE;
+};
+
+// Types whose StringToProperty path neither loads nor resolves objects and fully overwrites the value,
+// so they can be parsed on a worker into a default-initialized value.
+static bool AssetCsvSync_CanParseOffGameThread(const FProperty* Property)
+{
+	if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+		return AssetCsvSync_CanParseOffGameThread(ArrayProp->Inner);
+	if (const FSetProperty* SetProp = CastField<FSetProperty>(Property))
+		return AssetCsvSync_CanParseOffGameThread(SetProp->ElementProp);
+	if (const FMapProperty* MapProp = CastField<FMapProperty>(Property))
+		return AssetCsvSync_CanParseOffGameThread(MapProp->KeyProp) && AssetCsvSync_CanParseOffGameThread(MapProp->ValueProp);
+
+	return Property->IsA<FNumericProperty>()
+		|| Property->IsA<FBoolProperty>()
+		|| Property->IsA<FEnumProperty>()
+		|| Property->IsA<FStrProperty>()
+		|| Property->IsA<FNameProperty>()
+		|| Property->IsA<FTextProperty>()
+		|| Property->IsA<FSoftObjectProperty>();
+}
+
+// State shared by one import walk (root object plus everything reached through CsvExpand).
+struct FAssetCsvSyncImportContext
+{
+	explicit FAssetCsvSyncImportContext(const TMap<FString, FString>& ColumnToValue)
+	{
+		TArray<FString> IncomingColumns;
+		ColumnToValue.GetKeys(IncomingColumns);
+		Reachable = FAssetCsvSyncColumnFilter(IncomingColumns, false);
+	}
+
+	// Expansion prefixes that have at least one incoming column; everything else is not traversed.
+	FAssetCsvSyncColumnFilter Reachable;
+
+	TSet<const UObject*> Visited;
+
+	// Objects that had at least one property written, in the order they were first changed.
+	TArray<UObject*> ChangedObjects;
+
+	// Object that owns the properties currently being written.
+	UObject* CurrentObject = nullptr;
+
+	// Top-level property of CurrentObject that contains the value being written.
+	FProperty* CurrentRootProperty = nullptr;
+
+	// > 0 while writing into a scratch copy of a container; changes are accounted for when the copy is committed.
+	int32 ScratchDepth = 0;
+
+	// Store a property-level undo record for every changed top-level property (only while a transaction is open).
+	bool bRecordUndo = true;
+	TSet<TPair<const UObject*, const FProperty*>> RecordedProperties;
+
+	int32 ChangedColumns = 0;
+
+	// Pre-parsed cells of the row being applied (table import only).
+	FAssetCsvSyncStagedRow* Staging = nullptr;
+
+	// Must be called before CurrentRootProperty of CurrentObject is written.
+	void MarkChanged()
+	{
+		if (ScratchDepth > 0 || !CurrentObject)
+			return;
+
+		if (bRecordUndo && GUndo && CurrentRootProperty)
+		{
+			bool bAlreadyRecorded = false;
+			RecordedProperties.Add(TPair<const UObject*, const FProperty*>(CurrentObject, CurrentRootProperty), &bAlreadyRecorded);
+			if (!bAlreadyRecorded)
+			{
+				const void* OldValue = CurrentRootProperty->ContainerPtrToValuePtr<void>(CurrentObject);
+				GUndo->StoreUndo(CurrentObject, MakeUnique<FAssetCsvSyncPropertyChange>(CurrentRootProperty, OldValue));
+			}
+		}
+		ChangedObjects.AddUnique(CurrentObject);
+	}
+
+	// Counts a change that no cell write accounts for; scratch copies are counted when they are committed.
+	void CountChangedColumn()
+	{
+		if (ScratchDepth == 0 && CurrentObject)
+		{
+			++ChangedColumns;
+		}
+	}
+
+	// MarkChanged for a container of expanded structs or objects that grows by a resize or a new map key. The
+	// growth counts as a changed column, since the cells written into the new elements may all equal their defaults.
+	void MarkContainerGrown()
+	{
+		MarkChanged();
+		CountChangedColumn();
+	}
+};
+
+static TMap<FString, FString> AssetCsvSync_ZipColumns(const TArray<FString>& Headers, const TArray<FString>& Values, const TArray<FString>& ColumnsToImport)
+{
+	TSet<FString> Allowed;
+	Allowed.Reserve(ColumnsToImport.Num());
+	for (const FString& Col : ColumnsToImport)
+	{
+		Allowed.Add(Col);
+	}
+
+	TMap<FString, FString> ColumnToValue;
+	ColumnToValue.Reserve(Headers.Num());
+	for (int32 i = 0; i < Headers.Num() && i < Values.Num(); ++i)
+	{
+		if (Allowed.Num() == 0 || Allowed.Contains(Headers[i]))
+		{
+			ColumnToValue.Add(Headers[i], Values[i]);
+		}
+	}
+	return ColumnToValue;
+}
+
+// Receives the columns produced by the export walks.
+// With bDeferFormatting the walk only copies each leaf value into Staged; the text is produced later by
+// FormatStagedValues, which does not touch the source objects and can therefore run off the game thread.
+struct FAssetCsvSyncExportSink
+{
+	struct FStagedValue
+	{
+		FString Column;
+		TUniquePtr<FAssetCsvSyncScratchValue> Value;
+	};
+
+	void AddColumn(const FString& Name, const FString& Value)
+	{
+		if (!ColumnToValue.Contains(Name))
+		{
+			ColumnOrder.Add(Name);
+		}
+		ColumnToValue.Add(Name, Value);
+	}
+
+	bool bDeferFormatting = false;
+	TMap<FString, FString> ColumnToValue;
+	TArray<FString> ColumnOrder;
+	TArray<FStagedValue> Staged;
+};
+
+// ParallelFor capped at MaxWorkerThreads (0 = all workers, 1 = run inline on the calling thread).
+static void AssetCsvSync_ParallelFor(int32 Num, TFunctionRef<void(int32)> Body)
+{
+	const int32 MaxThreads = UAssetCsvSyncEditorPluginSettings::Get()->MaxWorkerThreads;
+	if (MaxThreads == 1 || Num <= 1)
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Body(Index);
+		}
+		return;
+	}
+	if (MaxThreads <= 0)
+	{
+		ParallelFor(Num, Body);
+		return;
+	}
+
+	// One task per contiguous chunk keeps at most MaxThreads tasks in flight.
+	const int32 NumChunks = FMath::Min(Num, MaxThreads);
+	ParallelFor(NumChunks, [Num, NumChunks, &Body](int32 Chunk)
+	{
+		const int32 Begin = static_cast<int32>(static_cast<int64>(Num) * Chunk / NumChunks);
+		const int32 End = static_cast<int32>(static_cast<int64>(Num) * (Chunk + 1) / NumChunks);
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			Body(Index);
+		}
+	});
+}
+
+// Multi-row CSV being assembled by the table exports.
+// The header only ever grows at the end, so rows are kept as finished CSV text and rows written
+// before a new column appeared are padded with empty cells when the file is written.
+struct FAssetCsvSyncTableWriter
+{
+	explicit FAssetCsvSyncTableWriter(const FString& KeyColumn)
+	{
+		Header.Add(KeyColumn);
+		HeaderSet.Add(KeyColumn);
+	}
+
+	TArray<FString> Header;
+	TSet<FString> HeaderSet;
+	TArray<FString> RowText;
+	TArray<int32> RowCellCount;
+	// Set from the file extension. JSON Lines rows are JSON objects (one per line) instead of CSV records.
+	EAssetCsvSyncTableFormat Format = EAssetCsvSyncTableFormat::Csv;
+	// Binary and database rows are stored here instead of RowText.
+	TSharedPtr<FAssetCsvSyncBinaryTableWriter> Binary;
+	TSharedPtr<FAssetCsvSyncSqliteWriter> Sqlite;
+	// Column converters and class fingerprints for the schema sidecar of a CSV table.
+	FAssetCsvSyncSchemaSidecar Schema;
+	bool bWriteSchema = false;
+
+	void SetFormat(EAssetCsvSyncTableFormat InFormat)
+	{
+		Format = InFormat;
+		bWriteSchema = Format == EAssetCsvSyncTableFormat::Csv && UAssetCsvSyncEditorPluginSettings::Get()->bWriteSchemaSidecar;
+		Binary = Format == EAssetCsvSyncTableFormat::Binary ? MakeShared<FAssetCsvSyncBinaryTableWriter>() : nullptr;
+		Sqlite = Format == EAssetCsvSyncTableFormat::Sqlite ? MakeShared<FAssetCsvSyncSqliteWriter>() : nullptr;
+	}
+
+	int32 NumRows() const
+	{
+		return Binary ? Binary->NumRows() : Sqlite ? Sqlite->NumRows() : RowText.Num();
+	}
+};
+
+// Binary and database writers take typed values straight from staging; only text-kind values were formatted.
+template <typename TypedWriterType>
+static void AssetCsvSync_AppendTypedRow(TypedWriterType& TypedWriter, int32 Row, const FAssetCsvSyncExportSink& Sink, const FString& KeyColumn, const FAssetCsvSyncColumnFilter& Filter)
+{
+	TypedWriter.SetCell(Row, KeyColumn, FAssetCsvSyncTypedCell::FromString(EAssetCsvSyncBinaryKind::String, Sink.ColumnToValue.FindChecked(KeyColumn)));
+	for (const FAssetCsvSyncExportSink::FStagedValue& Staged : Sink.Staged)
+	{
+		if (!Filter.WantsColumn(Staged.Column))
+			continue;
+		if (FAssetCsvSyncBinaryTableWriter::GetKind(Staged.Value->Property) == EAssetCsvSyncBinaryKind::Text)
+		{
+			TypedWriter.SetCell(Row, Staged.Column, FAssetCsvSyncTypedCell::FromString(EAssetCsvSyncBinaryKind::Text, Sink.ColumnToValue.FindChecked(Staged.Column)));
+		}
+		else
+		{
+			TypedWriter.SetCell(Row, Staged.Column, FAssetCsvSyncTypedCell::FromProperty(Staged.Value->Property, Staged.Value->Data));
+		}
+	}
+}
+
+// Table files are CSV unless their extension says otherwise.
+static EAssetCsvSyncTableFormat AssetCsvSync_GetTableFormat(const FString& FilePath)
+{
+	if (FAssetCsvSyncJsonLines::IsJsonLinesFile(FilePath))
+		return EAssetCsvSyncTableFormat::JsonLines;
+	if (FAssetCsvSyncBinaryTableWriter::IsBinaryTableFile(FilePath))
+		return EAssetCsvSyncTableFormat::Binary;
+	if (FAssetCsvSyncSqliteWriter::IsSqliteFile(FilePath))
+		return EAssetCsvSyncTableFormat::Sqlite;
+	return EAssetCsvSyncTableFormat::Csv;
+}
+
 bool UAssetCsvSyncCSVHandler::ExportDataAssetToCSV(UDataAsset* DataAsset, const FString& FilePath)
 {
 	return ExportDataAssetToCSV_Columns(DataAsset, FilePath, TArray<FString>());
 }
 
 bool UAssetCsvSyncCSVHandler::ExportDataAssetToCSV_Columns(UDataAsset* DataAsset, const FString& FilePath, const TArray<FString>& ColumnsToExport)
+{
+	FString CSVContent;
+	return BuildDataAssetCSV(DataAsset, ColumnsToExport, CSVContent) && FFileHelper::SaveStringToFile(CSVContent, *FilePath);
+}
+
+bool UAssetCsvSyncCSVHandler::BuildDataAssetCSV(UDataAsset* DataAsset, const TArray<FString>& ColumnsToExport, FString& OutContent)
 {
 	if (!DataAsset)
 	{
@@ -122,20 +527,12 @@ bool UAssetCsvSyncCSVHandler::ExportDataAssetToCSV_Columns(UDataAsset* DataAsset
 		return false;
 	}
 
-	TMap<FString, FString> ColumnToValue;
-	TArray<FString> ColumnOrder;
+	FAssetCsvSyncExportSink Sink;
 	TSet<const UObject*> Visited;
-	ExportObjectToColumns(DataAsset, Class, ColumnToValue, ColumnOrder, FString(), Visited);
-
-	TSet<FString> Allowed;
-	if (ColumnsToExport.Num() > 0)
-	{
-		Allowed.Reserve(ColumnsToExport.Num());
-		for (const FString& Col : ColumnsToExport)
-		{
-			Allowed.Add(Col);
-		}
-	}
+	const FAssetCsvSyncColumnFilter Filter(ColumnsToExport);
+	ExportObjectToColumns(DataAsset, Class, Sink, FString(), Filter, Visited);
+	const TMap<FString, FString>& ColumnToValue = Sink.ColumnToValue;
+	const TArray<FString>& ColumnOrder = Sink.ColumnOrder;
 
 	if (ColumnOrder.IsEmpty())
 	{
@@ -143,12 +540,14 @@ bool UAssetCsvSyncCSVHandler::ExportDataAssetToCSV_Columns(UDataAsset* DataAsset
 		return false;
 	}
 
-	FString CSVContent;
+	FString& CSVContent = OutContent;
+	CSVContent.Reset();
 	TArray<FString> FilteredOrder;
 	FilteredOrder.Reserve(ColumnOrder.Num());
 	for (const FString& ColName : ColumnOrder)
 	{
-		if (Allowed.Num() == 0 || Allowed.Contains(ColName))
+		// Columns of unresolved references are still listed unfiltered (class defaults), so filter the order too.
+		if (Filter.WantsColumn(ColName))
 		{
 			FilteredOrder.Add(ColName);
 		}
@@ -167,288 +566,2231 @@ bool UAssetCsvSyncCSVHandler::ExportDataAssetToCSV_Columns(UDataAsset* DataAsset
 	}
 	CSVContent.RemoveFromEnd(TEXT(","));
 	CSVContent += TEXT("\n");
-
-	return FFileHelper::SaveStringToFile(CSVContent, *FilePath);
+	return true;
 }
 
-bool UAssetCsvSyncCSVHandler::GetCSVHeaderColumns(const FString& FilePath, TArray<FString>& OutColumns)
+TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> UAssetCsvSyncCSVHandler::MakeExportJob(UDataAsset* DataAsset, const FString& FilePath, const TArray<FString>& ColumnsToExport, TFunction<void(EAssetCsvSyncJobResult)> OnComplete)
 {
-	OutColumns.Reset();
-	FString CSVContent;
-	if (!FFileHelper::LoadFileToString(CSVContent, *FilePath))
+	TSharedRef<FString, ESPMode::ThreadSafe> CSVContent = MakeShared<FString, ESPMode::ThreadSafe>();
+	TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> Job = MakeShared<FAssetCsvSyncJob, ESPMode::ThreadSafe>(FText::FromString(FString::Printf(TEXT("Export %s"), *FPaths::GetCleanFilename(FilePath))));
+
+	Job->AddGameThreadStage([CSVContent, WeakAsset = TWeakObjectPtr<UDataAsset>(DataAsset), ColumnsToExport](FAssetCsvSyncJob&)
 	{
-		return false;
-	}
-	TArray<FString> Lines;
-	CSVContent.ParseIntoArrayLines(Lines, false);
-	if (Lines.Num() < 1)
+		return BuildDataAssetCSV(WeakAsset.Get(), ColumnsToExport, *CSVContent) ? EAssetCsvSyncStepResult::Done : EAssetCsvSyncStepResult::Failed;
+	})
+	.AddBackgroundStage([CSVContent, FilePath](FAssetCsvSyncJob&)
 	{
-		return false;
-	}
-	OutColumns = ParseCSVLine(Lines[0]);
-	return OutColumns.Num() > 0;
+		return FFileHelper::SaveStringToFile(*CSVContent, *FilePath);
+	})
+	.OnFinished([OnComplete](EAssetCsvSyncJobResult JobResult)
+	{
+		if (OnComplete)
+		{
+			OnComplete(JobResult);
+		}
+	});
+	return Job;
 }
 
-bool UAssetCsvSyncCSVHandler::ImportCSVToDataAssetInPlace(const FString& FilePath, UDataAsset* DataAsset, const TArray<FString>& ColumnsToImport, bool bSavePackage)
+bool UAssetCsvSyncCSVHandler::ExportDataAssetsToCSVTable(const TArray<UDataAsset*>& DataAssets, const FString& FilePath, const TArray<FString>& ColumnsToExport)
 {
-	if (!DataAsset)
-	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToDataAssetInPlace: DataAsset is null"));
-		return false;
-	}
-	if (!CanExportClass(DataAsset->GetClass()))
+	const FString& KeyColumn = UAssetCsvSyncEditorPluginSettings::Get()->TableKeyColumn;
+	if (KeyColumn.IsEmpty())
 	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToDataAssetInPlace: Class %s is not marked with meta=(CsvExport)"), *DataAsset->GetClass()->GetName());
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ExportDataAssetsToCSVTable: TableKeyColumn is empty"));
 		return false;
 	}
 
-	FString CSVContent;
-	if (!FFileHelper::LoadFileToString(CSVContent, *FilePath))
-	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToDataAssetInPlace: Could not load file %s"), *FilePath);
-		return false;
-	}
-	TArray<FString> Lines;
-	CSVContent.ParseIntoArrayLines(Lines, false);
-	if (Lines.Num() < 2)
+	const FAssetCsvSyncColumnFilter Filter(ColumnsToExport);
+	FAssetCsvSyncTableWriter Writer(KeyColumn);
+	Writer.SetFormat(AssetCsvSync_GetTableFormat(FilePath));
+	TArray<UDataAsset*> Exportable;
+	Exportable.Reserve(DataAssets.Num());
+	for (UDataAsset* DataAsset : DataAssets)
 	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToDataAssetInPlace: CSV file has insufficient data"));
-		return false;
+		if (!DataAsset)
+			continue;
+		if (!CanExportClass(DataAsset->GetClass()))
+		{
+			UE_LOG(LogAssetCsvSync, Warning, TEXT("ExportDataAssetsToCSVTable: Skipping %s, class %s is not marked with meta=(CsvExport)"), *DataAsset->GetPathName(), *DataAsset->GetClass()->GetName());
+			continue;
+		}
+		Exportable.Add(DataAsset);
 	}
-	TArray<FString> Headers = ParseCSVLine(Lines[0]);
-	TArray<FString> Values = ParseCSVLine(Lines[1]);
-	if (Headers.Num() != Values.Num())
+	AppendTableRows(Writer, Exportable, Filter);
+
+	if (Writer.NumRows() == 0)
 	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToDataAssetInPlace: Column count mismatch"));
+		UE_LOG(LogAssetCsvSync, Warning, TEXT("ExportDataAssetsToCSVTable: No exportable assets"));
 		return false;
 	}
+	return SaveCSVTable(Writer, FilePath);
+}
 
-	TSet<FString> Allowed;
-	if (ColumnsToImport.Num() > 0)
+// Sharded table exports: a JSON manifest lists the shard files, which sit next to it and share one header.
+static const int32 AssetCsvSync_ShardManifestVersion = 1;
+
+struct FAssetCsvSyncShard
+{
+	FString FileName;
+	FString Partition;
+	TArray<int32> Rows;
+};
+
+static bool AssetCsvSync_IsShardManifest(const FString& FilePath)
+{
+	return FPaths::GetExtension(FilePath).Equals(TEXT("json"), ESearchCase::IgnoreCase);
+}
+
+static bool AssetCsvSync_WriteShardManifest(const FString& ManifestPath, const FString& ClassPath, const TArray<FString>& Header, const TArray<FAssetCsvSyncShard>& Shards)
+{
+	const FString Directory = FPaths::GetPath(ManifestPath);
+	FString Text;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Text);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("version"), AssetCsvSync_ShardManifestVersion);
+	Writer->WriteValue(TEXT("class"), ClassPath);
+	Writer->WriteValue(TEXT("keyColumn"), Header[0]);
+	Writer->WriteValue(TEXT("header"), Header);
+	Writer->WriteArrayStart(TEXT("shards"));
+	for (const FAssetCsvSyncShard& Shard : Shards)
 	{
-		Allowed.Reserve(ColumnsToImport.Num());
-		for (const FString& Col : ColumnsToImport)
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("file"), Shard.FileName);
+		Writer->WriteValue(TEXT("rows"), Shard.Rows.Num());
+		// 64-bit values are written as strings; JSON numbers are doubles.
+		Writer->WriteValue(TEXT("bytes"), LexToString(IFileManager::Get().FileSize(*(Directory / Shard.FileName))));
+		if (!Shard.Partition.IsEmpty())
 		{
-			Allowed.Add(Col);
+			Writer->WriteValue(TEXT("partition"), Shard.Partition);
 		}
+		Writer->WriteObjectEnd();
 	}
+	Writer->WriteArrayEnd();
+	Writer->WriteObjectEnd();
+	Writer->Close();
+	return FFileHelper::SaveStringToFile(Text, *ManifestPath);
+}
 
-	TMap<FString, FString> ColumnToValue;
-	ColumnToValue.Reserve(Headers.Num());
-	for (int32 i = 0; i < Headers.Num(); ++i)
+static bool AssetCsvSync_ReadShardManifest(const FString& ManifestPath, TArray<FString>& OutShardPaths, TArray<FString>* OutHeader = nullptr)
+{
+	FString Text;
+	if (!FFileHelper::LoadFileToString(Text, *ManifestPath))
 	{
-		if (Allowed.Num() == 0 || Allowed.Contains(Headers[i]))
-		{
-			ColumnToValue.Add(Headers[i], Values[i]);
-		}
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ReadShardManifest: Could not load file %s"), *ManifestPath);
+		return false;
 	}
 
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Text);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || Root->GetIntegerField(TEXT("version")) != AssetCsvSync_ShardManifestVersion)
 	{
-		// Wrap in a transaction so the import can be undone with Ctrl+Z.
-		FScopedTransaction Transaction(FText::FromString(TEXT("Import CSV to Data Asset")));
-		DataAsset->Modify();
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ReadShardManifest: %s is not a shard manifest"), *ManifestPath);
+		return false;
+	}
 
-		TSet<const UObject*> Visited;
-		if (!ApplyColumnsToObject(DataAsset, DataAsset->GetClass(), ColumnToValue, FString(), Visited))
+	const FString Directory = FPaths::GetPath(ManifestPath);
+	const TArray<TSharedPtr<FJsonValue>>* Shards = nullptr;
+	if (Root->TryGetArrayField(TEXT("shards"), Shards))
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *Shards)
 		{
-			// Transaction rolls back automatically when it goes out of scope without committing.
-			return false;
+			const TSharedPtr<FJsonObject> Object = Value.IsValid() ? Value->AsObject() : nullptr;
+			FString FileName;
+			if (Object.IsValid() && Object->TryGetStringField(TEXT("file"), FileName))
+			{
+				OutShardPaths.Add(Directory / FileName);
+			}
 		}
-
-		DataAsset->MarkPackageDirty();
-		DataAsset->PostEditChange();
 	}
-
-	if (bSavePackage)
+	if (OutHeader)
 	{
-		SaveCreatedAsset(DataAsset->GetPackage(), DataAsset);
+		Root->TryGetStringArrayField(TEXT("header"), *OutHeader);
 	}
 	return true;
 }
 
-bool UAssetCsvSyncCSVHandler::ImportCSVToDataAsset(const FString& FilePath, UDataAsset*& OutDataAsset, UClass* DataAssetClass)
+// One bulk export, shared by the blocking ExportAllDataAssetsOfClassToCSV and the queued job.
+// Batches are loaded and walked on the game thread; writing the file only touches the row text.
+struct FAssetCsvSyncBulkExport
 {
-	if (!CanExportClass(DataAssetClass))
+	// Without MemoryBudgetMB, loaded batches are released and garbage collected once per this many batches.
+	static constexpr int32 UnbudgetedBatchesPerCollect = 8;
+
+	FString FilePath;
+	TWeakObjectPtr<UClass> DataAssetClass;
+	FAssetCsvSyncColumnFilter Filter;
+	FAssetCsvSyncTableWriter Writer;
+	int32 BatchSize = 1;
+	FAssetCsvSyncShardOptions Shards;
+
+	TArray<FAssetData> Assets;
+	int32 NextAsset = 0;
+	FStreamableManager Streamable;
+	TSharedPtr<FStreamableHandle> Handle;
+	TArray<FSoftObjectPath> BatchPaths;
+	// Packages this export brought into memory and has not released yet.
+	TArray<TWeakObjectPtr<UPackage>> LoadedPackages;
+	TSet<FName> LoadedPackageNames;
+	int32 BatchesSinceCollect = 0;
+
+	double StartTime = 0.0;
+	uint64 PeakUsedPhysical = 0;
+	FAssetCsvSyncBulkExportResult Result;
+
+	explicit FAssetCsvSyncBulkExport(const TArray<FString>& ColumnsToExport)
+		: Filter(ColumnsToExport)
+		, Writer(UAssetCsvSyncEditorPluginSettings::Get()->TableKeyColumn)
+		, BatchSize(FMath::Max(1, UAssetCsvSyncEditorPluginSettings::Get()->BulkExportBatchSize))
 	{
-		FString ClassName = DataAssetClass ? DataAssetClass->GetName() : TEXT("null");
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToDataAsset: Class %s is not marked with meta=(CsvExport)"), *ClassName);
-		return false;
 	}
 
-	FString CSVContent;
-	if (!FFileHelper::LoadFileToString(CSVContent, *FilePath))
+	bool Init(const FString& InFilePath, UClass* InDataAssetClass, bool bIncludeSubclasses)
 	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToDataAsset: Could not load file %s"), *FilePath);
-		return false;
-	}
+		if (!InDataAssetClass || !InDataAssetClass->IsChildOf(UDataAsset::StaticClass()))
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ExportAllDataAssetsOfClassToCSV: invalid class"));
+			return false;
+		}
+		if (!UAssetCsvSyncCSVHandler::CanExportClass(InDataAssetClass))
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ExportAllDataAssetsOfClassToCSV: Class %s is not marked with meta=(CsvExport)"), *InDataAssetClass->GetName());
+			return false;
+		}
+		if (Writer.Header[0].IsEmpty())
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ExportAllDataAssetsOfClassToCSV: TableKeyColumn is empty"));
+			return false;
+		}
 
-	TArray<FString> Lines;
-	CSVContent.ParseIntoArrayLines(Lines, false);
+		FilePath = InFilePath;
+		DataAssetClass = InDataAssetClass;
+		Writer.SetFormat(AssetCsvSync_GetTableFormat(FilePath));
+		StartTime = FPlatformTime::Seconds();
+		PeakUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
 
-	if (Lines.Num() < 2)
-	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToDataAsset: CSV file has insufficient data"));
-		return false;
-	}
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		if (AssetRegistry.IsLoadingAssets())
+		{
+			AssetRegistry.WaitForCompletion();
+		}
 
-	TArray<FString> ColumnHeaders = ParseCSVLine(Lines[0]);
-	TArray<FString> Values = ParseCSVLine(Lines[1]);
+		// Derived classes come from the registry, so Blueprint subclasses that are not loaded yet are included.
+		FARFilter ARFilter;
+		ARFilter.ClassPaths.Add(InDataAssetClass->GetClassPathName());
+		if (bIncludeSubclasses)
+		{
+			TSet<FTopLevelAssetPath> DerivedClassPaths;
+			AssetRegistry.GetDerivedClassNames(ARFilter.ClassPaths, TSet<FTopLevelAssetPath>(), DerivedClassPaths);
+			for (const FTopLevelAssetPath& DerivedClassPath : DerivedClassPaths)
+			{
+				ARFilter.ClassPaths.AddUnique(DerivedClassPath);
+			}
+		}
 
-	if (ColumnHeaders.Num() != Values.Num())
-	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToDataAsset: Column count mismatch"));
-		return false;
+		AssetRegistry.GetAssets(ARFilter, Assets);
+		Assets.Sort([](const FAssetData& A, const FAssetData& B) { return A.PackageName.LexicalLess(B.PackageName); });
+		return true;
+	}
+
+	// Exports the next batch. Without bWait this returns early while the batch is still loading.
+	// Returns false once every asset has been exported.
+	bool ExportNextBatch(bool bWait)
+	{
+		if (!Handle.IsValid() && BatchPaths.IsEmpty())
+		{
+			if (NextAsset >= Assets.Num())
+				return false;
+
+			const int32 BatchEnd = FMath::Min(NextAsset + BatchSize, Assets.Num());
+			BatchPaths.Reserve(BatchEnd - NextAsset);
+			for (; NextAsset < BatchEnd; ++NextAsset)
+			{
+				BatchPaths.Add(Assets[NextAsset].GetSoftObjectPath());
+				if (!FindPackage(nullptr, *Assets[NextAsset].PackageName.ToString()))
+				{
+					LoadedPackageNames.Add(Assets[NextAsset].PackageName);
+				}
+			}
+
+			// The whole batch is requested at once so the async loader can overlap IO for its packages.
+			Handle = Streamable.RequestAsyncLoad(BatchPaths, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+		}
+
+		if (Handle.IsValid())
+		{
+			if (bWait)
+			{
+				Handle->WaitUntilComplete();
+			}
+			else if (!Handle->HasLoadCompleted())
+			{
+				return true;
+			}
+		}
+
+		TArray<UDataAsset*> BatchAssets;
+		BatchAssets.Reserve(BatchPaths.Num());
+		for (const FSoftObjectPath& Path : BatchPaths)
+		{
+			UDataAsset* DataAsset = Cast<UDataAsset>(Path.ResolveObject());
+			if (!DataAsset)
+			{
+				UE_LOG(LogAssetCsvSync, Warning, TEXT("ExportAllDataAssetsOfClassToCSV: Could not load %s"), *Path.ToString());
+				++Result.AssetsSkipped;
+				continue;
+			}
+			BatchAssets.Add(DataAsset);
+			if (LoadedPackageNames.Remove(DataAsset->GetPackage()->GetFName()) > 0)
+			{
+				LoadedPackages.Add(DataAsset->GetPackage());
+			}
+		}
+		// Staged values may reference objects of this batch, so the rows are finished before the handle is released.
+		UAssetCsvSyncCSVHandler::AppendTableRows(Writer, BatchAssets, Filter);
+		Result.AssetsExported += BatchAssets.Num();
+
+		PeakUsedPhysical = FMath::Max<uint64>(PeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical);
+
+		// Only the rows' text is kept; drop the batch so its packages can be collected before the next one loads.
+		if (Handle.IsValid())
+		{
+			Handle->ReleaseHandle();
+			Handle.Reset();
+		}
+		BatchPaths.Reset();
+		LoadedPackageNames.Reset();
+
+		// With a budget, loaded batches pile up until the ceiling is reached. Without one they are released every
+		// few batches and after the last, so a full GC pass is not paid per batch.
+		++BatchesSinceCollect;
+		const bool bBudgeted = UAssetCsvSyncEditorPluginSettings::Get()->MemoryBudgetMB > 0;
+		if (bBudgeted ? UAssetCsvSyncCSVHandler::IsOverMemoryBudget() : (BatchesSinceCollect >= UnbudgetedBatchesPerCollect || NextAsset >= Assets.Num()))
+		{
+			UAssetCsvSyncCSVHandler::ReleasePackagesAndCollect(LoadedPackages);
+			LoadedPackages.Reset();
+			BatchesSinceCollect = 0;
+			++Result.GarbageCollections;
+		}
+		return NextAsset < Assets.Num();
+	}
+
+	bool IsWaitingForLoad() const
+	{
+		return Handle.IsValid() && !Handle->HasLoadCompleted();
+	}
+
+	float GetProgress() const
+	{
+		return Assets.IsEmpty() ? 1.0f : float(Result.AssetsExported + Result.AssetsSkipped) / Assets.Num();
+	}
+
+	// Only touches the row text, so it can run on a worker.
+	bool Write()
+	{
+		if (Writer.NumRows() == 0)
+			return false;
+		if (Shards.Mode == EAssetCsvSyncShardMode::None)
+			return UAssetCsvSyncCSVHandler::SaveCSVTable(Writer, FilePath);
+
+		TArray<FAssetCsvSyncShard> ShardList;
+		if (!PlanShards(ShardList))
+			return false;
+
+		// Each shard is its own file, so they are written concurrently.
+		const FString Directory = FPaths::GetPath(FilePath);
+		IFileManager::Get().MakeDirectory(*Directory, true);
+		TArray<bool> Written;
+		Written.SetNumZeroed(ShardList.Num());
+		AssetCsvSync_ParallelFor(ShardList.Num(), [this, &ShardList, &Written, &Directory](int32 Index)
+		{
+			Written[Index] = UAssetCsvSyncCSVHandler::SaveCSVTable(Writer, Directory / ShardList[Index].FileName, &ShardList[Index].Rows);
+		});
+		if (Written.Contains(false))
+			return false;
+
+		Result.ShardsWritten = ShardList.Num();
+		const FString ClassPath = DataAssetClass.IsValid() ? DataAssetClass->GetPathName() : FString();
+		if (!AssetCsvSync_WriteShardManifest(FilePath, ClassPath, Writer.Header, ShardList))
+			return false;
+		return !Writer.bWriteSchema || Writer.Schema.Save(FilePath);
+	}
+
+	bool PlanShards(TArray<FAssetCsvSyncShard>& OutShards) const
+	{
+		FString BaseName = FPaths::GetBaseFilename(FilePath);
+		BaseName.RemoveFromEnd(TEXT(".manifest"));
+		auto IndexedShard = [&OutShards, &BaseName]() -> FAssetCsvSyncShard&
+		{
+			FAssetCsvSyncShard& Shard = OutShards.AddDefaulted_GetRef();
+			Shard.FileName = FString::Printf(TEXT("%s.%03d.csv"), *BaseName, OutShards.Num() - 1);
+			return Shard;
+		};
+
+		const int32 NumRows = Writer.RowText.Num();
+		switch (Shards.Mode)
+		{
+		case EAssetCsvSyncShardMode::RowCount:
+		{
+			const int32 MaxRows = FMath::Max(1, Shards.MaxRowsPerShard);
+			for (int32 Row = 0; Row < NumRows; ++Row)
+			{
+				FAssetCsvSyncShard& Shard = Row % MaxRows == 0 ? IndexedShard() : OutShards.Last();
+				Shard.Rows.Add(Row);
+			}
+			return true;
+		}
+		case EAssetCsvSyncShardMode::ByteSize:
+		{
+			// Row text is measured as UTF-8, plus its line break and the padding of rows that predate late columns.
+			const int64 MaxBytes = FMath::Max(1, Shards.MaxShardSizeMB) * 1024ll * 1024ll;
+			int64 ShardBytes = 0;
+			for (int32 Row = 0; Row < NumRows; ++Row)
+			{
+				const FString& Text = Writer.RowText[Row];
+				const int64 RowBytes = FPlatformString::ConvertedLength<UTF8CHAR>(*Text, Text.Len()) + 1 + (Writer.Header.Num() - Writer.RowCellCount[Row]);
+				if (OutShards.IsEmpty() || (ShardBytes + RowBytes > MaxBytes && OutShards.Last().Rows.Num() > 0))
+				{
+					IndexedShard();
+					ShardBytes = 0;
+				}
+				OutShards.Last().Rows.Add(Row);
+				ShardBytes += RowBytes;
+			}
+			return true;
+		}
+		case EAssetCsvSyncShardMode::PartitionColumn:
+		{
+			const int32 Column = Writer.Header.IndexOfByKey(Shards.PartitionColumn);
+			if (Column == INDEX_NONE)
+			{
+				UE_LOG(LogAssetCsvSync, Error, TEXT("ExportAllDataAssetsOfClassToShards: Partition column '%s' is not exported"), *Shards.PartitionColumn);
+				return false;
+			}
+
+			TArray<FString> Partitions;
+			Partitions.SetNum(NumRows);
+			AssetCsvSync_ParallelFor(NumRows, [this, &Partitions, Column](int32 Row)
+			{
+				// Rows that predate the column have no cell for it.
+				const TArray<FString> Cells = UAssetCsvSyncCSVHandler::ParseCSVLine(Writer.RowText[Row]);
+				Partitions[Row] = Cells.IsValidIndex(Column) ? Cells[Column] : FString();
+			});
+
+			TMap<FString, TArray<int32>> RowsByPartition;
+			for (int32 Row = 0; Row < NumRows; ++Row)
+			{
+				RowsByPartition.FindOrAdd(Partitions[Row]).Add(Row);
+			}
+			RowsByPartition.KeySort(TLess<FString>());
+
+			TSet<FString> UsedNames;
+			for (TPair<FString, TArray<int32>>& Pair : RowsByPartition)
+			{
+				FString Suffix = Pair.Key.IsEmpty() ? FString(TEXT("_empty")) : FPaths::MakeValidFileName(Pair.Key, TEXT('_'));
+				for (int32 Attempt = 2; UsedNames.Contains(Suffix); ++Attempt)
+				{
+					Suffix = FString::Printf(TEXT("%s_%d"), *FPaths::MakeValidFileName(Pair.Key, TEXT('_')), Attempt);
+				}
+				UsedNames.Add(Suffix);
+
+				FAssetCsvSyncShard& Shard = OutShards.AddDefaulted_GetRef();
+				Shard.FileName = FString::Printf(TEXT("%s.%s.csv"), *BaseName, *Suffix);
+				Shard.Partition = Pair.Key;
+				Shard.Rows = MoveTemp(Pair.Value);
+			}
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	void Finish(bool bOk)
+	{
+		Result.Seconds = FPlatformTime::Seconds() - StartTime;
+		Result.AssetsPerSecond = Result.Seconds > 0.0 ? Result.AssetsExported / Result.Seconds : 0.0;
+		Result.PeakUsedPhysicalMB = PeakUsedPhysical / (1024.0 * 1024.0);
+
+		const FString ClassName = DataAssetClass.IsValid() ? DataAssetClass->GetName() : FString(TEXT("<unloaded>"));
+		UE_LOG(LogAssetCsvSync, Log, TEXT("ExportAllDataAssetsOfClassToCSV: %d assets (%d skipped) of %s in %.2fs, %.1f assets/s, peak %.1f MB used, %d GC pass(es), %d shard(s)"),
+			Result.AssetsExported, Result.AssetsSkipped, *ClassName, Result.Seconds, Result.AssetsPerSecond, Result.PeakUsedPhysicalMB, Result.GarbageCollections, Result.ShardsWritten);
+
+		if (!bOk && Assets.Num() == 0)
+		{
+			UE_LOG(LogAssetCsvSync, Warning, TEXT("ExportAllDataAssetsOfClassToCSV: No assets of class %s found"), *ClassName);
+		}
+	}
+};
+
+bool UAssetCsvSyncCSVHandler::ExportAllDataAssetsOfClassToCSV(UClass* DataAssetClass, const FString& FilePath, const TArray<FString>& ColumnsToExport, bool bIncludeSubclasses, FAssetCsvSyncBulkExportResult& OutResult)
+{
+	OutResult = FAssetCsvSyncBulkExportResult();
+
+	FAssetCsvSyncBulkExport Export(ColumnsToExport);
+	if (!Export.Init(FilePath, DataAssetClass, bIncludeSubclasses))
+		return false;
+
+	while (Export.ExportNextBatch(true))
+	{
+	}
+	const bool bOk = Export.Write();
+	Export.Finish(bOk);
+
+	OutResult = Export.Result;
+	return bOk;
+}
+
+bool UAssetCsvSyncCSVHandler::ExportAllDataAssetsOfClassToShards(UClass* DataAssetClass, const FString& ManifestPath, const TArray<FString>& ColumnsToExport, bool bIncludeSubclasses, const FAssetCsvSyncShardOptions& Shards, FAssetCsvSyncBulkExportResult& OutResult)
+{
+	OutResult = FAssetCsvSyncBulkExportResult();
+	if (Shards.Mode == EAssetCsvSyncShardMode::None)
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ExportAllDataAssetsOfClassToShards: no shard mode set"));
+		return false;
+	}
+	if (!AssetCsvSync_IsShardManifest(ManifestPath))
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ExportAllDataAssetsOfClassToShards: manifest path %s must end in .json"), *ManifestPath);
+		return false;
+	}
+
+	FAssetCsvSyncBulkExport Export(ColumnsToExport);
+	Export.Shards = Shards;
+	if (!Export.Init(ManifestPath, DataAssetClass, bIncludeSubclasses))
+		return false;
+
+	while (Export.ExportNextBatch(true))
+	{
+	}
+	const bool bOk = Export.Write();
+	Export.Finish(bOk);
+
+	OutResult = Export.Result;
+	return bOk;
+}
+
+TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> UAssetCsvSyncCSVHandler::MakeBulkExportJob(UClass* DataAssetClass, const FString& FilePath, const TArray<FString>& ColumnsToExport, bool bIncludeSubclasses, TFunction<void(EAssetCsvSyncJobResult, const FAssetCsvSyncBulkExportResult&)> OnComplete, const FAssetCsvSyncShardOptions& Shards)
+{
+	TSharedRef<FAssetCsvSyncBulkExport, ESPMode::ThreadSafe> Export = MakeShared<FAssetCsvSyncBulkExport, ESPMode::ThreadSafe>(ColumnsToExport);
+	Export->Shards = Shards;
+	const FString ClassName = DataAssetClass ? DataAssetClass->GetName() : FString(TEXT("null"));
+	TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> Job = MakeShared<FAssetCsvSyncJob, ESPMode::ThreadSafe>(FText::FromString(FString::Printf(TEXT("Export %s to %s"), *ClassName, *FPaths::GetCleanFilename(FilePath))));
+
+	Job->AddGameThreadStage([Export, DataAssetClass = TWeakObjectPtr<UClass>(DataAssetClass), FilePath, bIncludeSubclasses](FAssetCsvSyncJob&)
+	{
+		return Export->Init(FilePath, DataAssetClass.Get(), bIncludeSubclasses) ? EAssetCsvSyncStepResult::Done : EAssetCsvSyncStepResult::Failed;
+	})
+	.AddGameThreadStage([Export](FAssetCsvSyncJob& InJob)
+	{
+		// Never blocks on the loader: the step yields the tick until the batch has streamed in.
+		const bool bMore = Export->ExportNextBatch(false);
+		InJob.SetProgress(Export->GetProgress(), FText::FromString(FString::Printf(TEXT("%d of %d assets"), Export->Result.AssetsExported + Export->Result.AssetsSkipped, Export->Assets.Num())));
+		if (!bMore)
+			return EAssetCsvSyncStepResult::Done;
+		return Export->IsWaitingForLoad() ? EAssetCsvSyncStepResult::Yield : EAssetCsvSyncStepResult::Continue;
+	})
+	.AddBackgroundStage([Export](FAssetCsvSyncJob& InJob)
+	{
+		InJob.SetProgress(1.0f, FText::FromString(TEXT("Writing CSV")));
+		return Export->Write();
+	})
+	.OnFinished([Export, OnComplete](EAssetCsvSyncJobResult JobResult)
+	{
+		Export->Finish(JobResult == EAssetCsvSyncJobResult::Succeeded);
+		if (OnComplete)
+		{
+			OnComplete(JobResult, Export->Result);
+		}
+	});
+	return Job;
+}
+
+void UAssetCsvSyncCSVHandler::CollectTableRows(TArray<FAssetCsvSyncExportSink>& OutSinks, const TArray<UDataAsset*>& DataAssets, const FString& KeyColumn, const FAssetCsvSyncColumnFilter& Filter, EAssetCsvSyncTableFormat Format)
+{
+	// Phase 1 (game thread): walk every asset and copy its selected leaf values into staging.
+	OutSinks.SetNum(DataAssets.Num());
+	for (int32 RowIndex = 0; RowIndex < DataAssets.Num(); ++RowIndex)
+	{
+		UDataAsset* DataAsset = DataAssets[RowIndex];
+		FAssetCsvSyncExportSink& Sink = OutSinks[RowIndex];
+		Sink.bDeferFormatting = true;
+		Sink.AddColumn(KeyColumn, DataAsset->GetPathName());
+
+		TSet<const UObject*> Visited;
+		ExportObjectToColumns(DataAsset, DataAsset->GetClass(), Sink, FString(), Filter, Visited);
+	}
+
+	// Phase 2 (workers): format the staged values. Each row only writes its own sink.
+	AssetCsvSync_ParallelFor(OutSinks.Num(), [&OutSinks, Format](int32 RowIndex)
+	{
+		FormatStagedValues(OutSinks[RowIndex], Format);
+	});
+}
+
+void UAssetCsvSyncCSVHandler::AppendTableRows(FAssetCsvSyncTableWriter& Writer, const TArray<UDataAsset*>& DataAssets, const FAssetCsvSyncColumnFilter& Filter)
+{
+	TArray<FAssetCsvSyncExportSink> Sinks;
+	CollectTableRows(Sinks, DataAssets, Writer.Header[0], Filter, Writer.Format);
+
+	for (int32 RowIndex = 0; RowIndex < Sinks.Num(); ++RowIndex)
+	{
+		const FAssetCsvSyncExportSink& Sink = Sinks[RowIndex];
+		for (const FString& ColName : Sink.ColumnOrder)
+		{
+			if (Filter.WantsColumn(ColName) && !Writer.HeaderSet.Contains(ColName))
+			{
+				Writer.HeaderSet.Add(ColName);
+				Writer.Header.Add(ColName);
+			}
+		}
+		if (!Writer.bWriteSchema)
+			continue;
+		Writer.Schema.AddClass(DataAssets[RowIndex]->GetClass());
+		for (const FAssetCsvSyncExportSink::FStagedValue& Staged : Sink.Staged)
+		{
+			if (Filter.WantsColumn(Staged.Column))
+			{
+				Writer.Schema.AddColumn(Staged.Column, Staged.Value->Property);
+			}
+		}
+	}
+
+	// Phase 3 (workers): escape and join each row against the header as it stands after this batch.
+	// A JSON Lines row names its own fields instead, in walk order; columns without a value are null.
+	const TArray<FString>& Header = Writer.Header;
+	if (Writer.Binary)
+	{
+		for (const FAssetCsvSyncExportSink& Sink : Sinks)
+		{
+			AssetCsvSync_AppendTypedRow(*Writer.Binary, Writer.Binary->AddRow(), Sink, Header[0], Filter);
+		}
+		return;
+	}
+	if (Writer.Sqlite)
+	{
+		// Each row goes to the table of its asset's class.
+		for (int32 RowIndex = 0; RowIndex < Sinks.Num(); ++RowIndex)
+		{
+			AssetCsvSync_AppendTypedRow(*Writer.Sqlite, Writer.Sqlite->AddRow(DataAssets[RowIndex]->GetClass()), Sinks[RowIndex], Header[0], Filter);
+		}
+		return;
+	}
+
+	TArray<FString> BatchRows;
+	BatchRows.SetNum(Sinks.Num());
+	if (Writer.Format == EAssetCsvSyncTableFormat::JsonLines)
+	{
+		AssetCsvSync_ParallelFor(Sinks.Num(), [&Sinks, &Header, &Filter, &BatchRows](int32 RowIndex)
+		{
+			const FAssetCsvSyncExportSink& Sink = Sinks[RowIndex];
+			FString& Row = BatchRows[RowIndex];
+			Row += TEXT("{");
+			FAssetCsvSyncJsonLines::WriteString(Row, Header[0]);
+			Row += TEXT(":");
+			FAssetCsvSyncJsonLines::WriteString(Row, Sink.ColumnToValue.FindChecked(Header[0]));
+			for (const FString& ColName : Sink.ColumnOrder)
+			{
+				if (ColName == Header[0] || !Filter.WantsColumn(ColName))
+					continue;
+				const FString& Value = Sink.ColumnToValue.FindChecked(ColName);
+				Row += TEXT(",");
+				FAssetCsvSyncJsonLines::WriteString(Row, ColName);
+				Row += TEXT(":");
+				Row += Value.IsEmpty() ? TEXT("null") : *Value;
+			}
+			Row += TEXT("}");
+		});
+	}
+	else
+	{
+		AssetCsvSync_ParallelFor(Sinks.Num(), [&Sinks, &Header, &BatchRows](int32 RowIndex)
+		{
+			const TMap<FString, FString>& ColumnToValue = Sinks[RowIndex].ColumnToValue;
+			FString& Row = BatchRows[RowIndex];
+			for (int32 Index = 0; Index < Header.Num(); ++Index)
+			{
+				const FString* Value = ColumnToValue.Find(Header[Index]);
+				if (Index > 0)
+				{
+					Row += TEXT(",");
+				}
+				if (Value)
+				{
+					AssetCsvSync::Core::AppendCsvCell(AssetCsvSync_CoreView(*Value), FAssetCsvSyncCoreAppend{ Row });
+				}
+			}
+		});
+	}
+
+	Writer.RowText.Reserve(Writer.RowText.Num() + BatchRows.Num());
+	for (FString& Row : BatchRows)
+	{
+		Writer.RowText.Add(MoveTemp(Row));
+		Writer.RowCellCount.Add(Header.Num());
+	}
+}
+
+void UAssetCsvSyncCSVHandler::AddLeafValue(FAssetCsvSyncExportSink& Sink, const FString& ColumnName, FProperty* Property, const void* ValuePtr)
+{
+	if (!Sink.bDeferFormatting)
+	{
+		Sink.AddColumn(ColumnName, PropertyToString(Property, reinterpret_cast<const uint8*>(ValuePtr)));
+		return;
+	}
+
+	// Reserve the column now so column order stays the walk order; the text is filled in by FormatStagedValues.
+	Sink.AddColumn(ColumnName, FString());
+	FAssetCsvSyncExportSink::FStagedValue& Staged = Sink.Staged.AddDefaulted_GetRef();
+	Staged.Column = ColumnName;
+	Staged.Value = MakeUnique<FAssetCsvSyncScratchValue>(Property, ValuePtr);
+}
+
+void UAssetCsvSyncCSVHandler::FormatStagedValues(FAssetCsvSyncExportSink& Sink, EAssetCsvSyncTableFormat Format)
+{
+	for (const FAssetCsvSyncExportSink::FStagedValue& Staged : Sink.Staged)
+	{
+		// Binary tables and databases keep numbers, booleans, names and strings typed.
+		const bool bTypedFormat = Format == EAssetCsvSyncTableFormat::Binary || Format == EAssetCsvSyncTableFormat::Sqlite;
+		if (bTypedFormat && FAssetCsvSyncBinaryTableWriter::GetKind(Staged.Value->Property) != EAssetCsvSyncBinaryKind::Text)
+			continue;
+
+		FString& Value = Sink.ColumnToValue.FindChecked(Staged.Column);
+		if (Format == EAssetCsvSyncTableFormat::JsonLines)
+		{
+			Value.Reset();
+			FAssetCsvSyncJsonLines::WriteValue(Value, Staged.Value->Property, Staged.Value->Data, [](FProperty* Property, const uint8* PropertyData)
+			{
+				return PropertyToString(Property, PropertyData);
+			});
+			continue;
+		}
+		Value = PropertyToString(Staged.Value->Property, Staged.Value->Data);
+	}
+}
+
+bool UAssetCsvSyncCSVHandler::SaveCSVTable(const FAssetCsvSyncTableWriter& Writer, const FString& FilePath, const TArray<int32>* RowIndices)
+{
+	if (Writer.Binary)
+	{
+		check(!RowIndices);
+		return Writer.Binary->Save(FilePath, Writer.Header[0], UAssetCsvSyncEditorPluginSettings::Get()->bCompressBinaryTables, AssetCsvSync_ParallelFor);
+	}
+	if (Writer.Sqlite)
+	{
+		check(!RowIndices);
+		return Writer.Sqlite->Save(FilePath, Writer.Header[0]);
+	}
+
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!FileWriter)
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("SaveCSVTable: Could not open %s for writing"), *FilePath);
+		return false;
+	}
+
+	auto WriteLine = [&FileWriter](const FString& Line)
+	{
+		FTCHARToUTF8 Utf8(*Line, Line.Len());
+		FileWriter->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+	};
+
+	// JSON Lines rows are self-describing and never padded.
+	const bool bJsonLines = Writer.Format == EAssetCsvSyncTableFormat::JsonLines;
+	if (!bJsonLines)
+	{
+		FString HeaderLine;
+		AppendCSVRow(HeaderLine, Writer.Header);
+		WriteLine(HeaderLine);
+	}
+
+	// Without RowIndices every row is written; a shard passes its own rows.
+	const int32 NumRows = RowIndices ? RowIndices->Num() : Writer.RowText.Num();
+	for (int32 Index = 0; Index < NumRows; ++Index)
+	{
+		const int32 RowIndex = RowIndices ? (*RowIndices)[Index] : Index;
+		FString Line = Writer.RowText[RowIndex];
+		for (int32 Missing = Writer.RowCellCount[RowIndex]; Missing < Writer.Header.Num() && !bJsonLines; ++Missing)
+		{
+			Line += TEXT(",");
+		}
+		Line += TEXT("\n");
+		WriteLine(Line);
+	}
+
+	if (!FileWriter->Close())
+		return false;
+	// Shards share the sidecar of their manifest.
+	return RowIndices || !Writer.bWriteSchema || Writer.Schema.Save(FilePath);
+}
+
+// Byte-level record scan used by the upsert. Quotes, commas and line breaks are ASCII, so UTF-8 text can be
+// split into records and cells without decoding it; only the key cell of each row is decoded.
+struct FAssetCsvSyncRecordSpan
+{
+	int64 Start = 0;
+	// End of the record text, before its line break.
+	int64 End = 0;
+	// Start of the next record.
+	int64 Next = 0;
+};
+
+static bool AssetCsvSync_NextRecord(const TArray64<uint8>& Bytes, int64 Pos, FAssetCsvSyncRecordSpan& OutSpan)
+{
+	const int64 Num = Bytes.Num();
+	if (Pos >= Num)
+		return false;
+
+	bool bInQuotes = false;
+	int64 i = Pos;
+	for (; i < Num; ++i)
+	{
+		const uint8 Char = Bytes[i];
+		if (Char == '"')
+		{
+			bInQuotes = !bInQuotes;
+		}
+		else if (!bInQuotes && (Char == '\n' || Char == '\r'))
+		{
+			break;
+		}
+	}
+
+	OutSpan.Start = Pos;
+	OutSpan.End = i;
+	if (i < Num && Bytes[i] == '\r')
+		++i;
+	if (i < Num && Bytes[i] == '\n')
+		++i;
+	OutSpan.Next = i;
+	return true;
+}
+
+// Finds the raw (still quoted) bytes of one cell of a record.
+static bool AssetCsvSync_FindCell(const TArray64<uint8>& Bytes, const FAssetCsvSyncRecordSpan& Span, int32 CellIndex, int64& OutStart, int64& OutEnd)
+{
+	int32 Cell = 0;
+	int64 CellStart = Span.Start;
+	bool bInQuotes = false;
+	for (int64 i = Span.Start; i <= Span.End; ++i)
+	{
+		if (i == Span.End || (!bInQuotes && Bytes[i] == ','))
+		{
+			if (Cell == CellIndex)
+			{
+				OutStart = CellStart;
+				OutEnd = i;
+				return true;
+			}
+			++Cell;
+			CellStart = i + 1;
+		}
+		else if (Bytes[i] == '"')
+		{
+			bInQuotes = !bInQuotes;
+		}
+	}
+	return false;
+}
+
+static FString AssetCsvSync_DecodeUtf8(const TArray64<uint8>& Bytes, int64 Start, int64 End)
+{
+	FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Bytes.GetData() + Start), static_cast<int32>(End - Start));
+	return FString(Converter.Length(), Converter.Get());
+}
+
+// Keeps the schema sidecar of an upserted table in step with its rows: the classes and columns of the upserted
+// rows are merged in. A sidecar whose fingerprints no longer match their classes cannot vouch for the rows already
+// in the table, so it is deleted instead, as is one that cannot be rewritten. A table without a sidecar keeps none.
+static void AssetCsvSync_MergeSchemaSidecar(const FString& TablePath, const TArray<UDataAsset*>& DataAssets, const TArray<FAssetCsvSyncExportSink>& Sinks, const FAssetCsvSyncColumnFilter& Filter)
+{
+	FAssetCsvSyncSchemaSidecar Sidecar;
+	if (!Sidecar.Load(TablePath))
+		return;
+
+	const FString SidecarPath = FAssetCsvSyncSchemaSidecar::GetPath(TablePath);
+	for (const TPair<FString, FString>& Pair : Sidecar.ClassSchemas)
+	{
+		UClass* Class = FindObject<UClass>(nullptr, *Pair.Key);
+		if (!Class || FAssetCsvSyncSourceStamp::GetSchema(Class) != Pair.Value)
+		{
+			UE_LOG(LogAssetCsvSync, Log, TEXT("UpsertDataAssetsInCSVTable: Class %s changed since %s was exported; deleting its schema sidecar"), *Pair.Key, *TablePath);
+			IFileManager::Get().Delete(*SidecarPath);
+			return;
+		}
+	}
+
+	for (int32 Index = 0; Index < Sinks.Num(); ++Index)
+	{
+		Sidecar.AddClass(DataAssets[Index]->GetClass());
+		for (const FAssetCsvSyncExportSink::FStagedValue& Staged : Sinks[Index].Staged)
+		{
+			if (Filter.WantsColumn(Staged.Column))
+			{
+				Sidecar.AddColumn(Staged.Column, Staged.Value->Property);
+			}
+		}
+	}
+	if (!Sidecar.Save(TablePath))
+	{
+		UE_LOG(LogAssetCsvSync, Warning, TEXT("UpsertDataAssetsInCSVTable: Could not update %s; deleting it"), *SidecarPath);
+		IFileManager::Get().Delete(*SidecarPath);
+	}
+}
+
+bool UAssetCsvSyncCSVHandler::UpsertDataAssetsInCSVTable(const TArray<UDataAsset*>& DataAssets, const FString& FilePath, const TArray<FString>& ColumnsToExport, FAssetCsvSyncUpsertResult& OutResult)
+{
+	OutResult = FAssetCsvSyncUpsertResult();
+	const double StartTime = FPlatformTime::Seconds();
+	ON_SCOPE_EXIT
+	{
+		OutResult.Seconds = FPlatformTime::Seconds() - StartTime;
+	};
+
+	const FString KeyColumn = UAssetCsvSyncEditorPluginSettings::Get()->TableKeyColumn;
+	if (KeyColumn.IsEmpty())
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("UpsertDataAssetsInCSVTable: TableKeyColumn is empty"));
+		return false;
+	}
+	if (AssetCsvSync_GetTableFormat(FilePath) != EAssetCsvSyncTableFormat::Csv)
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("UpsertDataAssetsInCSVTable: %s is not a CSV file, only CSV tables are updated in place"), *FilePath);
+		return false;
+	}
+
+	TArray<UDataAsset*> Exportable;
+	Exportable.Reserve(DataAssets.Num());
+	for (UDataAsset* DataAsset : DataAssets)
+	{
+		if (!DataAsset)
+			continue;
+		if (!CanExportClass(DataAsset->GetClass()))
+		{
+			UE_LOG(LogAssetCsvSync, Warning, TEXT("UpsertDataAssetsInCSVTable: Skipping %s, class %s is not marked with meta=(CsvExport)"), *DataAsset->GetPathName(), *DataAsset->GetClass()->GetName());
+			continue;
+		}
+		Exportable.Add(DataAsset);
+	}
+	if (Exportable.Num() == 0)
+	{
+		UE_LOG(LogAssetCsvSync, Warning, TEXT("UpsertDataAssetsInCSVTable: No exportable assets"));
+		return false;
+	}
+
+	if (!IFileManager::Get().FileExists(*FilePath))
+	{
+		if (!ExportDataAssetsToCSVTable(Exportable, FilePath, ColumnsToExport))
+			return false;
+		OutResult.RowsAppended = Exportable.Num();
+		OutResult.bFileWritten = true;
+		return true;
+	}
+
+	TArray64<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("UpsertDataAssetsInCSVTable: Could not load file %s"), *FilePath);
+		return false;
+	}
+
+	// A UTF-8 byte order mark is copied through with the header.
+	const int64 BodyStart = Bytes.Num() >= 3 && Bytes[0] == 0xEF && Bytes[1] == 0xBB && Bytes[2] == 0xBF ? 3 : 0;
+	FAssetCsvSyncRecordSpan HeaderSpan;
+	if (!AssetCsvSync_NextRecord(Bytes, BodyStart, HeaderSpan))
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("UpsertDataAssetsInCSVTable: CSV file has no header"));
+		return false;
+	}
+	TArray<FString> Header = ParseCSVLine(AssetCsvSync_DecodeUtf8(Bytes, HeaderSpan.Start, HeaderSpan.End));
+	const int32 KeyIndex = Header.IndexOfByKey(KeyColumn);
+	if (KeyIndex == INDEX_NONE)
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("UpsertDataAssetsInCSVTable: Key column '%s' not found in %s"), *KeyColumn, *FilePath);
+		return false;
+	}
+	// Rows written here use the file's own line breaks.
+	const TCHAR* LineBreak = HeaderSpan.Next - HeaderSpan.End == 2 ? TEXT("\r\n") : TEXT("\n");
+
+	const FAssetCsvSyncColumnFilter Filter(ColumnsToExport);
+	TArray<FAssetCsvSyncExportSink> Sinks;
+	CollectTableRows(Sinks, Exportable, KeyColumn, Filter);
+
+	// Keys are compared as full object paths, so "/Game/Data/Sword" in the file matches /Game/Data/Sword.Sword.
+	auto NormalizeKey = [](const FString& Key) -> FString
+	{
+		FString PackageName;
+		FString AssetName;
+		return SplitAssetPath(Key, PackageName, AssetName) ? PackageName + TEXT(".") + AssetName : Key.TrimStartAndEnd();
+	};
+
+	// New columns go to the end of the header, as in a full export.
+	const int32 OldHeaderNum = Header.Num();
+	TSet<FString> HeaderSet(Header);
+	TMap<FString, int32> SinkByKey;
+	for (int32 Index = 0; Index < Sinks.Num(); ++Index)
+	{
+		for (const FString& Column : Sinks[Index].ColumnOrder)
+		{
+			if (Filter.WantsColumn(Column) && !HeaderSet.Contains(Column))
+			{
+				HeaderSet.Add(Column);
+				Header.Add(Column);
+			}
+		}
+		SinkByKey.Add(NormalizeKey(Sinks[Index].ColumnToValue.FindChecked(KeyColumn)), Index);
+	}
+	const bool bHeaderGrew = Header.Num() > OldHeaderNum;
+
+	auto JoinRow = [](const TArray<FString>& Cells) -> FString
+	{
+		FString Row;
+		for (int32 Index = 0; Index < Cells.Num(); ++Index)
+		{
+			if (Index > 0)
+			{
+				Row += TEXT(",");
+			}
+			AssetCsvSync::Core::AppendCsvCell(AssetCsvSync_CoreView(Cells[Index]), FAssetCsvSyncCoreAppend{ Row });
+		}
+		return Row;
+	};
+
+	struct FEdit
+	{
+		int64 Start = 0;
+		int64 End = 0;
+		FString Text;
+	};
+	TArray<FEdit> Edits;
+	// Every record, only kept when the header grew and each copied row needs padding.
+	TArray<FAssetCsvSyncRecordSpan> Records;
+	TBitArray<> Matched(false, Sinks.Num());
+
+	FAssetCsvSyncRecordSpan Span;
+	for (int64 Pos = HeaderSpan.Next; AssetCsvSync_NextRecord(Bytes, Pos, Span); Pos = Span.Next)
+	{
+		if (bHeaderGrew)
+		{
+			Records.Add(Span);
+		}
+		if (Span.End == Span.Start)
+			continue;
+		++OutResult.RowsScanned;
+
+		int64 KeyStart = 0;
+		int64 KeyEnd = 0;
+		if (!AssetCsvSync_FindCell(Bytes, Span, KeyIndex, KeyStart, KeyEnd))
+			continue;
+		const TArray<FString> KeyCell = ParseCSVLine(AssetCsvSync_DecodeUtf8(Bytes, KeyStart, KeyEnd));
+		const int32* SinkIndex = KeyCell.Num() > 0 ? SinkByKey.Find(NormalizeKey(KeyCell[0])) : nullptr;
+		if (!SinkIndex)
+			continue;
+		Matched[*SinkIndex] = true;
+
+		// The key cell and the columns this export does not produce keep the file's values.
+		TArray<FString> OldCells = ParseCSVLine(AssetCsvSync_DecodeUtf8(Bytes, Span.Start, Span.End));
+		OldCells.SetNum(Header.Num());
+		TArray<FString> Cells = OldCells;
+		const TMap<FString, FString>& ColumnToValue = Sinks[*SinkIndex].ColumnToValue;
+		for (int32 Index = 0; Index < Header.Num(); ++Index)
+		{
+			if (Index == KeyIndex || !Filter.WantsColumn(Header[Index]))
+				continue;
+			if (const FString* Value = ColumnToValue.Find(Header[Index]))
+			{
+				Cells[Index] = *Value;
+			}
+		}
+		if (Cells == OldCells)
+		{
+			++OutResult.RowsUnchanged;
+			continue;
+		}
+		Edits.Add({ Span.Start, Span.End, JoinRow(Cells) });
+		++OutResult.RowsReplaced;
+	}
+
+	TArray<FString> Appended;
+	for (int32 Index = 0; Index < Sinks.Num(); ++Index)
+	{
+		if (Matched[Index])
+			continue;
+		TArray<FString> Cells;
+		Cells.SetNum(Header.Num());
+		for (int32 Column = 0; Column < Header.Num(); ++Column)
+		{
+			if (Column != KeyIndex && !Filter.WantsColumn(Header[Column]))
+				continue;
+			if (const FString* Value = Sinks[Index].ColumnToValue.Find(Header[Column]))
+			{
+				Cells[Column] = *Value;
+			}
+		}
+		Appended.Add(JoinRow(Cells));
+	}
+	OutResult.RowsAppended = Appended.Num();
+
+	if (Edits.IsEmpty() && Appended.IsEmpty() && !bHeaderGrew)
+	{
+		AssetCsvSync_MergeSchemaSidecar(FilePath, Exportable, Sinks, Filter);
+		UE_LOG(LogAssetCsvSync, Log, TEXT("UpsertDataAssetsInCSVTable: %s is up to date (%d rows)"), *FilePath, OutResult.RowsScanned);
+		return true;
+	}
+
+	// Written next to the target so the final move is a rename on the same volume.
+	const FString TempPath = FPaths::CreateTempFilename(*FPaths::GetPath(FilePath), *(FPaths::GetBaseFilename(FilePath) + TEXT("_")), TEXT(".tmp"));
+	{
+		TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*TempPath));
+		if (!FileWriter)
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("UpsertDataAssetsInCSVTable: Could not open %s for writing"), *TempPath);
+			return false;
+		}
+
+		auto CopyBytes = [&FileWriter, &Bytes, &OutResult](int64 From, int64 To)
+		{
+			if (To > From)
+			{
+				FileWriter->Serialize(Bytes.GetData() + From, To - From);
+				OutResult.BytesCopied += To - From;
+			}
+		};
+		auto WriteText = [&FileWriter](const FString& Text)
+		{
+			FTCHARToUTF8 Utf8(*Text, Text.Len());
+			FileWriter->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+		};
+
+		if (!bHeaderGrew)
+		{
+			// Unaffected runs of rows between two replaced rows go out as one block.
+			int64 Copied = 0;
+			for (const FEdit& Edit : Edits)
+			{
+				CopyBytes(Copied, Edit.Start);
+				WriteText(Edit.Text);
+				Copied = Edit.End;
+			}
+			CopyBytes(Copied, Bytes.Num());
+		}
+		else
+		{
+			const FString Padding = FString::ChrN(Header.Num() - OldHeaderNum, TEXT(','));
+			CopyBytes(0, HeaderSpan.Start);
+			WriteText(JoinRow(Header));
+			CopyBytes(HeaderSpan.End, HeaderSpan.Next);
+			int32 EditIndex = 0;
+			for (const FAssetCsvSyncRecordSpan& Record : Records)
+			{
+				if (Edits.IsValidIndex(EditIndex) && Edits[EditIndex].Start == Record.Start)
+				{
+					WriteText(Edits[EditIndex++].Text);
+				}
+				else if (Record.End > Record.Start)
+				{
+					CopyBytes(Record.Start, Record.End);
+					WriteText(Padding);
+				}
+				CopyBytes(Record.End, Record.Next);
+			}
+		}
+
+		if (!Appended.IsEmpty())
+		{
+			if (Bytes.Num() > BodyStart && Bytes.Last() != '\n' && Bytes.Last() != '\r')
+			{
+				WriteText(LineBreak);
+			}
+			for (const FString& Row : Appended)
+			{
+				WriteText(Row + LineBreak);
+			}
+		}
+
+		if (!FileWriter->Close())
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("UpsertDataAssetsInCSVTable: Could not write %s"), *TempPath);
+			IFileManager::Get().Delete(*TempPath);
+			return false;
+		}
+	}
+
+	if (!IFileManager::Get().Move(*FilePath, *TempPath, true, true))
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("UpsertDataAssetsInCSVTable: Could not replace %s"), *FilePath);
+		IFileManager::Get().Delete(*TempPath);
+		return false;
+	}
+	OutResult.bFileWritten = true;
+	AssetCsvSync_MergeSchemaSidecar(FilePath, Exportable, Sinks, Filter);
+
+	UE_LOG(LogAssetCsvSync, Log, TEXT("UpsertDataAssetsInCSVTable: %s: %d rows scanned, %d replaced, %d unchanged, %d appended, %lld bytes copied through%s"),
+		*FilePath, OutResult.RowsScanned, OutResult.RowsReplaced, OutResult.RowsUnchanged, OutResult.RowsAppended, OutResult.BytesCopied, bHeaderGrew ? TEXT(", header extended") : TEXT(""));
+	return true;
+}
+
+bool UAssetCsvSyncCSVHandler::GetCSVHeaderColumns(const FString& FilePath, TArray<FString>& OutColumns)
+{
+	OutColumns.Reset();
+	if (AssetCsvSync_IsShardManifest(FilePath))
+	{
+		TArray<FString> ShardPaths;
+		return AssetCsvSync_ReadShardManifest(FilePath, ShardPaths, &OutColumns) && OutColumns.Num() > 0;
+	}
+	if (FAssetCsvSyncBinaryTableWriter::IsBinaryTableFile(FilePath))
+	{
+		const TSharedPtr<FAssetCsvSyncBinaryTable, ESPMode::ThreadSafe> Table = FAssetCsvSyncBinaryTable::Open(FilePath, AssetCsvSync_ParallelFor);
+		for (int32 Column = 0; Table && Column < Table->NumColumns(); ++Column)
+		{
+			OutColumns.Add(Table->GetColumnName(Column));
+		}
+		return OutColumns.Num() > 0;
+	}
+	if (FAssetCsvSyncSqliteWriter::IsSqliteFile(FilePath))
+	{
+		return FAssetCsvSyncSqliteReader::GetColumns(FilePath, OutColumns) && OutColumns.Num() > 0;
+	}
+	FString CSVContent;
+	if (!FFileHelper::LoadFileToString(CSVContent, *FilePath))
+	{
+		return false;
+	}
+	if (FAssetCsvSyncJsonLines::IsJsonLinesFile(FilePath))
+	{
+		// Fields of the first record; later records may add columns that assets of other classes have.
+		FString FirstLine;
+		if (!CSVContent.Split(TEXT("\n"), &FirstLine, nullptr))
+		{
+			FirstLine = CSVContent;
+		}
+		FirstLine.TrimEndInline();
+		TArray<FString> Values;
+		return FAssetCsvSyncJsonLines::SplitRecord(FirstLine, OutColumns, Values) && OutColumns.Num() > 0;
+	}
+	// The header record, not the first line: a quoted column name may contain a line break.
+	int32 Pos = 0;
+	FString HeaderRecord;
+	if (!ReadCSVRecord(CSVContent, Pos, HeaderRecord))
+	{
+		return false;
+	}
+	OutColumns = ParseCSVLine(HeaderRecord);
+	return OutColumns.Num() > 0;
+}
+
+bool UAssetCsvSyncCSVHandler::ImportCSVToDataAssetInPlace(const FString& FilePath, UDataAsset* DataAsset, const TArray<FString>& ColumnsToImport, bool bSavePackage)
+{
+	FAssetCsvSyncImportResult Result;
+	return ImportCSVToDataAssetInPlaceWithResult(FilePath, DataAsset, ColumnsToImport, bSavePackage, Result);
+}
+
+// Header and first data record of a single-asset CSV, parsed.
+struct FAssetCsvSyncSingleRowCSV
+{
+	TArray<FString> Headers;
+	TArray<FString> Values;
+};
+
+bool UAssetCsvSyncCSVHandler::ImportCSVToDataAssetInPlaceWithResult(const FString& FilePath, UDataAsset* DataAsset, const TArray<FString>& ColumnsToImport, bool bSavePackage, FAssetCsvSyncImportResult& OutResult)
+{
+	OutResult = FAssetCsvSyncImportResult();
+	FAssetCsvSyncSingleRowCSV CSV;
+	return ReadSingleRowCSV(FilePath, TEXT("ImportCSVToDataAssetInPlace"), CSV) && ApplySingleRowCSV(CSV, DataAsset, ColumnsToImport, bSavePackage, OutResult);
+}
+
+// Errors are logged with LogContext, the public function the read is for.
+bool UAssetCsvSyncCSVHandler::ReadSingleRowCSV(const FString& FilePath, const TCHAR* LogContext, FAssetCsvSyncSingleRowCSV& OutCSV)
+{
+	FString CSVContent;
+	if (!FFileHelper::LoadFileToString(CSVContent, *FilePath))
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("%s: Could not load file %s"), LogContext, *FilePath);
+		return false;
+	}
+	// Records, not lines: quoted cells may contain line breaks.
+	int32 Pos = 0;
+	FString HeaderRecord;
+	FString ValueRecord;
+	if (!ReadCSVRecord(CSVContent, Pos, HeaderRecord) || !ReadCSVRecord(CSVContent, Pos, ValueRecord))
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("%s: CSV file has insufficient data"), LogContext);
+		return false;
+	}
+	OutCSV.Headers = ParseCSVLine(HeaderRecord);
+	OutCSV.Values = ParseCSVLine(ValueRecord);
+	if (OutCSV.Headers.Num() != OutCSV.Values.Num())
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("%s: Column count mismatch"), LogContext);
+		return false;
+	}
+	return true;
+}
+
+bool UAssetCsvSyncCSVHandler::ApplySingleRowCSV(const FAssetCsvSyncSingleRowCSV& CSV, UDataAsset* DataAsset, const TArray<FString>& ColumnsToImport, bool bSavePackage, FAssetCsvSyncImportResult& OutResult)
+{
+	OutResult = FAssetCsvSyncImportResult();
+	if (!DataAsset)
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToDataAssetInPlace: DataAsset is null"));
+		return false;
+	}
+	if (!CanExportClass(DataAsset->GetClass()))
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToDataAssetInPlace: Class %s is not marked with meta=(CsvExport)"), *DataAsset->GetClass()->GetName());
+		return false;
+	}
+
+	const TMap<FString, FString> ColumnToValue = AssetCsvSync_ZipColumns(CSV.Headers, CSV.Values, ColumnsToImport);
+	TArray<UPackage*> PackagesToSave;
+	if (!ApplyColumnsToDataAsset(DataAsset, ColumnToValue, PackagesToSave, FText::FromString(TEXT("Import CSV to Data Asset")), OutResult))
+	{
+		return false;
+	}
+	// A partial import does not make the asset match the whole row, so only full imports are stamped.
+	if (ColumnsToImport.IsEmpty() && OutResult.ChangedColumns > 0)
+	{
+		FAssetCsvSyncSourceStamp::Stamp(DataAsset, FAssetCsvSyncSourceStamp::HashRow(ColumnToValue), FAssetCsvSyncSourceStamp::GetSchema(DataAsset->GetClass()));
+	}
+	if (bSavePackage)
+	{
+		OutResult.bSaved = SavePackages(PackagesToSave) > 0;
+	}
+	return true;
+}
+
+TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> UAssetCsvSyncCSVHandler::MakeImportJob(const FString& FilePath, UDataAsset* DataAsset, const TArray<FString>& ColumnsToImport, bool bSavePackage, TFunction<void(EAssetCsvSyncJobResult, const FAssetCsvSyncImportResult&)> OnComplete)
+{
+	TSharedRef<FAssetCsvSyncSingleRowCSV, ESPMode::ThreadSafe> CSV = MakeShared<FAssetCsvSyncSingleRowCSV, ESPMode::ThreadSafe>();
+	TSharedRef<FAssetCsvSyncImportResult, ESPMode::ThreadSafe> Result = MakeShared<FAssetCsvSyncImportResult, ESPMode::ThreadSafe>();
+	TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> Job = MakeShared<FAssetCsvSyncJob, ESPMode::ThreadSafe>(FText::FromString(FString::Printf(TEXT("Import %s"), *FPaths::GetCleanFilename(FilePath))));
+
+	Job->AddBackgroundStage([CSV, FilePath](FAssetCsvSyncJob&)
+	{
+		return ReadSingleRowCSV(FilePath, TEXT("ImportCSVToDataAssetInPlace"), *CSV);
+	})
+	.AddGameThreadStage([CSV, Result, WeakAsset = TWeakObjectPtr<UDataAsset>(DataAsset), ColumnsToImport, bSavePackage](FAssetCsvSyncJob& InJob)
+	{
+		if (!ApplySingleRowCSV(*CSV, WeakAsset.Get(), ColumnsToImport, bSavePackage, *Result))
+			return EAssetCsvSyncStepResult::Failed;
+		InJob.SetProgress(1.0f, FText::FromString(Result->ChangedColumns == 0 ? FString(TEXT("Asset already up to date.")) : FString::Printf(TEXT("%d column(s) changed."), Result->ChangedColumns)));
+		return EAssetCsvSyncStepResult::Done;
+	})
+	.OnFinished([Result, OnComplete](EAssetCsvSyncJobResult JobResult)
+	{
+		if (OnComplete)
+		{
+			OnComplete(JobResult, *Result);
+		}
+	});
+	return Job;
+}
+
+bool UAssetCsvSyncCSVHandler::ApplyColumnsToDataAsset(UDataAsset* DataAsset, const TMap<FString, FString>& ColumnToValue, TArray<UPackage*>& InOutPackagesToSave, const FText& TransactionName, FAssetCsvSyncImportResult& OutResult, FAssetCsvSyncStagedRow* Staging)
+{
+	OutResult = FAssetCsvSyncImportResult();
+
+	const bool bRecordUndo = ShouldRecordImportUndo();
+
+	FAssetCsvSyncImportContext Context(ColumnToValue);
+	Context.bRecordUndo = bRecordUndo;
+	Context.Staging = Staging;
+	{
+		// Wrap in a transaction so the import can be undone with Ctrl+Z.
+		// Only the top-level properties that actually change are recorded (no whole-object Modify()).
+		FScopedTransaction Transaction(TransactionName, bRecordUndo);
+
+		if (!ApplyColumnsToObject(DataAsset, DataAsset->GetClass(), ColumnToValue, FString(), Context))
+		{
+			// Transaction rolls back automatically when it goes out of scope without committing.
+			return false;
+		}
+
+		for (UObject* Changed : Context.ChangedObjects)
+		{
+			Changed->MarkPackageDirty();
+			Changed->PostEditChange();
+		}
+	}
+
+	OutResult.ChangedColumns = Context.ChangedColumns;
+	if (Context.ChangedObjects.IsEmpty())
+	{
+		UE_LOG(LogAssetCsvSync, Verbose, TEXT("Import: %s is already up to date"), *DataAsset->GetPathName());
+		return true;
+	}
+
+	// Saving is left to the caller so many imports can share one checkout and save pass.
+	for (UObject* Changed : Context.ChangedObjects)
+	{
+		UPackage* Package = Changed->GetPackage();
+		if (Package && Package != GetTransientPackage())
+		{
+			InOutPackagesToSave.AddUnique(Package);
+		}
+	}
+	return true;
+}
+
+bool UAssetCsvSyncCSVHandler::ImportCSVToDataAsset(const FString& FilePath, UDataAsset*& OutDataAsset, UClass* DataAssetClass)
+{
+	if (!CanExportClass(DataAssetClass))
+	{
+		FString ClassName = DataAssetClass ? DataAssetClass->GetName() : TEXT("null");
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToDataAsset: Class %s is not marked with meta=(CsvExport)"), *ClassName);
+		return false;
+	}
+
+	FAssetCsvSyncSingleRowCSV CSV;
+	if (!ReadSingleRowCSV(FilePath, TEXT("ImportCSVToDataAsset"), CSV))
+	{
+		return false;
 	}
 
 	UObject* CreatedObject = NewObject<UObject>(GetTransientPackage(), DataAssetClass);
 	UDataAsset* NewDataAsset = Cast<UDataAsset>(CreatedObject);
 
-	if (!NewDataAsset)
-	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToDataAsset: Could not create DataAsset"));
-		return false;
+	if (!NewDataAsset)
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToDataAsset: Could not create DataAsset"));
+		return false;
+	}
+
+	if (!ApplyCSVRowToObject(NewDataAsset, DataAssetClass, CSV.Headers, CSV.Values))
+	{
+		return false;
+	}
+
+	OutDataAsset = NewDataAsset;
+	return true;
+}
+
+bool UAssetCsvSyncCSVHandler::ImportCSVToNewDataAsset(const FString& FilePath, const FString& AssetPath, UClass* DataAssetClass, UDataAsset*& OutDataAsset, bool bSavePackage)
+{
+	OutDataAsset = nullptr;
+
+	if (!DataAssetClass || !DataAssetClass->IsChildOf(UDataAsset::StaticClass()))
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: invalid class"));
+		return false;
+	}
+	if (!CanExportClass(DataAssetClass))
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: Class %s is not marked with meta=(CsvExport)"), *DataAssetClass->GetName());
+		return false;
+	}
+
+	FString PackageName;
+	FString AssetName;
+	if (!SplitAssetPath(AssetPath, PackageName, AssetName))
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: invalid AssetPath %s"), *AssetPath);
+		return false;
+	}
+	const FString ObjectPath = PackageName + TEXT(".") + AssetName;
+
+	// Read before anything is loaded or created, so a bad file leaves no new asset behind.
+	FAssetCsvSyncSingleRowCSV CSV;
+	if (!ReadSingleRowCSV(FilePath, TEXT("ImportCSVToNewDataAsset"), CSV))
+	{
+		return false;
+	}
+	const TMap<FString, FString> ColumnToValue = AssetCsvSync_ZipColumns(CSV.Headers, CSV.Values, TArray<FString>());
+
+	// If an asset already exists at the path, update it in-place.
+	if (UObject* ExistingObj = StaticLoadObject(UObject::StaticClass(), nullptr, *ObjectPath))
+	{
+		UDataAsset* ExistingAsset = Cast<UDataAsset>(ExistingObj);
+		if (!ExistingAsset)
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: existing object is not a DataAsset: %s"), *ObjectPath);
+			return false;
+		}
+		if (!ExistingAsset->IsA(DataAssetClass))
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: existing asset class mismatch. Existing=%s Expected=%s (%s)"), *ExistingAsset->GetClass()->GetName(), *DataAssetClass->GetName(), *ObjectPath);
+			return false;
+		}
+
+		UE_LOG(LogAssetCsvSync, Log, TEXT("ImportCSVToNewDataAsset: Updating existing asset %s"), *ObjectPath);
+		FAssetCsvSyncImportResult Result;
+		TArray<UPackage*> PackagesToSave;
+		if (!ApplyColumnsToDataAsset(ExistingAsset, ColumnToValue, PackagesToSave, FText::FromString(TEXT("Import CSV to Data Asset")), Result))
+		{
+			return false;
+		}
+		if (Result.ChangedColumns > 0)
+		{
+			FAssetCsvSyncSourceStamp::Stamp(ExistingAsset, FAssetCsvSyncSourceStamp::HashRow(ColumnToValue), FAssetCsvSyncSourceStamp::GetSchema(ExistingAsset->GetClass()));
+		}
+		if (bSavePackage)
+		{
+			SavePackages(PackagesToSave);
+		}
+		OutDataAsset = ExistingAsset;
+		return true;
+	}
+
+	UDataAsset* NewAsset = nullptr;
+	if (!CreateNewDataAssetAsset(AssetPath, DataAssetClass, NewAsset, false))
+	{
+		return false;
+	}
+
+	FAssetCsvSyncImportResult Result;
+	// A freshly created asset is saved even when the CSV only contains default values.
+	TArray<UPackage*> PackagesToSave = { NewAsset->GetPackage() };
+	if (!ApplyColumnsToDataAsset(NewAsset, ColumnToValue, PackagesToSave, FText::FromString(TEXT("Import CSV to New Data Asset")), Result))
+	{
+		return false;
+	}
+	FAssetCsvSyncSourceStamp::Stamp(NewAsset, FAssetCsvSyncSourceStamp::HashRow(ColumnToValue), FAssetCsvSyncSourceStamp::GetSchema(NewAsset->GetClass()));
+	if (bSavePackage)
+	{
+		SavePackages(PackagesToSave);
+	}
+
+	OutDataAsset = NewAsset;
+	return true;
+}
+
+// One table import, shared by the blocking ImportCSVTableToDataAssets and the queued job.
+// Parse only touches strings and runs on a worker in the job; ApplyNextBatch and Save run on the game thread.
+struct FAssetCsvSyncTableImport
+{
+	struct FRow
+	{
+		int32 RowNumber = 0;
+		FString AssetPath;
+		FString RowHash;
+		TMap<FString, FString> ColumnToValue;
+		EAssetCsvSyncTableFormat Format = EAssetCsvSyncTableFormat::Csv;
+		// A binary row's cells stay in the table; ColumnToValue only names the columns that have one.
+		const FAssetCsvSyncBinaryTable* BinaryTable = nullptr;
+		int32 BinaryRow = INDEX_NONE;
+		int32 TypedRow = INDEX_NONE;
+	};
+
+	static constexpr int32 RowsPerBatch = 64;
+
+	FString FilePath;
+	TWeakObjectPtr<UClass> DataAssetClass;
+	FString Folder;
+	TArray<FString> ColumnsToImport;
+	FString KeyColumn;
+	TSet<FString> DatabaseClassPaths;
+	// Set when a schema sidecar whose fingerprints match the current classes was found next to the table.
+	TOptional<FAssetCsvSyncSchemaSidecar> Schema;
+	TMap<FString, FAssetCsvSyncTypedColumn> TypedColumns;
+	// Only full-row imports are stamped, since a column subset does not make the asset match the row.
+	bool bUseSourceStamps = false;
+	// Stamps and saves assets the rows leave unchanged too (RestampCSVTableAssets), so later imports skip them.
+	bool bRestampUnchanged = false;
+	bool bSavePackages = false;
+
+	TArray<FRow> Rows;
+	// Binary tables the rows read their cells from, kept open until the import is done.
+	TArray<TSharedPtr<FAssetCsvSyncBinaryTable, ESPMode::ThreadSafe>> BinaryTables;
+	int32 NextRow = 0;
+	// Smoothed game-thread cost of one row, used to size time-sliced batches.
+	double AverageRowSeconds = 0.0;
+
+	TMap<UClass*, TMap<FString, FProperty*>> ColumnPropertiesByClass;
+	TMap<UClass*, FString> SchemaByClass;
+	TArray<TWeakObjectPtr<UPackage>> PackagesToSave;
+	// Packages this import loaded or created, released when the process crosses MemoryBudgetMB.
+	TArray<TWeakObjectPtr<UPackage>> LoadedPackages;
+	uint64 PeakUsedPhysical = 0;
+	FAssetCsvSyncTableImportResult Result;
+
+	bool Init(const FString& InFilePath, UClass* InDataAssetClass, const FString& AssetFolder, const TArray<FString>& InColumnsToImport, bool bInSavePackages)
+	{
+		if (!InDataAssetClass || !InDataAssetClass->IsChildOf(UDataAsset::StaticClass()))
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: invalid class"));
+			return false;
+		}
+		if (!UAssetCsvSyncCSVHandler::CanExportClass(InDataAssetClass))
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: Class %s is not marked with meta=(CsvExport)"), *InDataAssetClass->GetName());
+			return false;
+		}
+
+		FilePath = InFilePath;
+		DataAssetClass = InDataAssetClass;
+		ColumnsToImport = InColumnsToImport;
+		KeyColumn = UAssetCsvSyncEditorPluginSettings::Get()->TableKeyColumn;
+		bUseSourceStamps = ColumnsToImport.IsEmpty();
+		bSavePackages = bInSavePackages;
+		PeakUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+		Folder = AssetFolder;
+		Folder.TrimStartAndEndInline();
+		Folder.RemoveFromEnd(TEXT("/"));
+
+		if (AssetCsvSync_GetTableFormat(FilePath) == EAssetCsvSyncTableFormat::Csv && !CheckSchemaSidecar(InDataAssetClass))
+			return false;
+
+		// A database holds one table per class; the import reads the tables of the class and its subclasses.
+		if (AssetCsvSync_GetTableFormat(FilePath) == EAssetCsvSyncTableFormat::Sqlite)
+		{
+			IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+			TSet<FTopLevelAssetPath> DerivedClassPaths;
+			AssetRegistry.GetDerivedClassNames({ InDataAssetClass->GetClassPathName() }, TSet<FTopLevelAssetPath>(), DerivedClassPaths);
+			DatabaseClassPaths.Add(InDataAssetClass->GetPathName());
+			for (const FTopLevelAssetPath& DerivedClassPath : DerivedClassPaths)
+			{
+				DatabaseClassPaths.Add(DerivedClassPath.ToString());
+			}
+		}
+		return true;
+	}
+
+	// One file read by Parse: the table itself, or one shard of a manifest.
+	// A JSON Lines file has no header; each record is one line holding a JSON object.
+	// A binary table is opened instead of read into records; database rows are streamed as named cells.
+	struct FSource
+	{
+		struct FCells
+		{
+			TArray<FString> Names;
+			TArray<FString> Values;
+		};
+
+		FString Path;
+		EAssetCsvSyncTableFormat Format = EAssetCsvSyncTableFormat::Csv;
+		TSharedPtr<FAssetCsvSyncBinaryTable, ESPMode::ThreadSafe> BinaryTable;
+		FString HeaderRecord;
+		TArray<FString> Headers;
+		int32 KeyIndex = INDEX_NONE;
+		TArray<FString> Records;
+		TArray<FCells> DatabaseRows;
+
+		int32 NumRecords() const
+		{
+			return BinaryTable ? BinaryTable->NumRows() : Format == EAssetCsvSyncTableFormat::Sqlite ? DatabaseRows.Num() : Records.Num();
+		}
+	};
+
+	bool ReadSource(FSource& Source) const
+	{
+		if (Source.Format == EAssetCsvSyncTableFormat::Binary)
+		{
+			Source.BinaryTable = FAssetCsvSyncBinaryTable::Open(Source.Path, AssetCsvSync_ParallelFor);
+			if (!Source.BinaryTable)
+				return false;
+			Source.KeyIndex = Source.BinaryTable->FindColumn(KeyColumn);
+			if (Source.KeyIndex == INDEX_NONE)
+			{
+				UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: Key column '%s' not found in %s"), *KeyColumn, *Source.Path);
+				return false;
+			}
+			return true;
+		}
+		if (Source.Format == EAssetCsvSyncTableFormat::Sqlite)
+		{
+			return FAssetCsvSyncSqliteReader::ForEachRow(Source.Path, DatabaseClassPaths, [&Source](const TArray<FString>& Names, const TArray<FString>& Values)
+			{
+				FSource::FCells& Cells = Source.DatabaseRows.AddDefaulted_GetRef();
+				Cells.Names = Names;
+				Cells.Values = Values;
+			});
+		}
+
+		FString CSVContent;
+		if (!FFileHelper::LoadFileToString(CSVContent, *Source.Path))
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: Could not load file %s"), *Source.Path);
+			return false;
+		}
+
+		if (Source.Format == EAssetCsvSyncTableFormat::JsonLines)
+		{
+			CSVContent.ParseIntoArrayLines(Source.Records, true);
+			Source.Records.RemoveAll([](const FString& Record) { return Record.TrimStartAndEnd().IsEmpty(); });
+			return true;
+		}
+
+		int32 Pos = 0;
+		if (!UAssetCsvSyncCSVHandler::ReadCSVRecord(CSVContent, Pos, Source.HeaderRecord))
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: CSV file has no header"));
+			return false;
+		}
+		Source.Headers = UAssetCsvSyncCSVHandler::ParseCSVLine(Source.HeaderRecord);
+		Source.KeyIndex = Source.Headers.IndexOfByKey(KeyColumn);
+		if (Source.KeyIndex == INDEX_NONE)
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: Key column '%s' not found in %s"), *KeyColumn, *Source.Path);
+			return false;
+		}
+
+		// Record boundaries depend on quoting, so they are found in order; each record then parses on its own.
+		FString Record;
+		while (UAssetCsvSyncCSVHandler::ReadCSVRecord(CSVContent, Pos, Record))
+		{
+			if (!Record.TrimStartAndEnd().IsEmpty())
+			{
+				Source.Records.Add(MoveTemp(Record));
+			}
+		}
+		return true;
+	}
+
+	bool Parse()
+	{
+		TArray<FSource> Sources;
+		if (AssetCsvSync_IsShardManifest(FilePath))
+		{
+			TArray<FString> ShardPaths;
+			if (!AssetCsvSync_ReadShardManifest(FilePath, ShardPaths))
+				return false;
+			for (FString& ShardPath : ShardPaths)
+			{
+				Sources.AddDefaulted_GetRef().Path = MoveTemp(ShardPath);
+			}
+		}
+		else
+		{
+			Sources.AddDefaulted_GetRef().Path = FilePath;
+		}
+		for (FSource& Source : Sources)
+		{
+			Source.Format = AssetCsvSync_GetTableFormat(Source.Path);
+		}
+
+		// Shards are independent files, so they are loaded and split into records in parallel.
+		TArray<bool> Read;
+		Read.SetNumZeroed(Sources.Num());
+		AssetCsvSync_ParallelFor(Sources.Num(), [this, &Sources, &Read](int32 Index)
+		{
+			Read[Index] = ReadSource(Sources[Index]);
+		});
+		if (Read.Contains(false))
+			return false;
+
+		// Rows are numbered across all shards, in manifest order.
+		TArray<TPair<int32, int32>> RecordRefs;
+		for (int32 SourceIndex = 0; SourceIndex < Sources.Num(); ++SourceIndex)
+		{
+			if (Sources[SourceIndex].BinaryTable)
+			{
+				BinaryTables.Add(Sources[SourceIndex].BinaryTable);
+			}
+			for (int32 RecordIndex = 0; RecordIndex < Sources[SourceIndex].NumRecords(); ++RecordIndex)
+			{
+				RecordRefs.Emplace(SourceIndex, RecordIndex);
+			}
+		}
+
+		Result.Rows = RecordRefs.Num();
+		Rows.SetNum(RecordRefs.Num());
+		AssetCsvSync_ParallelFor(RecordRefs.Num(), [this, &Sources, &RecordRefs](int32 Index)
+		{
+			FRow& Row = Rows[Index];
+			Row.RowNumber = Index + 1;
+			const FSource& Source = Sources[RecordRefs[Index].Key];
+			Row.Format = Source.Format;
+			if (Source.BinaryTable)
+			{
+				ParseBinaryRow(Row, *Source.BinaryTable, Source.KeyIndex, RecordRefs[Index].Value);
+				return;
+			}
+			if (Source.Format == EAssetCsvSyncTableFormat::Sqlite)
+			{
+				ParseDatabaseRow(Row, Source.DatabaseRows[RecordRefs[Index].Value]);
+				return;
+			}
+			const FString& Record = Source.Records[RecordRefs[Index].Value];
+
+			// JSON Lines fields are split without decoding their values; each one is parsed straight into its property when applied.
+			TArray<FString> JsonNames;
+			TArray<FString> Values;
+			FString Key;
+			if (Source.Format == EAssetCsvSyncTableFormat::JsonLines)
+			{
+				if (!FAssetCsvSyncJsonLines::SplitRecord(Record, JsonNames, Values))
+				{
+					UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: Malformed JSON in row %d"), Row.RowNumber);
+					return;
+				}
+				const int32 KeyIndex = JsonNames.IndexOfByKey(KeyColumn);
+				Key = KeyIndex != INDEX_NONE ? FAssetCsvSyncJsonLines::ValueToText(Values[KeyIndex]).TrimStartAndEnd() : FString();
+			}
+			else
+			{
+				Values = UAssetCsvSyncCSVHandler::ParseCSVLine(Record);
+				if (Values.Num() != Source.Headers.Num())
+				{
+					UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: Column count mismatch in row %d"), Row.RowNumber);
+					return;
+				}
+				Key = Values[Source.KeyIndex].TrimStartAndEnd();
+			}
+			if (Key.IsEmpty())
+			{
+				UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: Empty key in row %d"), Row.RowNumber);
+				return;
+			}
+
+			Row.AssetPath = Key.StartsWith(TEXT("/")) ? Key : Folder + TEXT("/") + Key;
+			Row.ColumnToValue = AssetCsvSync_ZipColumns(Source.Format == EAssetCsvSyncTableFormat::JsonLines ? JsonNames : Source.Headers, Values, ColumnsToImport);
+			Row.ColumnToValue.Remove(KeyColumn);
+			if (bUseSourceStamps)
+			{
+				Row.RowHash = FAssetCsvSyncSourceStamp::HashRow(Row.ColumnToValue);
+			}
+		});
+
+		// Rows that failed to parse have no asset path.
+		Result.FailedRows += Rows.RemoveAll([](const FRow& Row) { return Row.AssetPath.IsEmpty(); });
+		if (Schema.IsSet())
+		{
+			ParseTypedColumns();
+			Result.FailedRows += Rows.RemoveAll([](const FRow& Row) { return Row.AssetPath.IsEmpty(); });
+		}
+		return true;
+	}
+
+	// Game thread, before anything is read: a sidecar naming only loaded classes outside DataAssetClass rejects the
+	// table. Its column types are used only while every class still has the fingerprint it was exported with; the
+	// columns of those classes are then bound from their binding plans up front instead of being learned by name
+	// while the first rows are applied, so every batch is pre-parsed.
+	bool CheckSchemaSidecar(UClass* InDataAssetClass)
+	{
+		FAssetCsvSyncSchemaSidecar Sidecar;
+		if (!Sidecar.Load(FilePath))
+			return true;
+
+		bool bRelated = Sidecar.ClassSchemas.IsEmpty();
+		bool bUnchanged = true;
+		for (const TPair<FString, FString>& Pair : Sidecar.ClassSchemas)
+		{
+			UClass* Class = FindObject<UClass>(nullptr, *Pair.Key);
+			bRelated |= !Class || Class->IsChildOf(InDataAssetClass);
+			bUnchanged &= Class && FAssetCsvSyncSourceStamp::GetSchema(Class) == Pair.Value;
+		}
+		if (!bRelated)
+		{
+			TArray<FString> ClassPaths;
+			Sidecar.ClassSchemas.GetKeys(ClassPaths);
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: %s was exported from %s, not from %s or a subclass"),
+				*FilePath, *FString::Join(ClassPaths, TEXT(", ")), *InDataAssetClass->GetPathName());
+			return false;
+		}
+		if (!bUnchanged)
+		{
+			UE_LOG(LogAssetCsvSync, Log, TEXT("ImportCSVTableToDataAssets: Class schema changed since %s was exported; its schema sidecar is ignored"), *FilePath);
+			return true;
+		}
+
+		for (const TPair<FString, FString>& Pair : Sidecar.ClassSchemas)
+		{
+			UClass* Class = FindObject<UClass>(nullptr, *Pair.Key);
+			UAssetCsvSyncCSVHandler::GetBindingPlan(Class, &ColumnPropertiesByClass.FindOrAdd(Class));
+		}
+		UE_LOG(LogAssetCsvSync, Verbose, TEXT("ImportCSVTableToDataAssets: Schema fingerprints of %s match; %d class(es) bound from their binding plans"),
+			*FilePath, Sidecar.ClassSchemas.Num());
+
+		Sidecar.ResolveEnums();
+		Schema = MoveTemp(Sidecar);
+		return true;
 	}
 
-	if (!ApplyCSVRowToObject(NewDataAsset, DataAssetClass, ColumnHeaders, Values))
+	// Workers, one column each: converts every cell of the sidecar's columns up front. A row with a cell that
+	// does not convert is rejected here, before its asset is loaded.
+	void ParseTypedColumns()
 	{
-		return false;
-	}
-
-	OutDataAsset = NewDataAsset;
-	return true;
-}
+		TArray<const TPair<FString, FAssetCsvSyncSchemaSidecar::FColumn>*> Columns;
+		for (const TPair<FString, FAssetCsvSyncSchemaSidecar::FColumn>& Pair : Schema->Columns)
+		{
+			if (Pair.Key != KeyColumn && (ColumnsToImport.IsEmpty() || ColumnsToImport.Contains(Pair.Key)))
+			{
+				Columns.Add(&Pair);
+				TypedColumns.Add(Pair.Key);
+			}
+		}
+		for (int32 Index = 0; Index < Rows.Num(); ++Index)
+		{
+			Rows[Index].TypedRow = Index;
+		}
 
-bool UAssetCsvSyncCSVHandler::ImportCSVToNewDataAsset(const FString& FilePath, const FString& AssetPath, UClass* DataAssetClass, UDataAsset*& OutDataAsset, bool bSavePackage)
-{
-	OutDataAsset = nullptr;
+		TArray<TArray<int32>> InvalidRows;
+		InvalidRows.SetNum(Columns.Num());
+		AssetCsvSync_ParallelFor(Columns.Num(), [this, &Columns, &InvalidRows](int32 Index)
+		{
+			const FString& Column = Columns[Index]->Key;
+			TypedColumns.FindChecked(Column).ParseColumn(Columns[Index]->Value, Rows.Num(), [this, &Column](int32 Row) { return Rows[Row].ColumnToValue.Find(Column); }, InvalidRows[Index]);
+		});
 
-	if (!DataAssetClass || !DataAssetClass->IsChildOf(UDataAsset::StaticClass()))
-	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: invalid class"));
-		return false;
-	}
-	if (!CanExportClass(DataAssetClass))
-	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: Class %s is not marked with meta=(CsvExport)"), *DataAssetClass->GetName());
-		return false;
+		for (int32 Index = 0; Index < Columns.Num(); ++Index)
+		{
+			const FString& Column = Columns[Index]->Key;
+			for (int32 RowIndex : InvalidRows[Index])
+			{
+				FRow& Row = Rows[RowIndex];
+				UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: Row %d column '%s': '%s' is not a valid %s"),
+					Row.RowNumber, *Column, *Row.ColumnToValue.FindChecked(Column), FAssetCsvSyncTypedColumn::GetConverterName(Columns[Index]->Value.Converter));
+				Row.AssetPath.Reset();
+			}
+		}
 	}
 
-	FString PackageName;
-	FString AssetName;
-	if (!SplitAssetPath(AssetPath, PackageName, AssetName))
+	// Database cells hold CSV cell text, so they apply like CSV cells; NULL cells were already left out.
+	void ParseDatabaseRow(FRow& Row, const FSource::FCells& Cells) const
 	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: invalid AssetPath %s"), *AssetPath);
-		return false;
+		const int32 KeyIndex = Cells.Names.IndexOfByKey(KeyColumn);
+		const FString Key = KeyIndex != INDEX_NONE ? Cells.Values[KeyIndex].TrimStartAndEnd() : FString();
+		if (Key.IsEmpty())
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: Empty key in row %d"), Row.RowNumber);
+			return;
+		}
+
+		Row.AssetPath = Key.StartsWith(TEXT("/")) ? Key : Folder + TEXT("/") + Key;
+		Row.ColumnToValue = AssetCsvSync_ZipColumns(Cells.Names, Cells.Values, ColumnsToImport);
+		Row.ColumnToValue.Remove(KeyColumn);
+		if (bUseSourceStamps)
+		{
+			Row.RowHash = FAssetCsvSyncSourceStamp::HashRow(Row.ColumnToValue);
+		}
 	}
-	const FString ObjectPath = PackageName + TEXT(".") + AssetName;
 
-	// If an asset already exists at the path, update it in-place.
-	if (UObject* ExistingObj = StaticLoadObject(UObject::StaticClass(), nullptr, *ObjectPath))
+	// Absent cells are left out, like null JSON Lines fields.
+	void ParseBinaryRow(FRow& Row, const FAssetCsvSyncBinaryTable& Table, int32 KeyIndex, int32 TableRow) const
 	{
-		UDataAsset* ExistingAsset = Cast<UDataAsset>(ExistingObj);
-		if (!ExistingAsset)
+		const FString Key = Table.IsSet(KeyIndex, TableRow) ? Table.GetText(KeyIndex, TableRow).TrimStartAndEnd() : FString();
+		if (Key.IsEmpty())
 		{
-			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: existing object is not a DataAsset: %s"), *ObjectPath);
-			return false;
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: Empty key in row %d"), Row.RowNumber);
+			return;
 		}
-		if (!ExistingAsset->IsA(DataAssetClass))
+
+		Row.AssetPath = Key.StartsWith(TEXT("/")) ? Key : Folder + TEXT("/") + Key;
+		Row.BinaryTable = &Table;
+		Row.BinaryRow = TableRow;
+		// Values are read from the table when applied; the stamp hashes them as text, like CSV cells.
+		TMap<FString, FString> CellText;
+		for (int32 Column = 0; Column < Table.NumColumns(); ++Column)
 		{
-			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: existing asset class mismatch. Existing=%s Expected=%s (%s)"), *ExistingAsset->GetClass()->GetName(), *DataAssetClass->GetName(), *ObjectPath);
-			return false;
+			const FString& Name = Table.GetColumnName(Column);
+			if (Column == KeyIndex || !Table.IsSet(Column, TableRow))
+				continue;
+			if (ColumnsToImport.Num() > 0 && !ColumnsToImport.Contains(Name))
+				continue;
+			Row.ColumnToValue.Add(Name);
+			if (bUseSourceStamps)
+			{
+				CellText.Add(Name, Table.GetText(Column, TableRow));
+			}
 		}
-
-		FString CSVContent;
-		if (!FFileHelper::LoadFileToString(CSVContent, *FilePath))
+		if (bUseSourceStamps)
 		{
-			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: Could not load file %s"), *FilePath);
-			return false;
+			Row.RowHash = FAssetCsvSyncSourceStamp::HashRow(CellText);
 		}
-		TArray<FString> Lines;
-		CSVContent.ParseIntoArrayLines(Lines, false);
-		if (Lines.Num() < 2)
+	}
+
+	// Applies the next RowsPerBatch rows:
+	// 1) game thread: skip rows whose source stamp matches, resolve/create the other rows' assets,
+	// 2) workers: parse the cells whose property is known for the asset's class into staged values,
+	// 3) game thread: apply the rows, which only compares and copies staged values.
+	// Column -> property is learned per class while applying, so the first row of each class is parsed inline.
+	// Returns false once every row has been applied.
+	bool ApplyNextBatch(int32 MaxRows = RowsPerBatch)
+	{
+		if (NextRow > 0 && UAssetCsvSyncCSVHandler::IsOverMemoryBudget())
 		{
-			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: CSV file has insufficient data"));
-			return false;
+			ReleaseMemory();
 		}
-		TArray<FString> ColumnHeaders = ParseCSVLine(Lines[0]);
-		TArray<FString> Values = ParseCSVLine(Lines[1]);
-		if (ColumnHeaders.Num() != Values.Num())
+
+		const double BatchStart = FPlatformTime::Seconds();
+		const int32 FirstRow = NextRow;
+		ON_SCOPE_EXIT
+		{
+			if (NextRow > FirstRow)
+			{
+				const double Sample = (FPlatformTime::Seconds() - BatchStart) / (NextRow - FirstRow);
+				AverageRowSeconds = AverageRowSeconds > 0.0 ? AverageRowSeconds * 0.8 + Sample * 0.2 : Sample;
+			}
+		};
+
+		UClass* Class = DataAssetClass.Get();
+		if (!Class)
 		{
-			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: Column count mismatch"));
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: class was unloaded, %d rows not applied"), Rows.Num() - NextRow);
+			Result.FailedRows += Rows.Num() - NextRow;
+			NextRow = Rows.Num();
 			return false;
 		}
 
-		UE_LOG(LogAssetCsvSync, Log, TEXT("ImportCSVToNewDataAsset: Updating existing asset %s"), *ObjectPath);
+		struct FPendingRow
+		{
+			FRow* Row = nullptr;
+			UDataAsset* DataAsset = nullptr;
+			bool bCreated = false;
+			FAssetCsvSyncStagedRow Staged;
+		};
+
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		TArray<FPendingRow> Batch;
+		Batch.Reserve(RowsPerBatch);
+		for (const int32 BatchEnd = FMath::Min(NextRow + FMath::Clamp(MaxRows, 1, RowsPerBatch), Rows.Num()); NextRow < BatchEnd; ++NextRow)
 		{
-			FScopedTransaction Transaction(FText::FromString(TEXT("Import CSV to Data Asset")));
-			ExistingAsset->Modify();
+			FRow& Row = Rows[NextRow];
 
-			if (!ApplyCSVRowToObject(ExistingAsset, ExistingAsset->GetClass(), ColumnHeaders, Values))
+			FString PackageName;
+			FString AssetName;
+			const bool bValidPath = UAssetCsvSyncCSVHandler::SplitAssetPath(Row.AssetPath, PackageName, AssetName);
+
+			// Compared against the registry before the asset is loaded.
+			if (bUseSourceStamps)
 			{
-				return false;
+				if (bValidPath)
+				{
+					const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(PackageName + TEXT(".") + AssetName));
+					UClass* AssetClass = AssetData.IsValid() ? AssetData.GetClass() : nullptr;
+					if (AssetClass && AssetClass->IsChildOf(Class) && FAssetCsvSyncSourceStamp::IsUpToDate(AssetData, Row.RowHash, GetSchema(AssetClass)))
+					{
+						++Result.AssetsUpToDate;
+						Row.ColumnToValue.Empty();
+						continue;
+					}
+				}
+			}
+
+			const bool bWasLoaded = bValidPath && FindPackage(nullptr, *PackageName) != nullptr;
+			bool bCreated = false;
+			UDataAsset* DataAsset = UAssetCsvSyncCSVHandler::FindOrCreateTableAsset(Row.AssetPath, Class, bCreated);
+			if (!DataAsset)
+			{
+				++Result.FailedRows;
+				continue;
+			}
+			if (!bWasLoaded)
+			{
+				LoadedPackages.Add(DataAsset->GetPackage());
 			}
 
-			ExistingAsset->MarkPackageDirty();
-			ExistingAsset->PostEditChange();
+			FPendingRow& Pending = Batch.AddDefaulted_GetRef();
+			Pending.Row = &Row;
+			Pending.DataAsset = DataAsset;
+			Pending.bCreated = bCreated;
+			Pending.Staged.Format = Row.Format;
+			Pending.Staged.BinaryTable = Row.BinaryTable;
+			Pending.Staged.BinaryRow = Row.BinaryRow;
+			Pending.Staged.TypedColumns = TypedColumns.IsEmpty() ? nullptr : &TypedColumns;
+			Pending.Staged.TypedRow = Row.TypedRow;
 		}
 
-		if (bSavePackage)
+		AssetCsvSync_ParallelFor(Batch.Num(), [this, &Batch](int32 Index)
+		{
+			FPendingRow& Pending = Batch[Index];
+			const TMap<FString, FProperty*>* Learned = ColumnPropertiesByClass.Find(Pending.DataAsset->GetClass());
+			if (!Learned)
+				return;
+			for (const TPair<FString, FString>& Pair : Pending.Row->ColumnToValue)
+			{
+				FProperty* const* Property = Learned->Find(Pair.Key);
+				if (!Property || !AssetCsvSync_CanParseOffGameThread(*Property))
+					continue;
+				TUniquePtr<FAssetCsvSyncScratchValue> Value = MakeUnique<FAssetCsvSyncScratchValue>(*Property);
+				if (UAssetCsvSyncCSVHandler::ParseCell(*Property, Value->Data, Pair.Key, Pair.Value, &Pending.Staged))
+				{
+					Pending.Staged.Values.Add(Pair.Key, MoveTemp(Value));
+				}
+			}
+		});
+
+		TArray<UPackage*> BatchPackages;
+		for (FPendingRow& Pending : Batch)
+		{
+			Pending.Staged.LearnedColumns = &ColumnPropertiesByClass.FindOrAdd(Pending.DataAsset->GetClass());
+
+			FAssetCsvSyncImportResult RowResult;
+			const bool bApplied = UAssetCsvSyncCSVHandler::ApplyColumnsToDataAsset(Pending.DataAsset, Pending.Row->ColumnToValue, BatchPackages, FText::FromString(TEXT("Import CSV Row to Data Asset")), RowResult, &Pending.Staged);
+			Pending.Row->ColumnToValue.Empty();
+			if (!bApplied)
+			{
+				UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: Failed to apply row %d to %s"), Pending.Row->RowNumber, *Pending.DataAsset->GetPathName());
+				++Result.FailedRows;
+				continue;
+			}
+
+			// A freshly created asset is saved even when the row only contains default values. The stamp rides along
+			// with saves the import makes anyway, including an unchanged asset whose package is saved for another
+			// row. Other unchanged assets are only stamped, and then saved, by a restamp pass.
+			UPackage* Package = Pending.DataAsset->GetPackage();
+			if (Pending.bCreated)
+			{
+				BatchPackages.AddUnique(Package);
+			}
+			if (bUseSourceStamps)
+			{
+				const bool bUnchanged = !Pending.bCreated && RowResult.ChangedColumns == 0;
+				const bool bSavedAnyway = BatchPackages.Contains(Package) || PackagesToSave.Contains(Package);
+				if (!bUnchanged || bSavedAnyway || bRestampUnchanged)
+				{
+					FAssetCsvSyncSourceStamp::Stamp(Pending.DataAsset, Pending.Row->RowHash, GetSchema(Pending.DataAsset->GetClass()));
+				}
+				if (bUnchanged && (bSavedAnyway || bRestampUnchanged))
+				{
+					BatchPackages.AddUnique(Package);
+					++Result.AssetsRestamped;
+				}
+			}
+
+			Result.AssetsCreated += Pending.bCreated ? 1 : 0;
+			Result.AssetsChanged += RowResult.ChangedColumns > 0 ? 1 : 0;
+			Result.ChangedColumns += RowResult.ChangedColumns;
+		}
+		for (UPackage* Package : BatchPackages)
 		{
-			SaveCreatedAsset(ExistingAsset->GetPackage(), ExistingAsset);
+			PackagesToSave.AddUnique(Package);
 		}
-		OutDataAsset = ExistingAsset;
-		return true;
+
+		PeakUsedPhysical = FMath::Max<uint64>(PeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical);
+		return NextRow < Rows.Num();
 	}
 
-	UDataAsset* NewAsset = nullptr;
-	if (!CreateNewDataAssetAsset(AssetPath, DataAssetClass, NewAsset, false))
+	float GetProgress() const
 	{
-		return false;
+		return Rows.IsEmpty() ? 1.0f : float(NextRow) / Rows.Num();
 	}
 
-	FString CSVContent;
-	if (!FFileHelper::LoadFileToString(CSVContent, *FilePath))
+	// How many rows fit into the given game-thread time, judging by the rows applied so far.
+	int32 RowsForBudget(double SecondsLeft) const
 	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: Could not load file %s"), *FilePath);
-		return false;
+		if (AverageRowSeconds <= 0.0)
+			return 1;
+		return FMath::Clamp(FMath::FloorToInt32(SecondsLeft / AverageRowSeconds), 1, RowsPerBatch);
 	}
 
-	TArray<FString> Lines;
-	CSVContent.ParseIntoArrayLines(Lines, false);
-	if (Lines.Num() < 2)
+	// Saves the packages touched since the last save.
+	void Save()
 	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: CSV file has insufficient data"));
-		return false;
+		TArray<UPackage*> Packages;
+		Packages.Reserve(PackagesToSave.Num());
+		for (const TWeakObjectPtr<UPackage>& Package : PackagesToSave)
+		{
+			if (Package.IsValid())
+			{
+				Packages.Add(Package.Get());
+			}
+		}
+		PackagesToSave.Reset();
+		Result.PackagesSaved += UAssetCsvSyncCSVHandler::SavePackages(Packages);
 	}
 
-	TArray<FString> ColumnHeaders = ParseCSVLine(Lines[0]);
-	TArray<FString> Values = ParseCSVLine(Lines[1]);
-	if (ColumnHeaders.Num() != Values.Num())
+	// Saves what is pending (when saving at all), then lets the packages loaded so far be collected.
+	// Unsaved changes keep their packages. Undo is off while a budget is set (ShouldRecordImportUndo), so the
+	// transaction buffer holds none of them.
+	void ReleaseMemory()
 	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVToNewDataAsset: Column count mismatch"));
-		return false;
+		if (bSavePackages)
+		{
+			Save();
+		}
+		UAssetCsvSyncCSVHandler::ReleasePackagesAndCollect(LoadedPackages);
+		LoadedPackages.RemoveAll([](const TWeakObjectPtr<UPackage>& Package) { return !Package.IsValid(); });
+		++Result.GarbageCollections;
 	}
 
+	void LogSummary()
 	{
-		FScopedTransaction Transaction(FText::FromString(TEXT("Import CSV to New Data Asset")));
-		NewAsset->Modify();
+		Result.PeakUsedPhysicalMB = PeakUsedPhysical / (1024.0 * 1024.0);
+		UE_LOG(LogAssetCsvSync, Log, TEXT("ImportCSVTableToDataAssets: %d rows, %d up to date, %d created, %d changed, %d restamped, %d saved, %d failed, peak %.1f MB used, %d GC pass(es) (%s)"),
+			Result.Rows, Result.AssetsUpToDate, Result.AssetsCreated, Result.AssetsChanged, Result.AssetsRestamped, Result.PackagesSaved, Result.FailedRows, Result.PeakUsedPhysicalMB, Result.GarbageCollections, *FilePath);
+	}
+
+private:
+	const FString& GetSchema(UClass* Class)
+	{
+		if (const FString* Found = SchemaByClass.Find(Class))
+			return *Found;
+		return SchemaByClass.Add(Class, FAssetCsvSyncSourceStamp::GetSchema(Class));
+	}
+};
+
+static bool AssetCsvSync_ImportTable(const FString& FilePath, UClass* DataAssetClass, const FString& AssetFolder, const TArray<FString>& ColumnsToImport, bool bSavePackage, bool bRestampUnchanged, FAssetCsvSyncTableImportResult& OutResult)
+{
+	OutResult = FAssetCsvSyncTableImportResult();
+
+	FAssetCsvSyncTableImport Import;
+	if (!Import.Init(FilePath, DataAssetClass, AssetFolder, ColumnsToImport, bSavePackage) || !Import.Parse())
+		return false;
+	Import.bRestampUnchanged = bRestampUnchanged;
 
-		if (!ApplyCSVRowToObject(NewAsset, DataAssetClass, ColumnHeaders, Values))
+	{
+		// One undo step for the whole table when undo is recorded; every row's transaction nests into it.
+		FAssetCsvSyncBulkImportScope BulkImport;
+		FScopedTransaction Transaction(FText::FromString(TEXT("Import CSV Table to Data Assets")), UAssetCsvSyncCSVHandler::ShouldRecordImportUndo());
+		while (Import.ApplyNextBatch())
 		{
-			return false;
 		}
-
-		NewAsset->MarkPackageDirty();
-		NewAsset->PostEditChange();
 	}
 
 	if (bSavePackage)
 	{
-		SaveCreatedAsset(NewAsset->GetPackage(), NewAsset);
+		Import.Save();
 	}
 
-	OutDataAsset = NewAsset;
-	return true;
+	Import.LogSummary();
+	OutResult = Import.Result;
+	return OutResult.FailedRows == 0;
+}
+
+bool UAssetCsvSyncCSVHandler::ImportCSVTableToDataAssets(const FString& FilePath, UClass* DataAssetClass, const FString& AssetFolder, const TArray<FString>& ColumnsToImport, bool bSavePackage, FAssetCsvSyncTableImportResult& OutResult)
+{
+	return AssetCsvSync_ImportTable(FilePath, DataAssetClass, AssetFolder, ColumnsToImport, bSavePackage, false, OutResult);
+}
+
+bool UAssetCsvSyncCSVHandler::RestampCSVTableAssets(const FString& FilePath, UClass* DataAssetClass, const FString& AssetFolder, bool bSavePackage, FAssetCsvSyncTableImportResult& OutResult)
+{
+	return AssetCsvSync_ImportTable(FilePath, DataAssetClass, AssetFolder, TArray<FString>(), bSavePackage, true, OutResult);
+}
+
+TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> UAssetCsvSyncCSVHandler::MakeTableImportJob(const FString& FilePath, UClass* DataAssetClass, const FString& AssetFolder, const TArray<FString>& ColumnsToImport, bool bSavePackage, TFunction<void(EAssetCsvSyncJobResult, const FAssetCsvSyncTableImportResult&)> OnComplete)
+{
+	TSharedRef<FAssetCsvSyncTableImport, ESPMode::ThreadSafe> Import = MakeShared<FAssetCsvSyncTableImport, ESPMode::ThreadSafe>();
+	const bool bValid = Import->Init(FilePath, DataAssetClass, AssetFolder, ColumnsToImport, bSavePackage);
+	TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> Job = MakeShared<FAssetCsvSyncJob, ESPMode::ThreadSafe>(FText::FromString(FString::Printf(TEXT("Import %s"), *FPaths::GetCleanFilename(FilePath))));
+
+	Job->AddBackgroundStage([Import, bValid](FAssetCsvSyncJob& InJob)
+	{
+		InJob.SetProgress(0.0f, FText::FromString(TEXT("Reading CSV")));
+		return bValid && Import->Parse();
+	})
+	.AddGameThreadStage([Import](FAssetCsvSyncJob& InJob)
+	{
+		// Each batch is one undo step that closes before the step returns. A transaction left open across ticks
+		// would take in the user's own edits between them and hold off undo until the job ends.
+		// Batches are sized to what is left of this tick's budget; the queue keeps stepping until it is spent.
+		bool bMore = false;
+		{
+			FAssetCsvSyncBulkImportScope BulkImport;
+			FScopedTransaction Transaction(FText::FromString(TEXT("Import CSV Table to Data Assets")), ShouldRecordImportUndo());
+			bMore = Import->ApplyNextBatch(Import->RowsForBudget(InJob.GetSliceSecondsLeft()));
+		}
+		InJob.SetProgress(Import->GetProgress(), FText::FromString(FString::Printf(TEXT("%d of %d rows"), Import->NextRow, Import->Rows.Num())));
+		return bMore ? EAssetCsvSyncStepResult::Continue : EAssetCsvSyncStepResult::Done;
+	});
+	if (bSavePackage)
+	{
+		Job->AddGameThreadStage([Import](FAssetCsvSyncJob& InJob)
+		{
+			InJob.SetProgress(1.0f, FText::FromString(TEXT("Saving")));
+			Import->Save();
+			return EAssetCsvSyncStepResult::Done;
+		});
+	}
+	Job->OnFinished([Import, OnComplete](EAssetCsvSyncJobResult JobResult)
+	{
+		Import->LogSummary();
+		if (OnComplete)
+		{
+			OnComplete(JobResult, Import->Result);
+		}
+	});
+	return Job;
 }
 
 bool UAssetCsvSyncCSVHandler::CreateNewDataAssetAsset(const FString& AssetPath, UClass* DataAssetClass, UDataAsset*& OutDataAsset, bool bSavePackage)
@@ -512,25 +2854,53 @@ bool UAssetCsvSyncCSVHandler::CreateNewDataAssetAsset(const FString& AssetPath,
 	return true;
 }
 
-TArray<FString> UAssetCsvSyncCSVHandler::GetExportableDataAssetClasses()
+UDataAsset* UAssetCsvSyncCSVHandler::FindOrCreateTableAsset(const FString& AssetPath, UClass* DataAssetClass, bool& bOutCreated)
 {
-	TArray<FString> Result;
-	for (TObjectIterator<UClass> It; It; ++It)
+	bOutCreated = false;
+
+	FString PackageName;
+	FString AssetName;
+	if (!SplitAssetPath(AssetPath, PackageName, AssetName))
 	{
-		UClass* Class = *It;
-		if (!Class)
-			continue;
-		if (!Class->IsChildOf(UDataAsset::StaticClass()))
-			continue;
-		if (Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
-			continue;
-		if (CanExportClass(Class))
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: invalid AssetPath %s"), *AssetPath);
+		return nullptr;
+	}
+	const FString ObjectPath = PackageName + TEXT(".") + AssetName;
+
+	UObject* ExistingObj = FindObject<UObject>(nullptr, *ObjectPath);
+	if (!ExistingObj)
+	{
+		// Only hit the loader for assets the registry knows about; new keys go straight to creation.
+		FAssetRegistryModule& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+		if (AssetRegistry.Get().GetAssetByObjectPath(FSoftObjectPath(ObjectPath)).IsValid())
 		{
-			Result.Add(Class->GetPathName());
+			ExistingObj = StaticLoadObject(UObject::StaticClass(), nullptr, *ObjectPath);
 		}
 	}
-	Result.Sort();
-	return Result;
+
+	if (ExistingObj)
+	{
+		UDataAsset* ExistingAsset = Cast<UDataAsset>(ExistingObj);
+		if (!ExistingAsset || !ExistingAsset->IsA(DataAssetClass))
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: existing asset class mismatch. Existing=%s Expected=%s (%s)"), *ExistingObj->GetClass()->GetName(), *DataAssetClass->GetName(), *ObjectPath);
+			return nullptr;
+		}
+		return ExistingAsset;
+	}
+
+	UDataAsset* NewAsset = nullptr;
+	if (!CreateNewDataAssetAsset(AssetPath, DataAssetClass, NewAsset, false))
+	{
+		return nullptr;
+	}
+	bOutCreated = true;
+	return NewAsset;
+}
+
+TArray<FString> UAssetCsvSyncCSVHandler::GetExportableDataAssetClasses()
+{
+	return FAssetCsvSyncClassIndex::GetExportableClassPaths();
 }
 
 bool UAssetCsvSyncCSVHandler::SplitAssetPath(const FString& InAssetPath, FString& OutPackageName, FString& OutAssetName)
@@ -576,12 +2946,159 @@ bool UAssetCsvSyncCSVHandler::SaveCreatedAsset(UPackage* Package, UObject* Asset
 	SaveArgs.SaveFlags = SAVE_None;
 	SaveArgs.Error = GError;
 
-	const bool bOk = UPackage::SavePackage(Package, AssetObject, *Filename, SaveArgs);
-	if (!bOk)
+	const bool bOk = UPackage::SavePackage(Package, AssetObject, *Filename, SaveArgs);
+	if (!bOk)
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("SavePackage failed: %s"), *Filename);
+	}
+	return bOk;
+}
+
+int32 UAssetCsvSyncCSVHandler::SavePackages(const TArray<UPackage*>& Packages)
+{
+	TArray<UPackage*> ToSave;
+	ToSave.Reserve(Packages.Num());
+	for (UPackage* Package : Packages)
+	{
+		if (Package && Package != GetTransientPackage())
+		{
+			ToSave.AddUnique(Package);
+		}
+	}
+	if (ToSave.IsEmpty())
+		return 0;
+
+	FScopedSlowTask SlowTask(2.0f + ToSave.Num(), FText::Format(FText::FromString(TEXT("Saving {0} imported asset(s)...")), FText::AsNumber(ToSave.Num())));
+	SlowTask.MakeDialogDelayed(0.5f);
+
+	// One source control pass for the whole batch instead of a checkout per asset.
+	SlowTask.EnterProgressFrame(1.0f, FText::FromString(TEXT("Checking out packages...")));
+	if (ISourceControlModule::Get().IsEnabled())
+	{
+		FEditorFileUtils::CheckoutPackages(ToSave, nullptr, false, false);
+	}
+
+	TArray<FPackageSaveInfo> SaveInfos;
+	SaveInfos.Reserve(ToSave.Num());
+	for (UPackage* Package : ToSave)
+	{
+		const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+		if (IFileManager::Get().IsReadOnly(*Filename))
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("SavePackages: %s is read-only (not checked out?)"), *Filename);
+			continue;
+		}
+		FPackageSaveInfo& Info = SaveInfos.AddDefaulted_GetRef();
+		Info.Package = Package;
+		Info.Filename = Filename;
+	}
+
+	int32 NumSaved = 0;
+	if (UAssetCsvSyncEditorPluginSettings::Get()->bConcurrentPackageSave && SaveInfos.Num() > 1)
+	{
+		SlowTask.EnterProgressFrame(1.0f + ToSave.Num(), FText::FromString(TEXT("Saving packages concurrently...")));
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_None;
+		SaveArgs.Error = GError;
+
+		TArray<FSavePackageResultStruct> Results;
+		UPackage::SaveConcurrent(SaveInfos, SaveArgs, Results);
+		for (int32 Index = 0; Index < Results.Num() && Index < SaveInfos.Num(); ++Index)
+		{
+			if (Results[Index].IsSuccessful())
+			{
+				SaveInfos[Index].Package->SetDirtyFlag(false);
+				++NumSaved;
+			}
+			else
+			{
+				UE_LOG(LogAssetCsvSync, Error, TEXT("SavePackage failed: %s"), *SaveInfos[Index].Filename);
+			}
+		}
+	}
+	else
+	{
+		SlowTask.EnterProgressFrame(1.0f);
+		for (const FPackageSaveInfo& Info : SaveInfos)
+		{
+			SlowTask.EnterProgressFrame(1.0f, FText::FromString(Info.Package->GetName()));
+			NumSaved += SaveCreatedAsset(Info.Package, Info.Package->FindAssetInPackage()) ? 1 : 0;
+		}
+	}
+
+	UE_LOG(LogAssetCsvSync, Log, TEXT("SavePackages: saved %d of %d package(s)"), NumSaved, ToSave.Num());
+	return NumSaved;
+}
+
+bool UAssetCsvSyncCSVHandler::IsOverMemoryBudget()
+{
+	const int32 BudgetMB = UAssetCsvSyncEditorPluginSettings::Get()->MemoryBudgetMB;
+	return BudgetMB > 0 && GetUsedPhysicalMB() > BudgetMB;
+}
+
+static int32 AssetCsvSync_BulkImportDepth = 0;
+
+FAssetCsvSyncBulkImportScope::FAssetCsvSyncBulkImportScope()
+{
+	check(IsInGameThread());
+	if (AssetCsvSync_BulkImportDepth++ == 0)
+	{
+		const UAssetCsvSyncEditorPluginSettings* Settings = UAssetCsvSyncEditorPluginSettings::Get();
+		if (Settings->bRecordImportUndo && Settings->MemoryBudgetMB > 0)
+		{
+			UE_LOG(LogAssetCsvSync, Warning, TEXT("Bulk import: undo is not recorded while MemoryBudgetMB is set (%d MB); set it to 0 to record undo"), Settings->MemoryBudgetMB);
+		}
+	}
+}
+
+FAssetCsvSyncBulkImportScope::~FAssetCsvSyncBulkImportScope()
+{
+	--AssetCsvSync_BulkImportDepth;
+}
+
+bool FAssetCsvSyncBulkImportScope::IsActive()
+{
+	return AssetCsvSync_BulkImportDepth > 0;
+}
+
+bool UAssetCsvSyncCSVHandler::ShouldRecordImportUndo()
+{
+	const UAssetCsvSyncEditorPluginSettings* Settings = UAssetCsvSyncEditorPluginSettings::Get();
+	return Settings->bRecordImportUndo && !(FAssetCsvSyncBulkImportScope::IsActive() && Settings->MemoryBudgetMB > 0);
+}
+
+double UAssetCsvSyncCSVHandler::GetUsedPhysicalMB()
+{
+	return FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+}
+
+void UAssetCsvSyncCSVHandler::ReleasePackagesAndCollect(const TArray<TWeakObjectPtr<UPackage>>& Packages)
+{
+	UAssetEditorSubsystem* AssetEditors = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr;
+	int32 NumReleased = 0;
+	for (const TWeakObjectPtr<UPackage>& WeakPackage : Packages)
 	{
-		UE_LOG(LogAssetCsvSync, Error, TEXT("SavePackage failed: %s"), *Filename);
+		UPackage* Package = WeakPackage.Get();
+		if (!Package || Package->IsDirty() || Package == GetTransientPackage())
+			continue;
+		UObject* Asset = Package->FindAssetInPackage();
+		if (Asset && AssetEditors && AssetEditors->FindEditorsForAsset(Asset).Num() > 0)
+			continue;
+
+		// Loaded assets are RF_Standalone, which keeps them alive through GC even when nothing references them.
+		ForEachObjectWithPackage(Package, [](UObject* Object)
+		{
+			Object->ClearFlags(RF_Standalone);
+			return true;
+		}, false);
+		++NumReleased;
 	}
-	return bOk;
+
+	const double BeforeMB = GetUsedPhysicalMB();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	UE_LOG(LogAssetCsvSync, Log, TEXT("ReleasePackagesAndCollect: released %d of %d package(s), %.0f MB -> %.0f MB"), NumReleased, Packages.Num(), BeforeMB, GetUsedPhysicalMB());
 }
 
 TArray<FString> UAssetCsvSyncCSVHandler::GetExportableProperties(UClass* Class)
@@ -592,6 +3109,79 @@ TArray<FString> UAssetCsvSyncCSVHandler::GetExportableProperties(UClass* Class)
 	return ColumnOrder;
 }
 
+TArray<FString> UAssetCsvSyncCSVHandler::GetBindingPlan(UClass* Class, TMap<FString, FProperty*>* OutColumnProperties)
+{
+	TArray<FString> Plan;
+	TArray<const UStruct*> Stack;
+	AppendBindingPlan(Class, FString(), Plan, OutColumnProperties, Stack);
+	Plan.Sort();
+	return Plan;
+}
+
+static FString AssetCsvSync_GetPropertyType(const FProperty* Property)
+{
+	FString ExtendedType;
+	const FString Type = Property->GetCPPType(&ExtendedType);
+	return Type + ExtendedType;
+}
+
+// Walks a class or struct the way ExportClassColumnsEmpty and ExportStructColumnsEmpty do. Stack holds the types
+// being walked, so a type that expands into itself is not walked again.
+void UAssetCsvSyncCSVHandler::AppendBindingPlan(UStruct* Struct, const FString& Prefix, TArray<FString>& OutPlan, TMap<FString, FProperty*>* OutColumnProperties, TArray<const UStruct*>& Stack)
+{
+	if (!Struct || Stack.Contains(Struct))
+		return;
+	const bool bIsClass = Struct->IsA<UClass>();
+	Stack.Push(Struct);
+
+	for (TFieldIterator<FProperty> It(Struct, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		FProperty* Property = *It;
+		if (!Property)
+			continue;
+
+		// Struct fields are columns unless they are only expanded; class properties need CsvColumn.
+		const bool bColumn = FExportableMetaData::HasCsvColumn(Property) || (!bIsClass && !FExportableMetaData::HasCsvExpand(Property));
+		if (bColumn)
+		{
+			const FString ColumnKey = FExportableMetaData::HasCsvColumn(Property) ? FExportableMetaData::GetCsvColumn(Property) : FString();
+			const FString ColumnName = Prefix + (!ColumnKey.IsEmpty() ? ColumnKey : Property->GetName());
+			OutPlan.Add(ColumnName + TEXT(":") + AssetCsvSync_GetPropertyType(Property));
+			if (OutColumnProperties)
+			{
+				OutColumnProperties->Add(ColumnName, Property);
+			}
+		}
+
+		if (!FExportableMetaData::HasCsvExpand(Property))
+			continue;
+
+		const FString ExpandPrefix = Prefix + Property->GetName() + TEXT("_");
+		if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+		{
+			OutPlan.Add(ExpandPrefix + TEXT(":") + StructProp->Struct->GetPathName());
+			AppendBindingPlan(StructProp->Struct, ExpandPrefix, OutPlan, OutColumnProperties, Stack);
+			continue;
+		}
+
+		if (CastField<FSetProperty>(Property) || CastField<FArrayProperty>(Property) || CastField<FMapProperty>(Property))
+		{
+			OutPlan.Add(ExpandPrefix + TEXT("*:") + AssetCsvSync_GetPropertyType(Property));
+			continue;
+		}
+
+		UClass* InnerClass = GetObjectPropertyClass(Property);
+		if (!InnerClass || !CanExportClass(InnerClass))
+			continue;
+
+		OutPlan.Add(ExpandPrefix + TEXT(":") + InnerClass->GetPathName());
+		AppendBindingPlan(InnerClass, ExpandPrefix, OutPlan, OutColumnProperties, Stack);
+	}
+
+	AppendBindingPlan(Struct->GetSuperStruct(), Prefix, OutPlan, OutColumnProperties, Stack);
+	Stack.Pop();
+}
+
 bool UAssetCsvSyncCSVHandler::CanExportClass(UClass* Class)
 {
 	if (!Class)
@@ -656,24 +3246,20 @@ void UAssetCsvSyncCSVHandler::ExportClassColumnsEmpty(UClass* Class, TMap<FStrin
 	}
 }
 
-void UAssetCsvSyncCSVHandler::ExportObjectToColumns(UObject* ObjectOrNull, UClass* Class, TMap<FString, FString>& InOutColumnToValue, TArray<FString>& InOutColumnOrder, const FString& Prefix, TSet<const UObject*>& Visited)
+void UAssetCsvSyncCSVHandler::ExportObjectToColumns(UObject* ObjectOrNull, UClass* Class, FAssetCsvSyncExportSink& Sink, const FString& Prefix, const FAssetCsvSyncColumnFilter& Filter, TSet<const UObject*>& Visited)
 {
 	if (!Class)
 		return;
 
-	if (ObjectOrNull && Visited.Contains(ObjectOrNull))
-		return;
-	if (ObjectOrNull)
-		Visited.Add(ObjectOrNull);
-
-	auto AddColumn = [&InOutColumnToValue, &InOutColumnOrder](const FString& Name, const FString& Value)
+	// Checked once per object, when it is entered with its own class; its superclass levels recurse with the same
+	// object and must not be cut off by it.
+	if (ObjectOrNull && Class == ObjectOrNull->GetClass())
 	{
-		if (!InOutColumnToValue.Contains(Name))
-		{
-			InOutColumnOrder.Add(Name);
-		}
-		InOutColumnToValue.Add(Name, Value);
-	};
+		bool bAlreadyVisited = false;
+		Visited.Add(ObjectOrNull, &bAlreadyVisited);
+		if (bAlreadyVisited)
+			return;
+	}
 
 	for (TFieldIterator<FProperty> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
 	{
@@ -685,13 +3271,17 @@ void UAssetCsvSyncCSVHandler::ExportObjectToColumns(UObject* ObjectOrNull, UClas
 		{
 			const FString ColumnKey = FExportableMetaData::GetCsvColumn(Property);
 			const FString ColumnName = Prefix + (!ColumnKey.IsEmpty() ? ColumnKey : Property->GetName());
-			FString Value;
-			if (ObjectOrNull)
+			if (Filter.WantsColumn(ColumnName))
 			{
-				const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(ObjectOrNull);
-				Value = PropertyToString(Property, reinterpret_cast<const uint8*>(ValuePtr));
+				if (ObjectOrNull)
+				{
+					AddLeafValue(Sink, ColumnName, Property, Property->ContainerPtrToValuePtr<void>(ObjectOrNull));
+				}
+				else
+				{
+					Sink.AddColumn(ColumnName, FString());
+				}
 			}
-			AddColumn(ColumnName, Value);
 		}
 
 		if (FExportableMetaData::HasCsvExpand(Property))
@@ -702,16 +3292,20 @@ void UAssetCsvSyncCSVHandler::ExportObjectToColumns(UObject* ObjectOrNull, UClas
 				continue;
 			}
 
+			// Nothing under this property was selected: skip formatting and soft-reference loads entirely.
+			if (!Filter.WantsPrefix(Prefix + Property->GetName() + TEXT("_")))
+				continue;
+
 			if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
 			{
 				if (ObjectOrNull)
 				{
 					const void* StructPtr = StructProp->ContainerPtrToValuePtr<void>(ObjectOrNull);
-					ExportStructToColumns(StructPtr, StructProp->Struct, InOutColumnToValue, InOutColumnOrder, Prefix + Property->GetName() + TEXT("_"), Visited);
+					ExportStructToColumns(StructPtr, StructProp->Struct, Sink, Prefix + Property->GetName() + TEXT("_"), Filter, Visited);
 				}
 				else
 				{
-					ExportStructColumnsEmpty(StructProp->Struct, InOutColumnToValue, InOutColumnOrder, Prefix + Property->GetName() + TEXT("_"));
+					ExportStructColumnsEmpty(StructProp->Struct, Sink.ColumnToValue, Sink.ColumnOrder, Prefix + Property->GetName() + TEXT("_"));
 				}
 				continue;
 			}
@@ -728,33 +3322,38 @@ void UAssetCsvSyncCSVHandler::ExportObjectToColumns(UObject* ObjectOrNull, UClas
 				{
 					for (int32 Index = 0; Index < Helper.Num(); ++Index)
 					{
-						const void* ElemPtr = Helper.GetRawPtr(Index);
 						const FString ElemPrefix = Prefix + ExpandPrefix + FString::FromInt(Index) + TEXT("_");
-						ExportStructToColumns(ElemPtr, StructInner->Struct, InOutColumnToValue, InOutColumnOrder, ElemPrefix, Visited);
+						if (!Filter.WantsPrefix(ElemPrefix))
+							continue;
+						const void* ElemPtr = Helper.GetRawPtr(Index);
+						ExportStructToColumns(ElemPtr, StructInner->Struct, Sink, ElemPrefix, Filter, Visited);
 					}
 				}
 				else if (GetObjectPropertyClass(ArrayProp->Inner) != nullptr)
 				{
 					for (int32 Index = 0; Index < Helper.Num(); ++Index)
 					{
+						const FString ElemPrefix = Prefix + ExpandPrefix + FString::FromInt(Index) + TEXT("_");
+						if (!Filter.WantsPrefix(ElemPrefix))
+							continue;
 						const void* ElemPtr = Helper.GetRawPtr(Index);
 						UObject* ElemObj = ResolveObjectPropertyValueFromContainerPtr(ElemPtr, ArrayProp->Inner, true);
 						if (!ElemObj)
 							continue;
 						if (!CanExportClass(ElemObj->GetClass()))
 							continue;
-						const FString ElemPrefix = Prefix + ExpandPrefix + FString::FromInt(Index) + TEXT("_");
-						ExportObjectToColumns(ElemObj, ElemObj->GetClass(), InOutColumnToValue, InOutColumnOrder, ElemPrefix, Visited);
+						ExportObjectToColumns(ElemObj, ElemObj->GetClass(), Sink, ElemPrefix, Filter, Visited);
 					}
 				}
 				else
 				{
 					for (int32 Index = 0; Index < Helper.Num(); ++Index)
 					{
-						const void* ElemPtr = Helper.GetRawPtr(Index);
 						const FString ColumnName = Prefix + ExpandPrefix + FString::FromInt(Index);
-						const FString Value = PropertyToString(ArrayProp->Inner, reinterpret_cast<const uint8*>(ElemPtr));
-						AddColumn(ColumnName, Value);
+						if (!Filter.WantsColumn(ColumnName))
+							continue;
+						const void* ElemPtr = Helper.GetRawPtr(Index);
+						AddLeafValue(Sink, ColumnName, ArrayProp->Inner, ElemPtr);
 					}
 				}
 				continue;
@@ -774,7 +3373,9 @@ void UAssetCsvSyncCSVHandler::ExportObjectToColumns(UObject* ObjectOrNull, UClas
 						const uint8* ValuePtr = Helper.GetValuePtr(MapIt);
 						const FString KeyString = PropertyToString(MapProp->KeyProp, KeyPtr);
 						const FString ElemPrefix = Prefix + ExpandPrefix + KeyString + TEXT("_");
-						ExportStructToColumns(ValuePtr, StructValue->Struct, InOutColumnToValue, InOutColumnOrder, ElemPrefix, Visited);
+						if (!Filter.WantsPrefix(ElemPrefix))
+							continue;
+						ExportStructToColumns(ValuePtr, StructValue->Struct, Sink, ElemPrefix, Filter, Visited);
 					}
 				}
 				else if (GetObjectPropertyClass(MapProp->ValueProp) != nullptr)
@@ -784,13 +3385,15 @@ void UAssetCsvSyncCSVHandler::ExportObjectToColumns(UObject* ObjectOrNull, UClas
 						const uint8* KeyPtr = Helper.GetKeyPtr(MapIt);
 						const uint8* ValuePtr = Helper.GetValuePtr(MapIt);
 						const FString KeyString = PropertyToString(MapProp->KeyProp, KeyPtr);
+						const FString ElemPrefix = Prefix + ExpandPrefix + KeyString + TEXT("_");
+						if (!Filter.WantsPrefix(ElemPrefix))
+							continue;
 						UObject* ValObj = ResolveObjectPropertyValueFromContainerPtr(ValuePtr, MapProp->ValueProp, true);
 						if (!ValObj)
 							continue;
 						if (!CanExportClass(ValObj->GetClass()))
 							continue;
-						const FString ElemPrefix = Prefix + ExpandPrefix + KeyString + TEXT("_");
-						ExportObjectToColumns(ValObj, ValObj->GetClass(), InOutColumnToValue, InOutColumnOrder, ElemPrefix, Visited);
+						ExportObjectToColumns(ValObj, ValObj->GetClass(), Sink, ElemPrefix, Filter, Visited);
 					}
 				}
 				else
@@ -801,8 +3404,9 @@ void UAssetCsvSyncCSVHandler::ExportObjectToColumns(UObject* ObjectOrNull, UClas
 						const uint8* ValuePtr = Helper.GetValuePtr(MapIt);
 						const FString KeyString = PropertyToString(MapProp->KeyProp, KeyPtr);
 						const FString ColumnName = Prefix + ExpandPrefix + KeyString;
-						const FString Value = PropertyToString(MapProp->ValueProp, ValuePtr);
-						AddColumn(ColumnName, Value);
+						if (!Filter.WantsColumn(ColumnName))
+							continue;
+						AddLeafValue(Sink, ColumnName, MapProp->ValueProp, ValuePtr);
 					}
 				}
 				continue;
@@ -815,18 +3419,18 @@ void UAssetCsvSyncCSVHandler::ExportObjectToColumns(UObject* ObjectOrNull, UClas
 			UObject* InnerObject = ObjectOrNull ? ResolveObjectPropertyValue(ObjectOrNull, Property, true) : nullptr;
 			if (InnerObject)
 			{
-				ExportObjectToColumns(InnerObject, InnerObject->GetClass(), InOutColumnToValue, InOutColumnOrder, Prefix + ExpandPrefix, Visited);
+				ExportObjectToColumns(InnerObject, InnerObject->GetClass(), Sink, Prefix + ExpandPrefix, Filter, Visited);
 			}
 			else
 			{
-				ExportClassColumnsEmpty(InnerClass, InOutColumnToValue, InOutColumnOrder, Prefix + ExpandPrefix);
+				ExportClassColumnsEmpty(InnerClass, Sink.ColumnToValue, Sink.ColumnOrder, Prefix + ExpandPrefix);
 			}
 		}
 	}
 
 	if (UClass* SuperClass = Class->GetSuperClass())
 	{
-		ExportObjectToColumns(ObjectOrNull, SuperClass, InOutColumnToValue, InOutColumnOrder, Prefix, Visited);
+		ExportObjectToColumns(ObjectOrNull, SuperClass, Sink, Prefix, Filter, Visited);
 	}
 }
 
@@ -881,20 +3485,11 @@ UObject* UAssetCsvSyncCSVHandler::ResolveObjectPropertyValueFromContainerPtr(con
 	return nullptr;
 }
 
-void UAssetCsvSyncCSVHandler::ExportStructToColumns(const void* StructPtr, UScriptStruct* Struct, TMap<FString, FString>& InOutColumnToValue, TArray<FString>& InOutColumnOrder, const FString& Prefix, TSet<const UObject*>& Visited)
+void UAssetCsvSyncCSVHandler::ExportStructToColumns(const void* StructPtr, UScriptStruct* Struct, FAssetCsvSyncExportSink& Sink, const FString& Prefix, const FAssetCsvSyncColumnFilter& Filter, TSet<const UObject*>& Visited)
 {
 	if (!Struct || !StructPtr)
 		return;
 
-	auto AddColumn = [&InOutColumnToValue, &InOutColumnOrder](const FString& Name, const FString& Value)
-	{
-		if (!InOutColumnToValue.Contains(Name))
-		{
-			InOutColumnOrder.Add(Name);
-		}
-		InOutColumnToValue.Add(Name, Value);
-	};
-
 	for (TFieldIterator<FProperty> It(Struct, EFieldIteratorFlags::ExcludeSuper); It; ++It)
 	{
 		FProperty* Property = *It;
@@ -908,8 +3503,11 @@ void UAssetCsvSyncCSVHandler::ExportStructToColumns(const void* StructPtr, UScri
 		{
 			const FString ColumnKey = FExportableMetaData::HasCsvColumn(Property) ? FExportableMetaData::GetCsvColumn(Property) : Property->GetName();
 			const FString ColumnName = Prefix + (!ColumnKey.IsEmpty() ? ColumnKey : Property->GetName());
-			const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(StructPtr);
-			AddColumn(ColumnName, PropertyToString(Property, reinterpret_cast<const uint8*>(ValuePtr)));
+			if (Filter.WantsColumn(ColumnName))
+			{
+				const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(StructPtr);
+				AddLeafValue(Sink, ColumnName, Property, ValuePtr);
+			}
 		}
 
 		if (!FExportableMetaData::HasCsvExpand(Property))
@@ -921,12 +3519,15 @@ void UAssetCsvSyncCSVHandler::ExportStructToColumns(const void* StructPtr, UScri
 			continue;
 		}
 
+		if (!Filter.WantsPrefix(Prefix + Property->GetName() + TEXT("_")))
+			continue;
+
 		const FString ExpandPrefix = Property->GetName() + TEXT("_");
 
 		if (FStructProperty* NestedStruct = CastField<FStructProperty>(Property))
 		{
 			const void* NestedPtr = NestedStruct->ContainerPtrToValuePtr<void>(StructPtr);
-			ExportStructToColumns(NestedPtr, NestedStruct->Struct, InOutColumnToValue, InOutColumnOrder, Prefix + Property->GetName() + TEXT("_"), Visited);
+			ExportStructToColumns(NestedPtr, NestedStruct->Struct, Sink, Prefix + Property->GetName() + TEXT("_"), Filter, Visited);
 			continue;
 		}
 
@@ -939,33 +3540,38 @@ void UAssetCsvSyncCSVHandler::ExportStructToColumns(const void* StructPtr, UScri
 			{
 				for (int32 Index = 0; Index < Helper.Num(); ++Index)
 				{
-					const void* ElemPtr = Helper.GetRawPtr(Index);
 					const FString ElemPrefix = Prefix + ExpandPrefix + FString::FromInt(Index) + TEXT("_");
-					ExportStructToColumns(ElemPtr, StructInner->Struct, InOutColumnToValue, InOutColumnOrder, ElemPrefix, Visited);
+					if (!Filter.WantsPrefix(ElemPrefix))
+						continue;
+					const void* ElemPtr = Helper.GetRawPtr(Index);
+					ExportStructToColumns(ElemPtr, StructInner->Struct, Sink, ElemPrefix, Filter, Visited);
 				}
 			}
 			else if (GetObjectPropertyClass(ArrayProp->Inner) != nullptr)
 			{
 				for (int32 Index = 0; Index < Helper.Num(); ++Index)
 				{
+					const FString ElemPrefix = Prefix + ExpandPrefix + FString::FromInt(Index) + TEXT("_");
+					if (!Filter.WantsPrefix(ElemPrefix))
+						continue;
 					const void* ElemPtr = Helper.GetRawPtr(Index);
 					UObject* ElemObj = ResolveObjectPropertyValueFromContainerPtr(ElemPtr, ArrayProp->Inner, true);
 					if (!ElemObj)
 						continue;
 					if (!CanExportClass(ElemObj->GetClass()))
 						continue;
-					const FString ElemPrefix = Prefix + ExpandPrefix + FString::FromInt(Index) + TEXT("_");
-					ExportObjectToColumns(ElemObj, ElemObj->GetClass(), InOutColumnToValue, InOutColumnOrder, ElemPrefix, Visited);
+					ExportObjectToColumns(ElemObj, ElemObj->GetClass(), Sink, ElemPrefix, Filter, Visited);
 				}
 			}
 			else
 			{
 				for (int32 Index = 0; Index < Helper.Num(); ++Index)
 				{
-					const void* ElemPtr = Helper.GetRawPtr(Index);
 					const FString ColumnName = Prefix + ExpandPrefix + FString::FromInt(Index);
-					const FString Value = PropertyToString(ArrayProp->Inner, reinterpret_cast<const uint8*>(ElemPtr));
-					AddColumn(ColumnName, Value);
+					if (!Filter.WantsColumn(ColumnName))
+						continue;
+					const void* ElemPtr = Helper.GetRawPtr(Index);
+					AddLeafValue(Sink, ColumnName, ArrayProp->Inner, ElemPtr);
 				}
 			}
 			continue;
@@ -984,7 +3590,9 @@ void UAssetCsvSyncCSVHandler::ExportStructToColumns(const void* StructPtr, UScri
 					const uint8* ValuePtr = Helper.GetValuePtr(MapIt);
 					const FString KeyString = PropertyToString(MapProp->KeyProp, KeyPtr);
 					const FString ElemPrefix = Prefix + ExpandPrefix + KeyString + TEXT("_");
-					ExportStructToColumns(ValuePtr, StructValue->Struct, InOutColumnToValue, InOutColumnOrder, ElemPrefix, Visited);
+					if (!Filter.WantsPrefix(ElemPrefix))
+						continue;
+					ExportStructToColumns(ValuePtr, StructValue->Struct, Sink, ElemPrefix, Filter, Visited);
 				}
 			}
 			else if (GetObjectPropertyClass(MapProp->ValueProp) != nullptr)
@@ -994,13 +3602,15 @@ void UAssetCsvSyncCSVHandler::ExportStructToColumns(const void* StructPtr, UScri
 					const uint8* KeyPtr = Helper.GetKeyPtr(MapIt);
 					const uint8* ValuePtr = Helper.GetValuePtr(MapIt);
 					const FString KeyString = PropertyToString(MapProp->KeyProp, KeyPtr);
+					const FString ElemPrefix = Prefix + ExpandPrefix + KeyString + TEXT("_");
+					if (!Filter.WantsPrefix(ElemPrefix))
+						continue;
 					UObject* ValObj = ResolveObjectPropertyValueFromContainerPtr(ValuePtr, MapProp->ValueProp, true);
 					if (!ValObj)
 						continue;
 					if (!CanExportClass(ValObj->GetClass()))
 						continue;
-					const FString ElemPrefix = Prefix + ExpandPrefix + KeyString + TEXT("_");
-					ExportObjectToColumns(ValObj, ValObj->GetClass(), InOutColumnToValue, InOutColumnOrder, ElemPrefix, Visited);
+					ExportObjectToColumns(ValObj, ValObj->GetClass(), Sink, ElemPrefix, Filter, Visited);
 				}
 			}
 			else
@@ -1011,8 +3621,9 @@ void UAssetCsvSyncCSVHandler::ExportStructToColumns(const void* StructPtr, UScri
 					const uint8* ValuePtr = Helper.GetValuePtr(MapIt);
 					const FString KeyString = PropertyToString(MapProp->KeyProp, KeyPtr);
 					const FString ColumnName = Prefix + ExpandPrefix + KeyString;
-					const FString Value = PropertyToString(MapProp->ValueProp, ValuePtr);
-					AddColumn(ColumnName, Value);
+					if (!Filter.WantsColumn(ColumnName))
+						continue;
+					AddLeafValue(Sink, ColumnName, MapProp->ValueProp, ValuePtr);
 				}
 			}
 			continue;
@@ -1023,16 +3634,16 @@ void UAssetCsvSyncCSVHandler::ExportStructToColumns(const void* StructPtr, UScri
 			continue;
 		if (!CanExportClass(InnerObject->GetClass()))
 			continue;
-		ExportObjectToColumns(InnerObject, InnerObject->GetClass(), InOutColumnToValue, InOutColumnOrder, Prefix + ExpandPrefix, Visited);
+		ExportObjectToColumns(InnerObject, InnerObject->GetClass(), Sink, Prefix + ExpandPrefix, Filter, Visited);
 	}
 
 	if (UScriptStruct* SuperStruct = Cast<UScriptStruct>(Struct->GetSuperStruct()))
 	{
-		ExportStructToColumns(StructPtr, SuperStruct, InOutColumnToValue, InOutColumnOrder, Prefix, Visited);
+		ExportStructToColumns(StructPtr, SuperStruct, Sink, Prefix, Filter, Visited);
 	}
 }
 
-bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruct* Struct, const TMap<FString, FString>& ColumnToValue, const FString& Prefix, TSet<const UObject*>& Visited)
+bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruct* Struct, const TMap<FString, FString>& ColumnToValue, const FString& Prefix, FAssetCsvSyncImportContext& Context)
 {
 	if (!Struct || !StructPtr)
 		return false;
@@ -1053,7 +3664,7 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruc
 			if (const FString* Found = ColumnToValue.Find(ColumnName))
 			{
 				void* ValuePtr = Property->ContainerPtrToValuePtr<void>(StructPtr);
-				StringToProperty(Property, reinterpret_cast<uint8*>(ValuePtr), *Found);
+				ImportLeafValue(Property, ValuePtr, ColumnName, *Found, Context);
 			}
 		}
 
@@ -1069,10 +3680,14 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruc
 		const FString ExpandPrefix = Property->GetName() + TEXT("_");
 		const FString FullExpandPrefix = Prefix + ExpandPrefix;
 
+		// No incoming column under this property: don't walk it, and don't load what it references.
+		if (!Context.Reachable.WantsPrefix(FullExpandPrefix))
+			continue;
+
 		if (FStructProperty* NestedStruct = CastField<FStructProperty>(Property))
 		{
 			void* NestedPtr = NestedStruct->ContainerPtrToValuePtr<void>(StructPtr);
-			ApplyColumnsToStruct(NestedPtr, NestedStruct->Struct, ColumnToValue, FullExpandPrefix, Visited);
+			ApplyColumnsToStruct(NestedPtr, NestedStruct->Struct, ColumnToValue, FullExpandPrefix, Context);
 			continue;
 		}
 
@@ -1104,6 +3719,7 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruc
 				}
 				if (MaxIndex >= 0 && MaxIndex >= Helper.Num())
 				{
+					Context.MarkContainerGrown();
 					Helper.Resize(MaxIndex + 1);
 				}
 				for (int32 Index : Indices)
@@ -1112,7 +3728,7 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruc
 						continue;
 					void* ElemPtr = Helper.GetRawPtr(Index);
 					const FString ElemPrefix = FullExpandPrefix + FString::FromInt(Index) + TEXT("_");
-					ApplyColumnsToStruct(ElemPtr, StructInner->Struct, ColumnToValue, ElemPrefix, Visited);
+					ApplyColumnsToStruct(ElemPtr, StructInner->Struct, ColumnToValue, ElemPrefix, Context);
 				}
 				continue;
 			}
@@ -1140,6 +3756,7 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruc
 				}
 				if (MaxIndex >= 0 && MaxIndex >= Helper.Num())
 				{
+					Context.MarkContainerGrown();
 					Helper.Resize(MaxIndex + 1);
 				}
 				for (int32 Index : Indices)
@@ -1153,13 +3770,13 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruc
 					if (!CanExportClass(ElemObj->GetClass()))
 						continue;
 					const FString ElemPrefix = FullExpandPrefix + FString::FromInt(Index) + TEXT("_");
-					ApplyColumnsToObject(ElemObj, ElemObj->GetClass(), ColumnToValue, ElemPrefix, Visited);
+					ApplyColumnsToObject(ElemObj, ElemObj->GetClass(), ColumnToValue, ElemPrefix, Context);
 				}
 				continue;
 			}
 
 			// Primitive elements: ${Prefix}${Index}
-			TArray<TPair<int32, const FString*>> Writes;
+			TArray<TPair<int32, const TPair<FString, FString>*>> Writes;
 			for (const TPair<FString, FString>& Pair : ColumnToValue)
 			{
 				if (!Pair.Key.StartsWith(FullExpandPrefix))
@@ -1170,17 +3787,25 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruc
 				const int32 Index = FCString::Atoi(*Suffix);
 				if (Index < 0)
 					continue;
-				Writes.Add(TPair<int32, const FString*>(Index, &Pair.Value));
+				Writes.Add(TPair<int32, const TPair<FString, FString>*>(Index, &Pair));
 			}
 			Writes.Sort([](const auto& A, const auto& B) { return A.Key < B.Key; });
 			for (const auto& W : Writes)
 			{
-				if (W.Key >= Helper.Num())
+				const int32 ChangedBefore = Context.ChangedColumns;
+				const bool bGrown = W.Key >= Helper.Num();
+				if (bGrown)
 				{
+					Context.MarkChanged();
 					Helper.Resize(W.Key + 1);
 				}
 				void* ElemPtr = Helper.GetRawPtr(W.Key);
-				StringToProperty(ArrayProp->Inner, reinterpret_cast<uint8*>(ElemPtr), *W.Value);
+				ImportLeafValue(ArrayProp->Inner, ElemPtr, W.Value->Key, W.Value->Value, Context);
+				// A new element whose cell equals the default still changed the array.
+				if (bGrown && Context.ChangedColumns == ChangedBefore)
+				{
+					Context.CountChangedColumn();
+				}
 			}
 			continue;
 		}
@@ -1217,6 +3842,7 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruc
 					int32 FoundIndex = Helper.FindMapIndexWithKey(TempKeyStorage.GetData());
 					if (FoundIndex == INDEX_NONE)
 					{
+						Context.MarkContainerGrown();
 						const int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
 						MapProp->KeyProp->CopyCompleteValue(Helper.GetKeyPtr(NewIndex), TempKeyStorage.GetData());
 						bNeedsRehash = true;
@@ -1224,7 +3850,7 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruc
 					}
 					void* ValuePtr = Helper.GetValuePtr(FoundIndex);
 					const FString ElemPrefix = FullExpandPrefix + KeyString + TEXT("_");
-					ApplyColumnsToStruct(ValuePtr, StructValue->Struct, ColumnToValue, ElemPrefix, Visited);
+					ApplyColumnsToStruct(ValuePtr, StructValue->Struct, ColumnToValue, ElemPrefix, Context);
 				}
 				MapProp->KeyProp->DestroyValue(TempKeyStorage.GetData());
 				if (bNeedsRehash)
@@ -1260,6 +3886,7 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruc
 					int32 FoundIndex = Helper.FindMapIndexWithKey(TempKeyStorage.GetData());
 					if (FoundIndex == INDEX_NONE)
 					{
+						Context.MarkContainerGrown();
 						const int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
 						MapProp->KeyProp->CopyCompleteValue(Helper.GetKeyPtr(NewIndex), TempKeyStorage.GetData());
 						bNeedsRehash = true;
@@ -1272,7 +3899,7 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruc
 					if (!CanExportClass(ValObj->GetClass()))
 						continue;
 					const FString ElemPrefix = FullExpandPrefix + KeyString + TEXT("_");
-					ApplyColumnsToObject(ValObj, ValObj->GetClass(), ColumnToValue, ElemPrefix, Visited);
+					ApplyColumnsToObject(ValObj, ValObj->GetClass(), ColumnToValue, ElemPrefix, Context);
 				}
 
 				MapProp->KeyProp->DestroyValue(TempKeyStorage.GetData());
@@ -1303,14 +3930,21 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruc
 				int32 FoundIndex = Helper.FindMapIndexWithKey(TempKeyStorage.GetData());
 				if (FoundIndex == INDEX_NONE)
 				{
+					const int32 ChangedBefore = Context.ChangedColumns;
+					Context.MarkChanged();
 					const int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
 					MapProp->KeyProp->CopyCompleteValue(Helper.GetKeyPtr(NewIndex), TempKeyStorage.GetData());
-					StringToProperty(MapProp->ValueProp, Helper.GetValuePtr(NewIndex), Pair.Value);
+					ImportLeafValue(MapProp->ValueProp, Helper.GetValuePtr(NewIndex), Pair.Key, Pair.Value, Context);
+					// The new key changed the map even when its value cell equals the default.
+					if (Context.ChangedColumns == ChangedBefore)
+					{
+						Context.CountChangedColumn();
+					}
 					bNeedsRehash = true;
 				}
 				else
 				{
-					StringToProperty(MapProp->ValueProp, Helper.GetValuePtr(FoundIndex), Pair.Value);
+					ImportLeafValue(MapProp->ValueProp, Helper.GetValuePtr(FoundIndex), Pair.Key, Pair.Value, Context);
 				}
 			}
 
@@ -1327,12 +3961,12 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToStruct(void* StructPtr, UScriptStruc
 			continue;
 		if (!CanExportClass(InnerObject->GetClass()))
 			continue;
-		ApplyColumnsToObject(InnerObject, InnerObject->GetClass(), ColumnToValue, FullExpandPrefix, Visited);
+		ApplyColumnsToObject(InnerObject, InnerObject->GetClass(), ColumnToValue, FullExpandPrefix, Context);
 	}
 
 	if (UScriptStruct* SuperStruct = Cast<UScriptStruct>(Struct->GetSuperStruct()))
 	{
-		ApplyColumnsToStruct(StructPtr, SuperStruct, ColumnToValue, Prefix, Visited);
+		ApplyColumnsToStruct(StructPtr, SuperStruct, ColumnToValue, Prefix, Context);
 	}
 
 	return true;
@@ -1347,24 +3981,28 @@ bool UAssetCsvSyncCSVHandler::ApplyCSVRowToObject(UObject* TargetObject, UClass*
 	if (Headers.Num() != Values.Num())
 		return false;
 
-	TMap<FString, FString> ColumnToValue;
-	ColumnToValue.Reserve(Headers.Num());
-	for (int32 i = 0; i < Headers.Num(); ++i)
-	{
-		ColumnToValue.Add(Headers[i], Values[i]);
-	}
+	const TMap<FString, FString> ColumnToValue = AssetCsvSync_ZipColumns(Headers, Values, TArray<FString>());
 
-	TSet<const UObject*> Visited;
-	return ApplyColumnsToObject(TargetObject, TargetClass, ColumnToValue, FString(), Visited);
+	FAssetCsvSyncImportContext Context(ColumnToValue);
+	return ApplyColumnsToObject(TargetObject, TargetClass, ColumnToValue, FString(), Context);
 }
 
-bool UAssetCsvSyncCSVHandler::ApplyColumnsToObject(UObject* TargetObject, UClass* TargetClass, const TMap<FString, FString>& ColumnToValue, const FString& Prefix, TSet<const UObject*>& Visited)
+bool UAssetCsvSyncCSVHandler::ApplyColumnsToObject(UObject* TargetObject, UClass* TargetClass, const TMap<FString, FString>& ColumnToValue, const FString& Prefix, FAssetCsvSyncImportContext& Context)
 {
 	if (!TargetObject || !TargetClass)
 		return false;
-	if (Visited.Contains(TargetObject))
-		return true;
-	Visited.Add(TargetObject);
+	// Once per object, as in ExportObjectToColumns: the superclass levels recurse with the same object.
+	if (TargetClass == TargetObject->GetClass())
+	{
+		bool bAlreadyVisited = false;
+		Context.Visited.Add(TargetObject, &bAlreadyVisited);
+		if (bAlreadyVisited)
+			return true;
+	}
+
+	TGuardValue<UObject*> ObjectGuard(Context.CurrentObject, TargetObject);
+	TGuardValue<FProperty*> RootPropertyGuard(Context.CurrentRootProperty, nullptr);
+	TGuardValue<int32> ScratchGuard(Context.ScratchDepth, 0);
 
 	const EAssetCsvSyncWriteBackScope Scope = UAssetCsvSyncEditorPluginSettings::Get()->WriteBackScope;
 
@@ -1374,6 +4012,8 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToObject(UObject* TargetObject, UClass
 		if (!Property)
 			continue;
 
+		Context.CurrentRootProperty = Property;
+
 		// 1) Leaf (CsvColumn) always imports
 		if (FExportableMetaData::HasCsvColumn(Property))
 		{
@@ -1382,7 +4022,7 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToObject(UObject* TargetObject, UClass
 			if (const FString* Found = ColumnToValue.Find(ColumnName))
 			{
 				void* ValuePtr = Property->ContainerPtrToValuePtr<void>(TargetObject);
-				StringToProperty(Property, reinterpret_cast<uint8*>(ValuePtr), *Found);
+				ImportLeafValue(Property, ValuePtr, ColumnName, *Found, Context);
 			}
 		}
 
@@ -1399,10 +4039,14 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToObject(UObject* TargetObject, UClass
 		const FString ExpandPrefix = Property->GetName() + TEXT("_");
 		const FString FullExpandPrefix = Prefix + ExpandPrefix;
 
+		// No incoming column under this property: don't walk it, and don't load what it references.
+		if (!Context.Reachable.WantsPrefix(FullExpandPrefix))
+			continue;
+
 		if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
 		{
 			void* StructValuePtr = StructProp->ContainerPtrToValuePtr<void>(TargetObject);
-			ApplyColumnsToStruct(StructValuePtr, StructProp->Struct, ColumnToValue, FullExpandPrefix, Visited);
+			ApplyColumnsToStruct(StructValuePtr, StructProp->Struct, ColumnToValue, FullExpandPrefix, Context);
 			continue;
 		}
 
@@ -1435,6 +4079,7 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToObject(UObject* TargetObject, UClass
 
 				if (MaxIndex >= 0 && MaxIndex >= Helper.Num())
 				{
+					Context.MarkContainerGrown();
 					Helper.Resize(MaxIndex + 1);
 				}
 
@@ -1444,7 +4089,7 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToObject(UObject* TargetObject, UClass
 						continue;
 					void* ElemPtr = Helper.GetRawPtr(Index);
 					const FString ElemPrefix = FullExpandPrefix + FString::FromInt(Index) + TEXT("_");
-					ApplyColumnsToStruct(ElemPtr, StructInner->Struct, ColumnToValue, ElemPrefix, Visited);
+					ApplyColumnsToStruct(ElemPtr, StructInner->Struct, ColumnToValue, ElemPrefix, Context);
 				}
 				continue;
 			}
@@ -1473,6 +4118,7 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToObject(UObject* TargetObject, UClass
 
 				if (MaxIndex >= 0 && MaxIndex >= Helper.Num())
 				{
+					Context.MarkContainerGrown();
 					Helper.Resize(MaxIndex + 1);
 				}
 
@@ -1487,12 +4133,12 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToObject(UObject* TargetObject, UClass
 					if (!CanExportClass(ElemObj->GetClass()))
 						continue;
 					const FString ElemPrefix = FullExpandPrefix + FString::FromInt(Index) + TEXT("_");
-					ApplyColumnsToObject(ElemObj, ElemObj->GetClass(), ColumnToValue, ElemPrefix, Visited);
+					ApplyColumnsToObject(ElemObj, ElemObj->GetClass(), ColumnToValue, ElemPrefix, Context);
 				}
 				continue;
 			}
 
-			TArray<TPair<int32, const FString*>> Writes;
+			TArray<TPair<int32, const TPair<FString, FString>*>> Writes;
 			for (const TPair<FString, FString>& Pair : ColumnToValue)
 			{
 				if (!Pair.Key.StartsWith(FullExpandPrefix))
@@ -1503,42 +4149,62 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToObject(UObject* TargetObject, UClass
 				const int32 Index = FCString::Atoi(*Suffix);
 				if (Index < 0)
 					continue;
-				Writes.Add(TPair<int32, const FString*>(Index, &Pair.Value));
+				Writes.Add(TPair<int32, const TPair<FString, FString>*>(Index, &Pair));
 			}
 			Writes.Sort([](const auto& A, const auto& B) { return A.Key < B.Key; });
 			for (const auto& W : Writes)
 			{
-				if (W.Key >= Helper.Num())
+				const int32 ChangedBefore = Context.ChangedColumns;
+				const bool bGrown = W.Key >= Helper.Num();
+				if (bGrown)
 				{
+					Context.MarkChanged();
 					Helper.Resize(W.Key + 1);
 				}
 				void* ElemPtr = Helper.GetRawPtr(W.Key);
-				StringToProperty(ArrayProp->Inner, reinterpret_cast<uint8*>(ElemPtr), *W.Value);
+				ImportLeafValue(ArrayProp->Inner, ElemPtr, W.Value->Key, W.Value->Value, Context);
+				// A new element whose cell equals the default still changed the array.
+				if (bGrown && Context.ChangedColumns == ChangedBefore)
+				{
+					Context.CountChangedColumn();
+				}
 			}
 			continue;
 		}
 
 		if (FMapProperty* MapProp = CastField<FMapProperty>(Property))
 		{
-			void* MapPtr = MapProp->ContainerPtrToValuePtr<void>(TargetObject);
-			FScriptMapHelper Helper(MapProp, MapPtr);
-			bool bNeedsRehash = false;
-
-			bool bHasAnyColumnsForThisMap = false;
+			int32 NumColumnsForThisMap = 0;
 			for (const TPair<FString, FString>& Pair : ColumnToValue)
 			{
 				if (Pair.Key.StartsWith(FullExpandPrefix))
 				{
-					bHasAnyColumnsForThisMap = true;
-					break;
+					++NumColumnsForThisMap;
 				}
 			}
 
-			if (bHasAnyColumnsForThisMap)
+			if (NumColumnsForThisMap == 0)
+				continue;
+
+			// The map is rebuilt from the CSV, so build it in a scratch copy and only
+			// commit it (and count its columns as changed) when it differs from the live value.
+			void* LiveMapPtr = MapProp->ContainerPtrToValuePtr<void>(TargetObject);
+			FAssetCsvSyncScratchValue MapScratch(MapProp, LiveMapPtr);
+			ON_SCOPE_EXIT
 			{
-				Helper.EmptyValues();
-				bNeedsRehash = true;
-			}
+				if (!MapProp->Identical(LiveMapPtr, MapScratch.Data, PPF_None))
+				{
+					Context.MarkChanged();
+					Context.ChangedColumns += NumColumnsForThisMap;
+					MapProp->CopySingleValue(LiveMapPtr, MapScratch.Data);
+				}
+			};
+			TGuardValue<int32> MapScratchGuard(Context.ScratchDepth, Context.ScratchDepth + 1);
+
+			void* MapPtr = MapScratch.Data;
+			FScriptMapHelper Helper(MapProp, MapPtr);
+			Helper.EmptyValues();
+			bool bNeedsRehash = true;
 
 			if (FStructProperty* StructValue = CastField<FStructProperty>(MapProp->ValueProp))
 			{
@@ -1575,7 +4241,7 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToObject(UObject* TargetObject, UClass
 
 					void* ValuePtr = Helper.GetValuePtr(FoundIndex);
 					const FString ElemPrefix = FullExpandPrefix + KeyString + TEXT("_");
-					ApplyColumnsToStruct(ValuePtr, StructValue->Struct, ColumnToValue, ElemPrefix, Visited);
+					ApplyColumnsToStruct(ValuePtr, StructValue->Struct, ColumnToValue, ElemPrefix, Context);
 				}
 
 				MapProp->KeyProp->DestroyValue(TempKeyStorage.GetData());
@@ -1626,7 +4292,7 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToObject(UObject* TargetObject, UClass
 					if (!CanExportClass(ValObj->GetClass()))
 						continue;
 					const FString ElemPrefix = FullExpandPrefix + KeyString + TEXT("_");
-					ApplyColumnsToObject(ValObj, ValObj->GetClass(), ColumnToValue, ElemPrefix, Visited);
+					ApplyColumnsToObject(ValObj, ValObj->GetClass(), ColumnToValue, ElemPrefix, Context);
 				}
 
 				MapProp->KeyProp->DestroyValue(TempKeyStorage.GetData());
@@ -1658,12 +4324,12 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToObject(UObject* TargetObject, UClass
 				{
 					const int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
 					MapProp->KeyProp->CopyCompleteValue(Helper.GetKeyPtr(NewIndex), TempKeyStorage.GetData());
-					StringToProperty(MapProp->ValueProp, Helper.GetValuePtr(NewIndex), Pair.Value);
+					ParseCell(MapProp->ValueProp, Helper.GetValuePtr(NewIndex), Pair.Key, Pair.Value, Context.Staging);
 					bNeedsRehash = true;
 				}
 				else
 				{
-					StringToProperty(MapProp->ValueProp, Helper.GetValuePtr(FoundIndex), Pair.Value);
+					ParseCell(MapProp->ValueProp, Helper.GetValuePtr(FoundIndex), Pair.Key, Pair.Value, Context.Staging);
 				}
 			}
 
@@ -1680,14 +4346,58 @@ bool UAssetCsvSyncCSVHandler::ApplyColumnsToObject(UObject* TargetObject, UClass
 			continue;
 		if (!CanExportClass(InnerObject->GetClass()))
 			continue;
-		ApplyColumnsToObject(InnerObject, InnerObject->GetClass(), ColumnToValue, FullExpandPrefix, Visited);
+		ApplyColumnsToObject(InnerObject, InnerObject->GetClass(), ColumnToValue, FullExpandPrefix, Context);
 	}
 
 	if (UClass* SuperClass = TargetClass->GetSuperClass())
 	{
-		ApplyColumnsToObject(TargetObject, SuperClass, ColumnToValue, Prefix, Visited);
+		ApplyColumnsToObject(TargetObject, SuperClass, ColumnToValue, Prefix, Context);
+	}
+
+	return true;
+}
+
+bool UAssetCsvSyncCSVHandler::ImportLeafValue(FProperty* Property, void* ValuePtr, const FString& ColumnName, const FString& StringValue, FAssetCsvSyncImportContext& Context)
+{
+	if (!Property || !ValuePtr)
+		return false;
+
+	const FAssetCsvSyncScratchValue* Staged = nullptr;
+	if (Context.Staging)
+	{
+		if (Context.Staging->LearnedColumns)
+		{
+			Context.Staging->LearnedColumns->FindOrAdd(ColumnName) = Property;
+		}
+		Staged = Context.Staging->Find(ColumnName, Property);
+	}
+
+	if (Context.ScratchDepth > 0)
+	{
+		if (Staged)
+		{
+			Property->CopySingleValue(ValuePtr, Staged->Data);
+			return true;
+		}
+		return ParseCell(Property, reinterpret_cast<uint8*>(ValuePtr), ColumnName, StringValue, Context.Staging);
+	}
+
+	// Parse into a copy of the current value (struct text import only overrides the fields it names),
+	// then write only if the result differs.
+	TOptional<FAssetCsvSyncScratchValue> Parsed;
+	if (!Staged)
+	{
+		Parsed.Emplace(Property, ValuePtr);
+		if (!ParseCell(Property, Parsed->Data, ColumnName, StringValue, Context.Staging))
+			return false;
 	}
+	const void* NewValue = Staged ? Staged->Data : Parsed->Data;
+	if (Property->Identical(ValuePtr, NewValue, PPF_None))
+		return true;
 
+	Context.MarkChanged();
+	++Context.ChangedColumns;
+	Property->CopySingleValue(ValuePtr, NewValue);
 	return true;
 }
 
@@ -1724,8 +4434,11 @@ FString UAssetCsvSyncCSVHandler::PropertyToString(FProperty* Property, const uin
 	}
 	else if (FMapProperty* MapProperty = CastField<FMapProperty>(Property))
 	{
+		// A condensed JSON object on one line, so map cells never span CSV lines.
 		FScriptMapHelper Helper(MapProperty, PropertyData);
-		TSharedRef<FJsonObject> Obj = MakeShared<FJsonObject>();
+		FString Out;
+		FAssetCsvSyncCoreAppend Append{ Out };
+		AssetCsvSync::Core::TMapCellWriter<TCHAR, FAssetCsvSyncCoreAppend> Writer(Append);
 
 		for (FScriptMapHelper::FIterator It = Helper.CreateIterator(); It; ++It)
 		{
@@ -1735,65 +4448,61 @@ FString UAssetCsvSyncCSVHandler::PropertyToString(FProperty* Property, const uin
 				continue;
 
 			const FString KeyString = PropertyToString(MapProperty->KeyProp, KeyPtr);
+			const FAssetCsvSyncCoreView Key = AssetCsvSync_CoreView(KeyString);
 
-			TSharedPtr<FJsonValue> JsonValue;
 			if (FNumericProperty* NumProp = CastField<FNumericProperty>(MapProperty->ValueProp))
 			{
 				if (NumProp->IsInteger())
 				{
-					JsonValue = MakeShared<FJsonValueNumber>((double)NumProp->GetSignedIntPropertyValue(ValuePtr));
+					Writer.Integer(Key, NumProp->GetSignedIntPropertyValue(ValuePtr));
 				}
 				else
 				{
-					JsonValue = MakeShared<FJsonValueNumber>(NumProp->GetFloatingPointPropertyValue(ValuePtr));
+					Writer.Number(Key, NumProp->GetFloatingPointPropertyValue(ValuePtr));
 				}
 			}
 			else if (FBoolProperty* BoolProp = CastField<FBoolProperty>(MapProperty->ValueProp))
 			{
-				JsonValue = MakeShared<FJsonValueBoolean>(BoolProp->GetPropertyValue(ValuePtr));
+				Writer.Bool(Key, BoolProp->GetPropertyValue(ValuePtr));
 			}
 			else if (FStrProperty* StrProp = CastField<FStrProperty>(MapProperty->ValueProp))
 			{
-				JsonValue = MakeShared<FJsonValueString>(StrProp->GetPropertyValue(ValuePtr));
+				Writer.String(Key, AssetCsvSync_CoreView(*StrProp->GetPropertyValuePtr(ValuePtr)));
 			}
 			else if (FNameProperty* NameProp = CastField<FNameProperty>(MapProperty->ValueProp))
 			{
-				JsonValue = MakeShared<FJsonValueString>(NameProp->GetPropertyValue(ValuePtr).ToString());
+				Writer.String(Key, AssetCsvSync_CoreView(NameProp->GetPropertyValue(ValuePtr).ToString()));
 			}
 			else if (FTextProperty* TextProp = CastField<FTextProperty>(MapProperty->ValueProp))
 			{
-				JsonValue = MakeShared<FJsonValueString>(TextProp->GetPropertyValue(ValuePtr).ToString());
+				Writer.String(Key, AssetCsvSync_CoreView(TextProp->GetPropertyValue(ValuePtr).ToString()));
 			}
 			else
 			{
-				JsonValue = MakeShared<FJsonValueString>(PropertyToString(MapProperty->ValueProp, ValuePtr));
+				Writer.String(Key, AssetCsvSync_CoreView(PropertyToString(MapProperty->ValueProp, ValuePtr)));
 			}
-
-			Obj->SetField(KeyString, JsonValue);
 		}
 
-		FString Out;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Out);
-		FJsonSerializer::Serialize(Obj, Writer);
+		Writer.Finish();
 		return Out;
 	}
 
 	if (FIntProperty* IntProperty = CastField<FIntProperty>(Property))
 	{
-		return FString::Printf(TEXT("%d"), IntProperty->GetPropertyValue(PropertyData));
+		return AssetCsvSync_FormatInteger(IntProperty->GetPropertyValue(PropertyData));
 	}
 	else if (FInt64Property* Int64Property = CastField<FInt64Property>(Property))
 	{
-		return FString::Printf(TEXT("%lld"), Int64Property->GetPropertyValue(PropertyData));
+		return AssetCsvSync_FormatInteger(Int64Property->GetPropertyValue(PropertyData));
 	}
 	else if (FFloatProperty* FloatProperty = CastField<FFloatProperty>(Property))
 	{
-		// SanitizeFloat produces the minimal decimal representation for exact round-trip.
-		return FString::SanitizeFloat(FloatProperty->GetPropertyValue(PropertyData));
+		// Same text as SanitizeFloat, which older exports were written with.
+		return AssetCsvSync_FormatDecimal(FloatProperty->GetPropertyValue(PropertyData));
 	}
 	else if (FDoubleProperty* DoubleProperty = CastField<FDoubleProperty>(Property))
 	{
-		return FString::SanitizeFloat(DoubleProperty->GetPropertyValue(PropertyData));
+		return AssetCsvSync_FormatDecimal(DoubleProperty->GetPropertyValue(PropertyData));
 	}
 	else if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
 	{
@@ -1897,6 +4606,26 @@ void UAssetCsvSyncCSVHandler::ExportStructColumnsEmpty(UScriptStruct* Struct, TM
 	}
 }
 
+bool UAssetCsvSyncCSVHandler::ParseCell(FProperty* Property, uint8* PropertyData, const FString& Column, const FString& Cell, const FAssetCsvSyncStagedRow* Staging)
+{
+	auto StringToLeaf = [](FProperty* LeafProperty, uint8* LeafData, const FString& LeafText)
+	{
+		return StringToProperty(LeafProperty, LeafData, LeafText);
+	};
+	if (Staging && Staging->TypedColumns)
+	{
+		const FAssetCsvSyncTypedColumn* Typed = Staging->TypedColumns->Find(Column);
+		if (Typed && Typed->Apply(Staging->TypedRow, Property, PropertyData))
+			return true;
+	}
+	const EAssetCsvSyncTableFormat Format = Staging ? Staging->Format : EAssetCsvSyncTableFormat::Csv;
+	if (Format == EAssetCsvSyncTableFormat::Binary && Staging->BinaryTable)
+		return Staging->BinaryTable->ReadCell(Column, Staging->BinaryRow, Property, PropertyData, StringToLeaf);
+	if (Format == EAssetCsvSyncTableFormat::JsonLines)
+		return FAssetCsvSyncJsonLines::ReadValue(Cell, Property, PropertyData, StringToLeaf);
+	return StringToProperty(Property, PropertyData, Cell);
+}
+
 bool UAssetCsvSyncCSVHandler::StringToProperty(FProperty* Property, uint8* PropertyData, const FString& StringValue)
 {
 	if (!Property || !PropertyData)
@@ -1939,45 +4668,23 @@ bool UAssetCsvSyncCSVHandler::StringToProperty(FProperty* Property, uint8* Prope
 			return true;
 		}
 
-		TSharedPtr<FJsonObject> Obj;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(StringValue);
-		if (!FJsonSerializer::Deserialize(Reader, Obj) || !Obj.IsValid())
+		// Values arrive as cell text: numbers as written, null as empty, nested values as their JSON.
+		// A repeated key replaces the earlier value, as in a JSON object.
+		TMap<FString, FString> Entries;
+		const bool bParsed = AssetCsvSync::Core::ParseMapCell(AssetCsvSync_CoreView(StringValue), [&Entries](FAssetCsvSyncCoreView Key, AssetCsvSync::Core::EMapCellValue Kind, FAssetCsvSyncCoreView Value)
+		{
+			Entries.Add(AssetCsvSync_FromCoreView(Key), Kind == AssetCsvSync::Core::EMapCellValue::Null ? FString() : AssetCsvSync_FromCoreView(Value));
+		});
+		if (!bParsed)
 		{
 			UE_LOG(LogAssetCsvSync, Error, TEXT("StringToProperty: Failed to parse JSON map cell"));
 			return false;
 		}
 
-		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Obj->Values)
+		for (const TPair<FString, FString>& Pair : Entries)
 		{
 			const FString& KeyString = Pair.Key;
-			const TSharedPtr<FJsonValue>& JsonVal = Pair.Value;
-			if (!JsonVal.IsValid())
-				continue;
-
-			FString ValueString;
-			switch (JsonVal->Type)
-			{
-			case EJson::String:
-				ValueString = JsonVal->AsString();
-				break;
-			case EJson::Number:
-				ValueString = FString::SanitizeFloat(JsonVal->AsNumber());
-				break;
-			case EJson::Boolean:
-				ValueString = JsonVal->AsBool() ? TEXT("true") : TEXT("false");
-				break;
-			case EJson::Null:
-				ValueString = FString();
-				break;
-			default:
-				{
-					FString Tmp;
-					TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Tmp);
-					FJsonSerializer::Serialize(JsonVal.ToSharedRef(), TEXT(""), Writer);
-					ValueString = Tmp;
-				}
-				break;
-			}
+			const FString& ValueString = Pair.Value;
 
 			const int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
 			uint8* KeyPtr = Helper.GetKeyPtr(NewIndex);
@@ -2083,145 +4790,66 @@ bool UAssetCsvSyncCSVHandler::StringToProperty(FProperty* Property, uint8* Prope
 
 FString UAssetCsvSyncCSVHandler::EscapeCSVString(const FString& Value)
 {
-	if (Value.Contains(TEXT(",")) || Value.Contains(TEXT("\"")) || Value.Contains(TEXT("\n")) || Value.Contains(TEXT("\r")))
-	{
-		FString Escaped = Value.Replace(TEXT("\""), TEXT("\"\""));
-		return TEXT("\"") + Escaped + TEXT("\"");
-	}
-	return Value;
+	if (!AssetCsvSync::Core::NeedsCsvQuotes(AssetCsvSync_CoreView(Value)))
+		return Value;
+	FString Escaped;
+	AssetCsvSync::Core::AppendCsvCell(AssetCsvSync_CoreView(Value), FAssetCsvSyncCoreAppend{ Escaped });
+	return Escaped;
 }
 
-TArray<FString> UAssetCsvSyncCSVHandler::ParseCSVLine(const FString& Line)
+void UAssetCsvSyncCSVHandler::AppendCSVRow(FString& InOutContent, const TArray<FString>& Cells)
 {
-	TArray<FString> Result;
-	FString CurrentValue;
-	bool bInQuotes = false;
-
-	for (int32 i = 0; i < Line.Len(); ++i)
+	for (int32 i = 0; i < Cells.Num(); ++i)
 	{
-		TCHAR Char = Line[i];
-
-		if (bInQuotes)
-		{
-			if (Char == TEXT('"'))
-			{
-				if (i + 1 < Line.Len() && Line[i + 1] == TEXT('"'))
-				{
-					CurrentValue += TEXT('"');
-					++i;
-				}
-				else
-				{
-					bInQuotes = false;
-				}
-			}
-			else
-			{
-				CurrentValue += Char;
-			}
-		}
-		else
+		if (i > 0)
 		{
-			if (Char == TEXT('"'))
-			{
-				bInQuotes = true;
-			}
-			else if (Char == TEXT(','))
-			{
-				Result.Add(CurrentValue);
-				CurrentValue.Reset();
-			}
-			else
-			{
-				CurrentValue += Char;
-			}
+			InOutContent += TEXT(",");
 		}
+		AssetCsvSync::Core::AppendCsvCell(AssetCsvSync_CoreView(Cells[i]), FAssetCsvSyncCoreAppend{ InOutContent });
 	}
+	InOutContent += TEXT("\n");
+}
 
-	Result.Add(CurrentValue);
-	return Result;
+bool UAssetCsvSyncCSVHandler::ReadCSVRecord(const FString& Content, int32& InOutPos, FString& OutRecord)
+{
+	// Reads one record starting at InOutPos. Line breaks inside quoted cells belong to the record.
+	OutRecord.Reset();
+	size_t Pos = static_cast<size_t>(FMath::Max(InOutPos, 0));
+	FAssetCsvSyncCoreView Record;
+	if (!AssetCsvSync::Core::ReadCsvRecord(AssetCsvSync_CoreView(Content), Pos, Record))
+		return false;
+	OutRecord.AppendChars(Record.data(), static_cast<int32>(Record.size()));
+	InOutPos = static_cast<int32>(Pos);
+	return true;
 }
 
-FString UAssetCsvSyncCSVHandler::EscapeListItem(const FString& Value)
+TArray<FString> UAssetCsvSyncCSVHandler::ParseCSVLine(const FString& Line)
 {
-	// Empty strings are always quoted so that [""] round-trips as `""` rather
-	// than as an empty cell (which would be parsed as an empty array).
-	if (Value.IsEmpty() || Value.Contains(TEXT(";")) || Value.Contains(TEXT("\"")))
+	TArray<FString> Result;
+	AssetCsvSync::Core::ParseCsvLine(AssetCsvSync_CoreView(Line), [&Result](FAssetCsvSyncCoreView Cell)
 	{
-		FString Escaped = Value.Replace(TEXT("\""), TEXT("\"\""));
-		return TEXT("\"") + Escaped + TEXT("\"");
-	}
-	return Value;
+		Result.Add(AssetCsvSync_FromCoreView(Cell));
+	});
+	return Result;
 }
 
 TArray<FString> UAssetCsvSyncCSVHandler::ParseListCell(const FString& Cell)
 {
 	TArray<FString> Result;
-	if (Cell.IsEmpty())
+	AssetCsvSync::Core::ParseListCell(AssetCsvSync_CoreView(Cell), [&Result](FAssetCsvSyncCoreView Item)
 	{
-		return Result;
-	}
-
-	FString CurrentValue;
-	bool bInQuotes = false;
-
-	for (int32 i = 0; i < Cell.Len(); ++i)
-	{
-		const TCHAR Char = Cell[i];
-		if (bInQuotes)
-		{
-			if (Char == TEXT('"'))
-			{
-				if (i + 1 < Cell.Len() && Cell[i + 1] == TEXT('"'))
-				{
-					CurrentValue += TEXT('"');
-					++i;
-				}
-				else
-				{
-					bInQuotes = false;
-				}
-			}
-			else
-			{
-				CurrentValue += Char;
-			}
-		}
-		else
-		{
-			if (Char == TEXT('"'))
-			{
-				bInQuotes = true;
-			}
-			else if (Char == TEXT(';'))
-			{
-				Result.Add(CurrentValue);
-				CurrentValue.Reset();
-			}
-			else
-			{
-				CurrentValue += Char;
-			}
-		}
-	}
-
-	Result.Add(CurrentValue);
+		Result.Add(AssetCsvSync_FromCoreView(Item));
+	});
 	return Result;
 }
 
 FString UAssetCsvSyncCSVHandler::JoinListCell(const TArray<FString>& Items)
 {
-	// Use separator-between (not trailing) so that ["a",""] round-trips as "a;"
-	// and [""] round-trips as "" (the quoted empty string), distinguishable from
-	// an absent/empty cell which ParseListCell treats as [].
+	// Separator-between (not trailing), and empty items quoted, so [""] and [] stay distinct.
 	FString Out;
-	for (int32 i = 0; i < Items.Num(); ++i)
+	AssetCsvSync::Core::JoinListCell<TCHAR>(Items.Num(), [&Items](size_t Index)
 	{
-		Out += EscapeListItem(Items[i]);
-		if (i < Items.Num() - 1)
-		{
-			Out += TEXT(";");
-		}
-	}
+		return AssetCsvSync_CoreView(Items[static_cast<int32>(Index)]);
+	}, FAssetCsvSyncCoreAppend{ Out });
 	return Out;
 }
@@ -266,4 +266,6 @@ void FAssetCsvSyncCSVImportSettingsCustomization::CustomizeDetails(IDetailLayout
 
 	ImportCategory.AddProperty(DataAssetHandle);
 	ImportCategory.AddProperty(SaveHandle);
+	ImportCategory.AddProperty(DetailBuilder.GetProperty(GET_MEMBER_NAME_CHECKED(UAssetCsvSyncCSVImportSettings, TableClass)));
+	ImportCategory.AddProperty(DetailBuilder.GetProperty(GET_MEMBER_NAME_CHECKED(UAssetCsvSyncCSVImportSettings, AssetFolder)));
 }
@@ -0,0 +1,262 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#include "AssetCsvSyncClassIndex.h"
+
+#include "AssetCsvSyncLog.h"
+#include "ExportableMetaData.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Engine/DataAsset.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
+
+struct FAssetCsvSyncClassIndexState
+{
+	// Exportable native classes by their /Script package, so a module's classes can be dropped when it unloads.
+	TMap<FName, TArray<FString>> NativeByPackage;
+	// Every exportable native class, abstract ones included: the native parents a Blueprint class may have.
+	TSet<FString> NativeParentClassPaths;
+	// The native classes listed themselves, which leaves out the abstract ones.
+	TSet<FString> NativeClassPaths;
+	TArray<FString> BlueprintClassPaths;
+	TArray<FString> Sorted;
+
+	bool bNativeDirty = true;
+	bool bBlueprintsDirty = true;
+	bool bSortedDirty = true;
+
+	FDelegateHandle ModulesChangedHandle;
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle PostEngineInitHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle FilesLoadedHandle;
+};
+
+static FAssetCsvSyncClassIndexState AssetCsvSync_ClassIndex;
+
+// Abstract classes qualify: they are not listed, but their Blueprint children are.
+static bool AssetCsvSync_IsExportableNativeClass(UClass* Class)
+{
+	return Class && Class->HasAnyClassFlags(CLASS_Native) && Class->IsChildOf(UDataAsset::StaticClass())
+		&& !Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists | CLASS_HideDropDown)
+		&& FExportableMetaData::IsExportable(Class);
+}
+
+static void AssetCsvSync_AddNativeClass(UClass* Class)
+{
+	if (!AssetCsvSync_IsExportableNativeClass(Class))
+		return;
+	const FString Path = Class->GetPathName();
+	AssetCsvSync_ClassIndex.NativeByPackage.FindOrAdd(Class->GetOutermost()->GetFName()).AddUnique(Path);
+	AssetCsvSync_ClassIndex.NativeParentClassPaths.Add(Path);
+	if (!Class->HasAnyClassFlags(CLASS_Abstract))
+	{
+		AssetCsvSync_ClassIndex.NativeClassPaths.Add(Path);
+	}
+}
+
+static void AssetCsvSync_RebuildNative()
+{
+	AssetCsvSync_ClassIndex.NativeByPackage.Reset();
+	AssetCsvSync_ClassIndex.NativeParentClassPaths.Reset();
+	AssetCsvSync_ClassIndex.NativeClassPaths.Reset();
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		AssetCsvSync_AddNativeClass(*It);
+	}
+	AssetCsvSync_ClassIndex.bNativeDirty = false;
+}
+
+static void AssetCsvSync_OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+	FAssetCsvSyncClassIndexState& State = AssetCsvSync_ClassIndex;
+	if (State.bNativeDirty)
+		return;
+
+	const FName PackageName(*(TEXT("/Script/") + ModuleName.ToString()));
+	if (Reason == EModuleChangeReason::ModuleLoaded)
+	{
+		if (UPackage* Package = FindPackage(nullptr, *PackageName.ToString()))
+		{
+			ForEachObjectWithPackage(Package, [](UObject* Object)
+			{
+				AssetCsvSync_AddNativeClass(Cast<UClass>(Object));
+				return true;
+			}, false);
+		}
+	}
+	else if (Reason == EModuleChangeReason::ModuleUnloaded)
+	{
+		TArray<FString> Removed;
+		if (State.NativeByPackage.RemoveAndCopyValue(PackageName, Removed))
+		{
+			for (const FString& Path : Removed)
+			{
+				State.NativeParentClassPaths.Remove(Path);
+				State.NativeClassPaths.Remove(Path);
+			}
+		}
+	}
+	else
+	{
+		return;
+	}
+
+	// Blueprints are matched against their native parent, which may have just appeared or gone away.
+	State.bBlueprintsDirty = true;
+	State.bSortedDirty = true;
+}
+
+// Reads the Blueprint assets' registry tags: an unloaded Blueprint class is exportable when its native parent is.
+static void AssetCsvSync_RebuildBlueprints()
+{
+	FAssetCsvSyncClassIndexState& State = AssetCsvSync_ClassIndex;
+	State.BlueprintClassPaths.Reset();
+	State.bBlueprintsDirty = false;
+	if (State.NativeParentClassPaths.IsEmpty())
+		return;
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	TArray<FAssetData> Blueprints;
+	AssetRegistry.GetAssets(Filter, Blueprints);
+
+	for (const FAssetData& Blueprint : Blueprints)
+	{
+		FString NativeParent;
+		FString GeneratedClass;
+		if (!Blueprint.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParent) || !Blueprint.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClass))
+			continue;
+		if (!State.NativeParentClassPaths.Contains(FPackageName::ExportTextPathToObjectPath(NativeParent)))
+			continue;
+
+		uint32 ClassFlags = 0;
+		FString ClassFlagsText;
+		if (Blueprint.GetTagValue(FBlueprintTags::ClassFlags, ClassFlagsText))
+		{
+			LexFromString(ClassFlags, *ClassFlagsText);
+		}
+		if (ClassFlags & (CLASS_Abstract | CLASS_Deprecated))
+			continue;
+
+		State.BlueprintClassPaths.Add(FPackageName::ExportTextPathToObjectPath(GeneratedClass));
+	}
+}
+
+static void AssetCsvSync_OnBlueprintAssetChanged(const FAssetData& AssetData)
+{
+	if (AssetData.TagsAndValues.Contains(FBlueprintTags::NativeParentClassPath))
+	{
+		AssetCsvSync_ClassIndex.bBlueprintsDirty = true;
+		AssetCsvSync_ClassIndex.bSortedDirty = true;
+	}
+}
+
+static void AssetCsvSync_InvalidateBlueprints()
+{
+	AssetCsvSync_ClassIndex.bBlueprintsDirty = true;
+	AssetCsvSync_ClassIndex.bSortedDirty = true;
+}
+
+static void AssetCsvSync_BindEditorEvents()
+{
+	// Compiling can reparent a Blueprint; the registry tags only follow on save.
+	if (GEditor && !AssetCsvSync_ClassIndex.BlueprintCompiledHandle.IsValid())
+	{
+		AssetCsvSync_ClassIndex.BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&AssetCsvSync_InvalidateBlueprints);
+	}
+}
+
+const TArray<FString>& FAssetCsvSyncClassIndex::GetExportableClassPaths()
+{
+	check(IsInGameThread());
+	FAssetCsvSyncClassIndexState& State = AssetCsvSync_ClassIndex;
+	if (!State.bNativeDirty && !State.bBlueprintsDirty && !State.bSortedDirty)
+		return State.Sorted;
+
+	const double StartTime = FPlatformTime::Seconds();
+	if (State.bNativeDirty)
+	{
+		AssetCsvSync_RebuildNative();
+		State.bBlueprintsDirty = true;
+	}
+	if (State.bBlueprintsDirty)
+	{
+		AssetCsvSync_RebuildBlueprints();
+	}
+
+	State.Sorted = State.NativeClassPaths.Array();
+	State.Sorted.Append(State.BlueprintClassPaths);
+	State.Sorted.Sort();
+	State.bSortedDirty = false;
+
+	UE_LOG(LogAssetCsvSync, Verbose, TEXT("ClassIndex: %d native and %d Blueprint class(es) indexed in %.2f ms"),
+		State.NativeClassPaths.Num(), State.BlueprintClassPaths.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return State.Sorted;
+}
+
+void FAssetCsvSyncClassIndex::Register()
+{
+	FAssetCsvSyncClassIndexState& State = AssetCsvSync_ClassIndex;
+	State.ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddStatic(&AssetCsvSync_OnModulesChanged);
+	State.ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason)
+	{
+		AssetCsvSync_ClassIndex.bNativeDirty = true;
+		AssetCsvSync_ClassIndex.bSortedDirty = true;
+	});
+
+	// The editor engine does not exist yet when the module starts with the editor.
+	if (GEditor)
+	{
+		AssetCsvSync_BindEditorEvents();
+	}
+	else
+	{
+		State.PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddStatic(&AssetCsvSync_BindEditorEvents);
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	State.AssetAddedHandle = AssetRegistry.OnAssetAdded().AddStatic(&AssetCsvSync_OnBlueprintAssetChanged);
+	State.AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddStatic(&AssetCsvSync_OnBlueprintAssetChanged);
+	State.AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddLambda([](const FAssetData& AssetData, const FString&)
+	{
+		AssetCsvSync_OnBlueprintAssetChanged(AssetData);
+	});
+	State.FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddStatic(&AssetCsvSync_InvalidateBlueprints);
+}
+
+void FAssetCsvSyncClassIndex::Unregister()
+{
+	FAssetCsvSyncClassIndexState& State = AssetCsvSync_ClassIndex;
+	FModuleManager::Get().OnModulesChanged().Remove(State.ModulesChangedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(State.ReloadCompleteHandle);
+	FCoreDelegates::OnPostEngineInit.Remove(State.PostEngineInitHandle);
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(State.BlueprintCompiledHandle);
+	}
+
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().Remove(State.AssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(State.AssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(State.AssetRenamedHandle);
+		AssetRegistry.OnFilesLoaded().Remove(State.FilesLoadedHandle);
+	}
+
+	State = FAssetCsvSyncClassIndexState();
+}
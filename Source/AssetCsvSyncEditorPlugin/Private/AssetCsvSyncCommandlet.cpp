@@ -0,0 +1,309 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#include "AssetCsvSyncCommandlet.h"
+
+#include "AssetCsvSyncCSVHandler.h"
+#include "AssetCsvSyncDirectorySync.h"
+#include "AssetCsvSyncEditorPluginSettings.h"
+#include "AssetCsvSyncLog.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+namespace AssetCsvSyncCommandlet
+{
+	// Collected while a mode runs and printed as one JSON object at the end.
+	struct FSummary
+	{
+		FString Mode;
+		bool bOk = false;
+		bool bDryRun = false;
+		int32 Rows = 0;
+		int32 Assets = 0;
+		int32 Created = 0;
+		int32 Changed = 0;
+		int32 Unchanged = 0;
+		int32 Restamped = 0;
+		int32 Failed = 0;
+		int32 PackagesSaved = 0;
+		int64 BytesRead = 0;
+		int64 BytesWritten = 0;
+		double PeakUsedPhysicalMB = 0.0;
+		int32 GarbageCollections = 0;
+		TArray<TPair<FString, double>> Phases;
+	};
+
+	static UClass* ResolveClass(const FString& ClassName)
+	{
+		if (ClassName.IsEmpty())
+			return nullptr;
+		// Full paths cover native (/Script/Module.Class) and Blueprint (/Game/BP_Data.BP_Data_C) classes.
+		if (ClassName.Contains(TEXT("/")))
+			return LoadObject<UClass>(nullptr, *ClassName);
+		return FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::NativeFirst);
+	}
+
+	static TArray<FString> SplitList(const FString& Value, const TCHAR* Delimiter)
+	{
+		TArray<FString> Items;
+		Value.ParseIntoArray(Items, Delimiter, true);
+		for (FString& Item : Items)
+		{
+			Item.TrimStartAndEndInline();
+		}
+		return Items;
+	}
+
+	static int64 FileSizeOrZero(const FString& Path)
+	{
+		return FMath::Max<int64>(0, IFileManager::Get().FileSize(*Path));
+	}
+
+	static FString SummaryToJson(const FSummary& Summary, double TotalSeconds)
+	{
+		FString Json;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("mode"), Summary.Mode);
+		Writer->WriteValue(TEXT("ok"), Summary.bOk);
+		Writer->WriteValue(TEXT("dryRun"), Summary.bDryRun);
+		Writer->WriteValue(TEXT("rows"), Summary.Rows);
+		Writer->WriteValue(TEXT("assets"), Summary.Assets);
+		Writer->WriteValue(TEXT("created"), Summary.Created);
+		Writer->WriteValue(TEXT("changed"), Summary.Changed);
+		Writer->WriteValue(TEXT("unchanged"), Summary.Unchanged);
+		Writer->WriteValue(TEXT("restamped"), Summary.Restamped);
+		Writer->WriteValue(TEXT("failed"), Summary.Failed);
+		Writer->WriteValue(TEXT("packagesSaved"), Summary.PackagesSaved);
+		Writer->WriteValue(TEXT("bytesRead"), Summary.BytesRead);
+		Writer->WriteValue(TEXT("bytesWritten"), Summary.BytesWritten);
+		Writer->WriteValue(TEXT("peakUsedPhysicalMB"), Summary.PeakUsedPhysicalMB);
+		Writer->WriteValue(TEXT("garbageCollections"), Summary.GarbageCollections);
+		Writer->WriteObjectStart(TEXT("phaseSeconds"));
+		for (const TPair<FString, double>& Phase : Summary.Phases)
+		{
+			Writer->WriteValue(Phase.Key, Phase.Value);
+		}
+		Writer->WriteObjectEnd();
+		Writer->WriteValue(TEXT("totalSeconds"), TotalSeconds);
+		Writer->WriteObjectEnd();
+		Writer->Close();
+		return Json;
+	}
+}
+
+UAssetCsvSyncCommandlet::UAssetCsvSyncCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UAssetCsvSyncCommandlet::Main(const FString& Params)
+{
+	using namespace AssetCsvSyncCommandlet;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamVals;
+	ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+	auto GetParam = [&ParamVals](const TCHAR* Name) -> FString
+	{
+		const FString* Value = ParamVals.Find(Name);
+		return Value ? Value->TrimQuotes() : FString();
+	};
+	auto HasSwitch = [&Switches](const TCHAR* Name)
+	{
+		return Switches.ContainsByPredicate([Name](const FString& Switch) { return Switch.Equals(Name, ESearchCase::IgnoreCase); });
+	};
+
+	FSummary Summary;
+	Summary.Mode = GetParam(TEXT("mode")).ToLower();
+	Summary.bDryRun = HasSwitch(TEXT("dryrun"));
+
+	const FString ThreadsParam = GetParam(TEXT("threads"));
+	if (!ThreadsParam.IsEmpty())
+	{
+		// Only for this process; the project setting on disk is left untouched.
+		GetMutableDefault<UAssetCsvSyncEditorPluginSettings>()->MaxWorkerThreads = FMath::Max(0, FCString::Atoi(*ThreadsParam));
+	}
+
+	// Pair keys only exist in sync mode; silently importing or exporting everything would be worse than stopping.
+	if (Summary.Mode != TEXT("sync") && (!GetParam(TEXT("include")).IsEmpty() || !GetParam(TEXT("exclude")).IsEmpty()))
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("AssetCsvSyncCommandlet: -include= and -exclude= only apply to -mode=sync"));
+		return 1;
+	}
+
+	const TArray<FString> Columns = SplitList(GetParam(TEXT("columns")), TEXT(","));
+	UClass* DataAssetClass = ResolveClass(GetParam(TEXT("class")));
+	if (!GetParam(TEXT("class")).IsEmpty() && !DataAssetClass)
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("AssetCsvSyncCommandlet: class '%s' not found"), *GetParam(TEXT("class")));
+		return 1;
+	}
+
+	if (Summary.Mode == TEXT("import"))
+	{
+		const FString CsvPath = GetParam(TEXT("csv"));
+		if (CsvPath.IsEmpty() || !DataAssetClass)
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("AssetCsvSyncCommandlet: import needs -csv= and -class="));
+			return 1;
+		}
+		const bool bRestamp = HasSwitch(TEXT("restamp"));
+		if (bRestamp && !Columns.IsEmpty())
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("AssetCsvSyncCommandlet: -restamp imports whole rows and cannot be combined with -columns="));
+			return 1;
+		}
+
+		const double PhaseStart = FPlatformTime::Seconds();
+		FAssetCsvSyncTableImportResult Result;
+		// The import saves exactly the packages it touched, as it goes, which also lets it release packages when it
+		// crosses the memory budget. Other dirty packages in the session are left alone.
+		Summary.bOk = bRestamp
+			? UAssetCsvSyncCSVHandler::RestampCSVTableAssets(CsvPath, DataAssetClass, GetParam(TEXT("folder")), !Summary.bDryRun, Result)
+			: UAssetCsvSyncCSVHandler::ImportCSVTableToDataAssets(CsvPath, DataAssetClass, GetParam(TEXT("folder")), Columns, !Summary.bDryRun, Result);
+		Summary.Phases.Emplace(TEXT("apply"), FPlatformTime::Seconds() - PhaseStart);
+
+		Summary.PackagesSaved = Result.PackagesSaved;
+		Summary.Rows = Result.Rows;
+		Summary.Assets = Result.Rows - Result.FailedRows;
+		Summary.Created = Result.AssetsCreated;
+		Summary.Changed = Result.AssetsChanged;
+		Summary.Unchanged = Result.AssetsUpToDate;
+		Summary.Restamped = Result.AssetsRestamped;
+		Summary.Failed = Result.FailedRows;
+		Summary.BytesRead = FileSizeOrZero(CsvPath);
+		Summary.PeakUsedPhysicalMB = Result.PeakUsedPhysicalMB;
+		Summary.GarbageCollections = Result.GarbageCollections;
+	}
+	else if (Summary.Mode == TEXT("export"))
+	{
+		const FString CsvPath = GetParam(TEXT("csv"));
+		if (CsvPath.IsEmpty() || !DataAssetClass)
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("AssetCsvSyncCommandlet: export needs -csv= and -class="));
+			return 1;
+		}
+
+		FAssetCsvSyncShardOptions Shards;
+		if (!GetParam(TEXT("shardby")).IsEmpty())
+		{
+			Shards.Mode = EAssetCsvSyncShardMode::PartitionColumn;
+			Shards.PartitionColumn = GetParam(TEXT("shardby"));
+		}
+		else if (!GetParam(TEXT("shardmb")).IsEmpty())
+		{
+			Shards.Mode = EAssetCsvSyncShardMode::ByteSize;
+			LexFromString(Shards.MaxShardSizeMB, *GetParam(TEXT("shardmb")));
+		}
+		else if (!GetParam(TEXT("shardrows")).IsEmpty())
+		{
+			Shards.Mode = EAssetCsvSyncShardMode::RowCount;
+			LexFromString(Shards.MaxRowsPerShard, *GetParam(TEXT("shardrows")));
+		}
+		const bool bSharded = Shards.Mode != EAssetCsvSyncShardMode::None;
+
+		// A dry run still formats everything, into scratch files that are measured and deleted.
+		const FString DryRunDir = FPaths::ProjectIntermediateDir() / TEXT("AssetCsvSyncDryRun");
+		const FString OutPath = !Summary.bDryRun ? CsvPath : bSharded ? DryRunDir / FPaths::GetCleanFilename(CsvPath) : FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("AssetCsvSyncDryRun"), TEXT(".csv"));
+
+		const double PhaseStart = FPlatformTime::Seconds();
+		FAssetCsvSyncBulkExportResult Result;
+		Summary.bOk = bSharded
+			? UAssetCsvSyncCSVHandler::ExportAllDataAssetsOfClassToShards(DataAssetClass, OutPath, Columns, !HasSwitch(TEXT("nosubclasses")), Shards, Result)
+			: UAssetCsvSyncCSVHandler::ExportAllDataAssetsOfClassToCSV(DataAssetClass, OutPath, Columns, !HasSwitch(TEXT("nosubclasses")), Result);
+		Summary.Phases.Emplace(TEXT("export"), FPlatformTime::Seconds() - PhaseStart);
+
+		Summary.Rows = Result.AssetsExported;
+		Summary.Assets = Result.AssetsExported;
+		Summary.Failed = Result.AssetsSkipped;
+		Summary.BytesWritten = FileSizeOrZero(OutPath);
+		Summary.PeakUsedPhysicalMB = Result.PeakUsedPhysicalMB;
+		Summary.GarbageCollections = Result.GarbageCollections;
+		if (bSharded)
+		{
+			// Shards are named <Manifest>.<Suffix>.csv next to the manifest.
+			FString ShardPrefix = FPaths::GetBaseFilename(OutPath);
+			ShardPrefix.RemoveFromEnd(TEXT(".manifest"));
+			TArray<FString> ShardFiles;
+			IFileManager::Get().FindFiles(ShardFiles, *(FPaths::GetPath(OutPath) / ShardPrefix + TEXT(".*.csv")), true, false);
+			for (const FString& ShardFile : ShardFiles)
+			{
+				Summary.BytesWritten += FileSizeOrZero(FPaths::GetPath(OutPath) / ShardFile);
+			}
+		}
+		if (Summary.bDryRun)
+		{
+			if (bSharded)
+			{
+				IFileManager::Get().DeleteDirectory(*DryRunDir, false, true);
+			}
+			else
+			{
+				IFileManager::Get().Delete(*OutPath);
+			}
+		}
+	}
+	else if (Summary.Mode == TEXT("sync"))
+	{
+		FAssetCsvSyncDirectorySyncOptions Options;
+		Options.CsvDirectory = GetParam(TEXT("csvdir"));
+		Options.ContentPath = GetParam(TEXT("folder"));
+		Options.DataAssetClass = DataAssetClass;
+		const FString Direction = GetParam(TEXT("direction"));
+		Options.Direction = Direction.Equals(TEXT("export"), ESearchCase::IgnoreCase) ? EAssetCsvSyncDirection::Export
+			: Direction.Equals(TEXT("both"), ESearchCase::IgnoreCase) ? EAssetCsvSyncDirection::Both
+			: EAssetCsvSyncDirection::Import;
+		Options.IncludePatterns = SplitList(GetParam(TEXT("include")), TEXT(";"));
+		Options.ExcludePatterns = SplitList(GetParam(TEXT("exclude")), TEXT(";"));
+		Options.bDryRun = Summary.bDryRun;
+		Options.bIncremental = !HasSwitch(TEXT("full"));
+		Options.ManifestPath = GetParam(TEXT("manifest"));
+
+		FAssetCsvSyncDirectorySyncResult Result;
+		Summary.bOk = FAssetCsvSyncDirectorySync::Run(Options, Result);
+		Summary.Phases.Emplace(TEXT("discover"), Result.DiscoverSeconds);
+		Summary.Phases.Emplace(TEXT("sync"), Result.SyncSeconds);
+		Summary.Phases.Emplace(TEXT("save"), Result.SaveSeconds);
+
+		Summary.Rows = Result.Imported + Result.Exported;
+		Summary.Assets = Result.Pairs;
+		Summary.Created = Result.Created;
+		Summary.Changed = Result.Imported + Result.Exported;
+		Summary.Unchanged = Result.Unchanged;
+		Summary.Failed = Result.Failed;
+		Summary.PackagesSaved = Result.PackagesSaved;
+		Summary.BytesRead = Result.BytesRead;
+		Summary.BytesWritten = Result.BytesWritten;
+		Summary.PeakUsedPhysicalMB = Result.PeakUsedPhysicalMB;
+		Summary.GarbageCollections = Result.GarbageCollections;
+	}
+	else
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("AssetCsvSyncCommandlet: unknown -mode='%s' (expected import, export or sync)"), *Summary.Mode);
+		return 1;
+	}
+
+	const FString Json = SummaryToJson(Summary, FPlatformTime::Seconds() - StartTime);
+	UE_LOG(LogAssetCsvSync, Display, TEXT("AssetCsvSyncSummary: %s"), *Json);
+
+	const FString SummaryPath = GetParam(TEXT("summary"));
+	if (!SummaryPath.IsEmpty())
+	{
+		FFileHelper::SaveStringToFile(Json, *SummaryPath);
+	}
+
+	return Summary.bOk ? 0 : 1;
+}
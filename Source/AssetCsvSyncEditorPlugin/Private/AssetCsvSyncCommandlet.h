@@ -0,0 +1,45 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AssetCsvSyncCommandlet.generated.h"
+
+/**
+ * Headless CSV <-> DataAsset sync for build machines.
+ *
+ * UnrealEditor-Cmd <Project> -run=AssetCsvSync -mode=import -csv=<File> -class=<ClassPath> -folder=/Game/Data
+ * UnrealEditor-Cmd <Project> -run=AssetCsvSync -mode=export -csv=<File> -class=<ClassPath> [-nosubclasses]
+ * UnrealEditor-Cmd <Project> -run=AssetCsvSync -mode=sync -csvdir=<Dir> -folder=/Game/Data [-class=<ClassPath>] [-direction=import|export|both]
+ *
+ * Common options:
+ *   -columns=A,B         Only import/export these columns.
+ *   -include=P1;P2       Sync mode: wildcards on the pair key; an error in other modes.
+ *   -exclude=P1;P2
+ *   -threads=N           Cap worker threads (0 = all, 1 = inline).
+ *   -dryrun              Do not save packages or write CSVs.
+ *   -summary=<File>      Also write the JSON summary to a file.
+ *   -full                Sync mode: ignore the manifest and process every pair.
+ *   -manifest=<File>     Sync mode: manifest location (default Saved/AssetCsvSync/).
+ *   -shardrows=N         Export mode: split into shards of N rows; -csv= is then the shard manifest (.json).
+ *   -shardmb=N           Export mode: split into shards of about N MB.
+ *   -shardby=Column      Export mode: one shard per value of Column.
+ *
+ *   -restamp             Import mode: also stamp and save the assets the table leaves unchanged, so later
+ *                        imports skip them without loading (whole rows only; not with -columns=).
+ *
+ * Import mode also accepts a shard manifest as -csv=.
+ *
+ * A single-line JSON summary is always logged with the prefix "AssetCsvSyncSummary:".
+ */
+UCLASS()
+class UAssetCsvSyncCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAssetCsvSyncCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
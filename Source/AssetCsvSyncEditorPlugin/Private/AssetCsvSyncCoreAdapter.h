@@ -0,0 +1,53 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "AssetCsvSyncCore/CellCodec.h"
+#include "AssetCsvSyncCore/CsvCodec.h"
+#include "AssetCsvSyncCore/NumberFormat.h"
+
+#include <string_view>
+
+// FString side of the engine-independent cell codecs in Source/AssetCsvSyncCore. The codecs run on the TCHARs of
+// an FString in place; cells they parse are views that are copied into FStrings only by the caller.
+using FAssetCsvSyncCoreView = std::basic_string_view<TCHAR>;
+
+inline FAssetCsvSyncCoreView AssetCsvSync_CoreView(const FString& Value)
+{
+	return FAssetCsvSyncCoreView(*Value, Value.Len());
+}
+
+inline FString AssetCsvSync_FromCoreView(FAssetCsvSyncCoreView Value)
+{
+	FString Out;
+	Out.AppendChars(Value.data(), static_cast<int32>(Value.size()));
+	return Out;
+}
+
+// Appends codec output to an FString.
+struct FAssetCsvSyncCoreAppend
+{
+	FString& Out;
+
+	void operator()(const TCHAR* Data, size_t Len) const
+	{
+		Out.AppendChars(Data, static_cast<int32>(Len));
+	}
+};
+
+inline FString AssetCsvSync_FormatInteger(int64 Value)
+{
+	FString Out;
+	AssetCsvSync::Core::FormatInteger<TCHAR>(Value, FAssetCsvSyncCoreAppend{ Out });
+	return Out;
+}
+
+// Same text as FString::SanitizeFloat, without its intermediate strings.
+inline FString AssetCsvSync_FormatDecimal(double Value)
+{
+	FString Out;
+	AssetCsvSync::Core::FormatDecimal<TCHAR>(Value, FAssetCsvSyncCoreAppend{ Out });
+	return Out;
+}
@@ -0,0 +1,547 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#include "AssetCsvSyncDirectorySync.h"
+
+#include "AssetCsvSyncCSVHandler.h"
+#include "AssetCsvSyncCoreAdapter.h"
+#include "AssetCsvSyncLog.h"
+#include "AssetCsvSyncSourceStamp.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Dom/JsonObject.h"
+#include "Engine/DataAsset.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+
+namespace AssetCsvSyncDirectorySync
+{
+	// Identity of one file as of the last sync. Hash is only recomputed when size or timestamp moved.
+	struct FFileFingerprint
+	{
+		int64 Size = -1;
+		int64 Timestamp = 0;
+		FString Hash;
+
+		bool IsSet() const
+		{
+			return Size >= 0;
+		}
+	};
+
+	struct FManifestEntry
+	{
+		FFileFingerprint Csv;
+		FFileFingerprint Asset;
+		FString LastDirection;
+	};
+
+	struct FCsvEntry
+	{
+		FString Key;
+		FString Path;
+		FFileStatData Stat;
+	};
+
+	struct FAssetEntry
+	{
+		FString Key;
+		FAssetData AssetData;
+		FString Filename;
+		FFileStatData Stat;
+	};
+
+	static const int32 ManifestVersion = 1;
+
+	static FString NormalizeContentPath(const FString& InPath)
+	{
+		FString Path = InPath;
+		Path.TrimStartAndEndInline();
+		Path.RemoveFromEnd(TEXT("/"));
+		return Path;
+	}
+
+	static FString DefaultManifestPath(const FString& CsvDirectory, const FString& ContentPath)
+	{
+		const FString Id = FMD5::HashAnsiString(*(CsvDirectory.ToLower() + TEXT("|") + ContentPath.ToLower())).Left(16);
+		return FPaths::ProjectSavedDir() / TEXT("AssetCsvSync") / FString::Printf(TEXT("Manifest_%s.json"), *Id);
+	}
+
+	static bool LoadManifest(const FString& Path, TMap<FString, FManifestEntry>& OutEntries)
+	{
+		FString Text;
+		if (!FFileHelper::LoadFileToString(Text, *Path))
+			return false;
+
+		TSharedPtr<FJsonObject> Root;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Text);
+		if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || Root->GetIntegerField(TEXT("version")) != ManifestVersion)
+		{
+			UE_LOG(LogAssetCsvSync, Warning, TEXT("DirectorySync: ignoring unreadable manifest %s"), *Path);
+			return false;
+		}
+
+		auto ReadFingerprint = [](const TSharedPtr<FJsonObject>& Object, const TCHAR* Prefix, FFileFingerprint& Out)
+		{
+			FString SizeString;
+			FString TimeString;
+			if (!Object->TryGetStringField(FString(Prefix) + TEXT("Size"), SizeString) || !Object->TryGetStringField(FString(Prefix) + TEXT("Time"), TimeString))
+				return;
+			LexFromString(Out.Size, *SizeString);
+			LexFromString(Out.Timestamp, *TimeString);
+			Object->TryGetStringField(FString(Prefix) + TEXT("Hash"), Out.Hash);
+		};
+
+		for (const TSharedPtr<FJsonValue>& Value : Root->GetArrayField(TEXT("entries")))
+		{
+			const TSharedPtr<FJsonObject> Object = Value.IsValid() ? Value->AsObject() : nullptr;
+			FString Key;
+			if (!Object.IsValid() || !Object->TryGetStringField(TEXT("key"), Key))
+				continue;
+			FManifestEntry& Entry = OutEntries.Add(Key);
+			ReadFingerprint(Object, TEXT("csv"), Entry.Csv);
+			ReadFingerprint(Object, TEXT("asset"), Entry.Asset);
+			Object->TryGetStringField(TEXT("direction"), Entry.LastDirection);
+		}
+		return true;
+	}
+
+	static bool SaveManifest(const FString& Path, const TMap<FString, FManifestEntry>& Entries)
+	{
+		TArray<FString> Keys;
+		Entries.GetKeys(Keys);
+		Keys.Sort();
+
+		// 64-bit values are written as strings; JSON numbers are doubles.
+		FString Text;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Text);
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("version"), ManifestVersion);
+		Writer->WriteArrayStart(TEXT("entries"));
+		for (const FString& Key : Keys)
+		{
+			const FManifestEntry& Entry = Entries.FindChecked(Key);
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("key"), Key);
+			if (Entry.Csv.IsSet())
+			{
+				Writer->WriteValue(TEXT("csvSize"), LexToString(Entry.Csv.Size));
+				Writer->WriteValue(TEXT("csvTime"), LexToString(Entry.Csv.Timestamp));
+				Writer->WriteValue(TEXT("csvHash"), Entry.Csv.Hash);
+			}
+			if (Entry.Asset.IsSet())
+			{
+				Writer->WriteValue(TEXT("assetSize"), LexToString(Entry.Asset.Size));
+				Writer->WriteValue(TEXT("assetTime"), LexToString(Entry.Asset.Timestamp));
+				Writer->WriteValue(TEXT("assetHash"), Entry.Asset.Hash);
+			}
+			Writer->WriteValue(TEXT("direction"), Entry.LastDirection);
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+		Writer->WriteObjectEnd();
+		Writer->Close();
+
+		return FFileHelper::SaveStringToFile(Text, *Path);
+	}
+
+	static FFileFingerprint MakeFingerprint(const FString& Path, const FFileStatData& Stat, const FFileFingerprint* Known)
+	{
+		FFileFingerprint Result;
+		if (!Stat.bIsValid)
+			return Result;
+		Result.Size = Stat.FileSize;
+		Result.Timestamp = Stat.ModificationTime.GetTicks();
+		// Fast path: same size and timestamp as last time means the same content.
+		if (Known && Known->IsSet() && Known->Size == Result.Size && Known->Timestamp == Result.Timestamp)
+		{
+			Result.Hash = Known->Hash;
+		}
+		else
+		{
+			Result.Hash = LexToString(FMD5Hash::HashFile(*Path));
+		}
+		return Result;
+	}
+
+	static bool SameContent(const FFileFingerprint& Current, const FFileFingerprint& Known)
+	{
+		return Current.IsSet() && Known.IsSet() && Current.Hash == Known.Hash;
+	}
+
+	// Covers pairs the manifest cannot vouch for (first run, -full, another machine's import):
+	// the asset's registry tags say which CSV row it was last imported from.
+	static bool IsImportUpToDate(const FCsvEntry& Csv, const FAssetEntry& Asset, TMap<UClass*, FString>& SchemaByClass)
+	{
+		UClass* Class = Asset.AssetData.GetClass();
+		if (!Class || !Asset.AssetData.FindTag(FAssetCsvSyncSourceStamp::RowHashTag))
+			return false;
+
+		FString Content;
+		if (!FFileHelper::LoadFileToString(Content, *Csv.Path))
+			return false;
+		// Records, not lines: quoted cells may contain line breaks.
+		size_t Pos = 0;
+		FAssetCsvSyncCoreView HeaderRecord;
+		FAssetCsvSyncCoreView ValueRecord;
+		if (!AssetCsvSync::Core::ReadCsvRecord(AssetCsvSync_CoreView(Content), Pos, HeaderRecord) || !AssetCsvSync::Core::ReadCsvRecord(AssetCsvSync_CoreView(Content), Pos, ValueRecord))
+			return false;
+
+		FString* Schema = SchemaByClass.Find(Class);
+		if (!Schema)
+		{
+			Schema = &SchemaByClass.Add(Class, FAssetCsvSyncSourceStamp::GetSchema(Class));
+		}
+		return FAssetCsvSyncSourceStamp::IsUpToDate(Asset.AssetData, FAssetCsvSyncSourceStamp::HashRow(AssetCsvSync_FromCoreView(HeaderRecord), AssetCsvSync_FromCoreView(ValueRecord)), *Schema);
+	}
+}
+
+bool FAssetCsvSyncDirectorySync::MatchesFilters(const FString& Key, const TArray<FString>& IncludePatterns, const TArray<FString>& ExcludePatterns)
+{
+	bool bIncluded = IncludePatterns.IsEmpty();
+	for (const FString& Pattern : IncludePatterns)
+	{
+		if (Key.MatchesWildcard(Pattern))
+		{
+			bIncluded = true;
+			break;
+		}
+	}
+	if (!bIncluded)
+		return false;
+
+	for (const FString& Pattern : ExcludePatterns)
+	{
+		if (Key.MatchesWildcard(Pattern))
+			return false;
+	}
+	return true;
+}
+
+bool FAssetCsvSyncDirectorySync::Run(const FAssetCsvSyncDirectorySyncOptions& Options, FAssetCsvSyncDirectorySyncResult& OutResult)
+{
+	using namespace AssetCsvSyncDirectorySync;
+
+	OutResult = FAssetCsvSyncDirectorySyncResult();
+
+	FString CsvDirectory = FPaths::ConvertRelativePathToFull(Options.CsvDirectory);
+	FPaths::NormalizeDirectoryName(CsvDirectory);
+	const FString ContentPath = NormalizeContentPath(Options.ContentPath);
+	FString ContentDirectory;
+	if (CsvDirectory.IsEmpty() || !FPackageName::IsValidLongPackageName(ContentPath) || !FPackageName::TryConvertLongPackageNameToFilename(ContentPath, ContentDirectory))
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("DirectorySync: invalid CsvDirectory '%s' or ContentPath '%s'"), *Options.CsvDirectory, *Options.ContentPath);
+		return false;
+	}
+	ContentDirectory = FPaths::ConvertRelativePathToFull(ContentDirectory);
+
+	const FString ManifestPath = Options.ManifestPath.IsEmpty() ? DefaultManifestPath(CsvDirectory, ContentPath) : Options.ManifestPath;
+	TMap<FString, FManifestEntry> Manifest;
+	if (Options.bIncremental)
+	{
+		LoadManifest(ManifestPath, Manifest);
+	}
+
+	// Discover both sides with one directory stat walk each, keyed by relative path, then sort for the merge-join.
+	double PhaseStart = FPlatformTime::Seconds();
+
+	TArray<FCsvEntry> CsvEntries;
+	IFileManager::Get().IterateDirectoryStatRecursively(*CsvDirectory, [&](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+	{
+		const FString File(FilenameOrDirectory);
+		if (StatData.bIsDirectory || !File.EndsWith(TEXT(".csv"), ESearchCase::IgnoreCase))
+			return true;
+		FString Key = FPaths::GetBaseFilename(File, false);
+		FPaths::MakePathRelativeTo(Key, *(CsvDirectory + TEXT("/")));
+		Key.ReplaceInline(TEXT("\\"), TEXT("/"));
+		if (MatchesFilters(Key, Options.IncludePatterns, Options.ExcludePatterns))
+		{
+			CsvEntries.Add({ MoveTemp(Key), File, StatData });
+		}
+		return true;
+	});
+
+	TMap<FString, FFileStatData> PackageFileStats;
+	IFileManager::Get().IterateDirectoryStatRecursively(*ContentDirectory, [&PackageFileStats](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+	{
+		if (!StatData.bIsDirectory && FCString::Stricmp(*FPaths::GetExtension(FilenameOrDirectory, true), *FPackageName::GetAssetPackageExtension()) == 0)
+		{
+			PackageFileStats.Add(FPaths::ConvertRelativePathToFull(FilenameOrDirectory), StatData);
+		}
+		return true;
+	});
+
+	TArray<FAssetEntry> AssetEntries;
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		if (AssetRegistry.IsLoadingAssets())
+		{
+			AssetRegistry.WaitForCompletion();
+		}
+
+		FARFilter Filter;
+		Filter.PackagePaths.Add(FName(*ContentPath));
+		Filter.bRecursivePaths = true;
+		Filter.ClassPaths.Add((Options.DataAssetClass ? Options.DataAssetClass : UDataAsset::StaticClass())->GetClassPathName());
+		Filter.bRecursiveClasses = true;
+
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssets(Filter, Assets);
+		AssetEntries.Reserve(Assets.Num());
+		for (FAssetData& AssetData : Assets)
+		{
+			const FString PackageName = AssetData.PackageName.ToString();
+			FString Key = PackageName.Mid(ContentPath.Len() + 1);
+			if (!MatchesFilters(Key, Options.IncludePatterns, Options.ExcludePatterns))
+				continue;
+			FAssetEntry& Entry = AssetEntries.AddDefaulted_GetRef();
+			Entry.Key = MoveTemp(Key);
+			Entry.AssetData = MoveTemp(AssetData);
+			Entry.Filename = FPaths::ConvertRelativePathToFull(FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension()));
+			if (const FFileStatData* Stat = PackageFileStats.Find(Entry.Filename))
+			{
+				Entry.Stat = *Stat;
+			}
+		}
+	}
+
+	CsvEntries.Sort([](const FCsvEntry& A, const FCsvEntry& B) { return A.Key < B.Key; });
+	AssetEntries.Sort([](const FAssetEntry& A, const FAssetEntry& B) { return A.Key < B.Key; });
+	OutResult.DiscoverSeconds = FPlatformTime::Seconds() - PhaseStart;
+
+	PhaseStart = FPlatformTime::Seconds();
+	FAssetCsvSyncBulkImportScope BulkImport;
+	TArray<UPackage*> PackagesToSave;
+	// Packages the sync loaded or created itself; released again when the process crosses MemoryBudgetMB.
+	TArray<TWeakObjectPtr<UPackage>> LoadedPackages;
+	uint64 PeakUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+	TMap<FString, FManifestEntry> NewManifest;
+	NewManifest.Reserve(FMath::Max(CsvEntries.Num(), AssetEntries.Num()));
+	// Imported pairs whose asset fingerprint can only be taken once the package is saved.
+	TArray<TPair<FString, FString>> PendingAssetFingerprints;
+	TMap<UClass*, FString> SchemaByClass;
+
+	auto ImportPair = [&](const FString& Key, const FCsvEntry& Csv, const FAssetEntry* Asset) -> bool
+	{
+		UClass* Class = Options.DataAssetClass;
+		const bool bWasLoaded = Asset && FindPackage(nullptr, *Asset->AssetData.PackageName.ToString());
+		if (Asset)
+		{
+			UDataAsset* Existing = Cast<UDataAsset>(Asset->AssetData.GetAsset());
+			Class = Existing ? Existing->GetClass() : Class;
+		}
+		if (!Class)
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("DirectorySync: no DataAssetClass to create %s from %s"), *Key, *Csv.Path);
+			return false;
+		}
+
+		UDataAsset* DataAsset = nullptr;
+		if (!UAssetCsvSyncCSVHandler::ImportCSVToNewDataAsset(Csv.Path, ContentPath + TEXT("/") + Key, Class, DataAsset, false) || !DataAsset)
+			return false;
+		if (!bWasLoaded)
+		{
+			LoadedPackages.Add(DataAsset->GetPackage());
+		}
+
+		++OutResult.Imported;
+		OutResult.Created += Asset ? 0 : 1;
+		OutResult.BytesRead += Csv.Stat.FileSize;
+		if (DataAsset->GetPackage()->IsDirty())
+		{
+			PackagesToSave.AddUnique(DataAsset->GetPackage());
+		}
+		return true;
+	};
+
+	auto ExportPair = [&](const FString& Key, const FAssetEntry& Asset, FString& OutCsvPath) -> bool
+	{
+		const bool bWasLoaded = FindPackage(nullptr, *Asset.AssetData.PackageName.ToString()) != nullptr;
+		UDataAsset* DataAsset = Cast<UDataAsset>(Asset.AssetData.GetAsset());
+		if (!DataAsset)
+		{
+			UE_LOG(LogAssetCsvSync, Error, TEXT("DirectorySync: could not load %s"), *Asset.AssetData.GetObjectPathString());
+			return false;
+		}
+		if (!bWasLoaded)
+		{
+			LoadedPackages.Add(DataAsset->GetPackage());
+		}
+
+		++OutResult.Exported;
+		if (Options.bDryRun)
+			return true;
+
+		OutCsvPath = CsvDirectory / Key + TEXT(".csv");
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutCsvPath), true);
+		if (!UAssetCsvSyncCSVHandler::ExportDataAssetToCSV(DataAsset, OutCsvPath))
+		{
+			--OutResult.Exported;
+			return false;
+		}
+		OutResult.BytesWritten += FMath::Max<int64>(0, IFileManager::Get().FileSize(*OutCsvPath));
+		return true;
+	};
+
+	// Sorted merge-join: each key is visited once, whether it exists on one side or both.
+	int32 CsvIndex = 0;
+	int32 AssetIndex = 0;
+	while (CsvIndex < CsvEntries.Num() || AssetIndex < AssetEntries.Num())
+	{
+		PeakUsedPhysical = FMath::Max<uint64>(PeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical);
+		if (!LoadedPackages.IsEmpty() && UAssetCsvSyncCSVHandler::IsOverMemoryBudget())
+		{
+			// Saved packages become clean and can be released; on a dry run only unchanged ones can.
+			if (!Options.bDryRun)
+			{
+				OutResult.PackagesSaved += UAssetCsvSyncCSVHandler::SavePackages(PackagesToSave);
+				PackagesToSave.Reset();
+			}
+			UAssetCsvSyncCSVHandler::ReleasePackagesAndCollect(LoadedPackages);
+			LoadedPackages.RemoveAll([](const TWeakObjectPtr<UPackage>& Package) { return !Package.IsValid(); });
+			++OutResult.GarbageCollections;
+		}
+
+		const FCsvEntry* Csv = CsvIndex < CsvEntries.Num() ? &CsvEntries[CsvIndex] : nullptr;
+		const FAssetEntry* Asset = AssetIndex < AssetEntries.Num() ? &AssetEntries[AssetIndex] : nullptr;
+		const int32 Order = !Csv ? 1 : !Asset ? -1 : Csv->Key.Compare(Asset->Key, ESearchCase::IgnoreCase);
+		if (Order < 0)
+		{
+			Asset = nullptr;
+			++CsvIndex;
+		}
+		else if (Order > 0)
+		{
+			Csv = nullptr;
+			++AssetIndex;
+		}
+		else
+		{
+			++CsvIndex;
+			++AssetIndex;
+		}
+
+		++OutResult.Pairs;
+		const FString& Key = Csv ? Csv->Key : Asset->Key;
+		const FManifestEntry* Known = Manifest.Find(Key);
+
+		FManifestEntry Entry;
+		if (Csv)
+		{
+			Entry.Csv = MakeFingerprint(Csv->Path, Csv->Stat, Known ? &Known->Csv : nullptr);
+		}
+		if (Asset)
+		{
+			Entry.Asset = MakeFingerprint(Asset->Filename, Asset->Stat, Known ? &Known->Asset : nullptr);
+		}
+		Entry.LastDirection = Known ? Known->LastDirection : FString();
+
+		// Unsaved edits in the editor are newer than anything on disk.
+		const UPackage* LoadedPackage = Asset ? FindPackage(nullptr, *Asset->AssetData.PackageName.ToString()) : nullptr;
+		const bool bAssetDirtyInMemory = LoadedPackage && LoadedPackage->IsDirty();
+		const bool bCsvChanged = Csv && (!Known || !SameContent(Entry.Csv, Known->Csv));
+		const bool bAssetChanged = Asset && (!Known || bAssetDirtyInMemory || !SameContent(Entry.Asset, Known->Asset));
+
+		bool bImport = false;
+		bool bExport = false;
+		switch (Options.Direction)
+		{
+		case EAssetCsvSyncDirection::Import:
+			bImport = Csv && (!Asset || bCsvChanged || bAssetChanged);
+			break;
+		case EAssetCsvSyncDirection::Export:
+			bExport = Asset && (!Csv || bCsvChanged || bAssetChanged);
+			break;
+		case EAssetCsvSyncDirection::Both:
+			if (Csv && Asset && bCsvChanged && bAssetChanged && Known)
+			{
+				UE_LOG(LogAssetCsvSync, Warning, TEXT("DirectorySync: %s changed on both sides since the last sync; the CSV wins"), *Key);
+			}
+			bImport = Csv && (!Asset || bCsvChanged);
+			bExport = !bImport && Asset && (!Csv || bAssetChanged);
+			break;
+		}
+		if (!Options.bIncremental)
+		{
+			bImport = Csv && Options.Direction != EAssetCsvSyncDirection::Export;
+			bExport = !bImport && Asset && Options.Direction != EAssetCsvSyncDirection::Import;
+		}
+
+		if (bImport && Asset && IsImportUpToDate(*Csv, *Asset, SchemaByClass))
+		{
+			++OutResult.Unchanged;
+		}
+		else if (bImport)
+		{
+			if (!ImportPair(Key, *Csv, Asset))
+			{
+				++OutResult.Failed;
+				if (Known)
+				{
+					NewManifest.Add(Key, *Known);
+				}
+				continue;
+			}
+			Entry.LastDirection = TEXT("import");
+			PendingAssetFingerprints.Emplace(Key, FPaths::ConvertRelativePathToFull(FPackageName::LongPackageNameToFilename(ContentPath / Key, FPackageName::GetAssetPackageExtension())));
+		}
+		else if (bExport)
+		{
+			FString CsvPath;
+			if (!ExportPair(Key, *Asset, CsvPath))
+			{
+				++OutResult.Failed;
+				if (Known)
+				{
+					NewManifest.Add(Key, *Known);
+				}
+				continue;
+			}
+			Entry.LastDirection = TEXT("export");
+			if (!CsvPath.IsEmpty())
+			{
+				Entry.Csv = MakeFingerprint(CsvPath, IFileManager::Get().GetStatData(*CsvPath), nullptr);
+			}
+		}
+		else if (Csv && Asset && !bCsvChanged && !bAssetChanged)
+		{
+			++OutResult.Unchanged;
+		}
+
+		NewManifest.Add(Key, MoveTemp(Entry));
+	}
+	OutResult.SyncSeconds = FPlatformTime::Seconds() - PhaseStart;
+	OutResult.PeakUsedPhysicalMB = FMath::Max<uint64>(PeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical) / (1024.0 * 1024.0);
+
+	PhaseStart = FPlatformTime::Seconds();
+	if (!Options.bDryRun)
+	{
+		OutResult.PackagesSaved += UAssetCsvSyncCSVHandler::SavePackages(PackagesToSave);
+
+		// The saved .uasset is the asset side's new baseline.
+		for (const TPair<FString, FString>& Pending : PendingAssetFingerprints)
+		{
+			NewManifest.FindChecked(Pending.Key).Asset = MakeFingerprint(Pending.Value, IFileManager::Get().GetStatData(*Pending.Value), nullptr);
+		}
+
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(ManifestPath), true);
+		if (!SaveManifest(ManifestPath, NewManifest))
+		{
+			UE_LOG(LogAssetCsvSync, Warning, TEXT("DirectorySync: could not write manifest %s"), *ManifestPath);
+		}
+	}
+	OutResult.SaveSeconds = FPlatformTime::Seconds() - PhaseStart;
+
+	UE_LOG(LogAssetCsvSync, Log, TEXT("DirectorySync: %d pairs (%d unchanged), %d imported (%d created), %d exported, %d saved, %d failed, peak %.1f MB used, %d GC pass(es)%s"),
+		OutResult.Pairs, OutResult.Unchanged, OutResult.Imported, OutResult.Created, OutResult.Exported, OutResult.PackagesSaved, OutResult.Failed,
+		OutResult.PeakUsedPhysicalMB, OutResult.GarbageCollections, Options.bDryRun ? TEXT(" (dry run)") : TEXT(""));
+	return OutResult.Failed == 0;
+}
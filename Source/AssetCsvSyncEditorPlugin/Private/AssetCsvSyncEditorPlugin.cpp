@@ -5,7 +5,10 @@
 #include "SAssetCsvSyncEditorPanel.h"
 #include "AssetCsvSyncCSVExportSettingsCustomization.h"
 #include "AssetCsvSyncCSVImportSettingsCustomization.h"
+#include "AssetCsvSyncClassIndex.h"
+#include "AssetCsvSyncJobs.h"
 #include "AssetCsvSyncLog.h"
+#include "AssetCsvSyncSourceStamp.h"
 
 #include "Framework/Commands/UIAction.h"
 #include "Framework/Docking/TabManager.h"
@@ -36,12 +39,19 @@ void FAssetCsvSyncEditorPluginModule::StartupModule()
 		TEXT("AssetCsvSyncCSVImportSettings"),
 		FOnGetDetailCustomizationInstance::CreateStatic(&FAssetCsvSyncCSVImportSettingsCustomization::MakeInstance));
 	PropertyEditorModule.NotifyCustomizationModuleChanged();
+
+	FAssetCsvSyncSourceStamp::Register();
+	FAssetCsvSyncClassIndex::Register();
 }
 
 void FAssetCsvSyncEditorPluginModule::ShutdownModule()
 {
 	UE_LOG(LogAssetCsvSync, Log, TEXT("AssetCsvSyncEditorPlugin: Shutdown"));
 
+	FAssetCsvSyncJobQueue::Get().Shutdown();
+	FAssetCsvSyncSourceStamp::Unregister();
+	FAssetCsvSyncClassIndex::Unregister();
+
 	if (FModuleManager::Get().IsModuleLoaded(TEXT("PropertyEditor")))
 	{
 		FPropertyEditorModule& PropertyEditorModule = FModuleManager::GetModuleChecked<FPropertyEditorModule>(TEXT("PropertyEditor"));
@@ -0,0 +1,300 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#include "AssetCsvSyncJobs.h"
+
+#include "AssetCsvSyncEditorPluginSettings.h"
+#include "AssetCsvSyncLog.h"
+
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/UObjectGlobals.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+FAssetCsvSyncJob::FAssetCsvSyncJob(const FText& InName)
+	: Name(InName)
+{
+}
+
+FAssetCsvSyncJob& FAssetCsvSyncJob::AddBackgroundStage(FBackgroundWork Work)
+{
+	Stages.Add({ MoveTemp(Work), FGameThreadStep() });
+	return *this;
+}
+
+FAssetCsvSyncJob& FAssetCsvSyncJob::AddGameThreadStage(FGameThreadStep Step)
+{
+	Stages.Add({ FBackgroundWork(), MoveTemp(Step) });
+	return *this;
+}
+
+FAssetCsvSyncJob& FAssetCsvSyncJob::OnFinished(FFinished Callback)
+{
+	Finished = MoveTemp(Callback);
+	return *this;
+}
+
+void FAssetCsvSyncJob::Cancel()
+{
+	bCancelled = true;
+}
+
+bool FAssetCsvSyncJob::IsCancelled() const
+{
+	return bCancelled;
+}
+
+void FAssetCsvSyncJob::SetProgress(float Fraction, const FText& InStatus)
+{
+	FScopeLock Lock(&ProgressLock);
+	Progress = FMath::Clamp(Fraction, 0.0f, 1.0f);
+	if (!InStatus.IsEmpty())
+	{
+		Status = InStatus;
+	}
+}
+
+float FAssetCsvSyncJob::GetProgress() const
+{
+	FScopeLock Lock(&ProgressLock);
+	return Progress;
+}
+
+FText FAssetCsvSyncJob::GetStatus() const
+{
+	FScopeLock Lock(&ProgressLock);
+	return Status;
+}
+
+double FAssetCsvSyncJob::GetSliceSecondsLeft() const
+{
+	return FMath::Max(0.0, SliceDeadline - FPlatformTime::Seconds());
+}
+
+FAssetCsvSyncJobQueue& FAssetCsvSyncJobQueue::Get()
+{
+	static FAssetCsvSyncJobQueue Queue;
+	return Queue;
+}
+
+void FAssetCsvSyncJobQueue::Enqueue(const TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe>& Job)
+{
+	check(IsInGameThread());
+	Pending.Add(Job);
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAssetCsvSyncJobQueue::Tick));
+	}
+	UpdateNotification();
+}
+
+void FAssetCsvSyncJobQueue::CancelAll()
+{
+	if (Current.IsValid())
+	{
+		Current->Cancel();
+	}
+	for (const TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe>& Job : Pending)
+	{
+		Job->Cancel();
+	}
+}
+
+void FAssetCsvSyncJobQueue::Flush()
+{
+	check(IsInGameThread());
+	while (Num() > 0)
+	{
+		UE::Tasks::Wait(Running);
+		// Stages may be waiting on async loads, which only advance when the game thread pumps them.
+		if (IsAsyncLoading())
+		{
+			ProcessAsyncLoading(true, false, 0.005f);
+		}
+		Tick(0.0f);
+	}
+}
+
+void FAssetCsvSyncJobQueue::Shutdown()
+{
+	CancelAll();
+	UE::Tasks::Wait(Running);
+	Running.Reset();
+
+	// Every job still hears that it was cancelled, so its OnFinished can release what it holds.
+	// Jobs its callback queues are dropped without running.
+	TArray<TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe>> Unstarted = MoveTemp(Pending);
+	Pending.Reset();
+	if (Current.IsValid())
+	{
+		Finish(EAssetCsvSyncJobResult::Cancelled);
+	}
+	for (const TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe>& Job : Unstarted)
+	{
+		Current = Job;
+		Finish(EAssetCsvSyncJobResult::Cancelled);
+	}
+	Pending.Reset();
+	if (Notification.IsValid())
+	{
+		Notification->ExpireAndFadeout();
+		Notification.Reset();
+	}
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+int32 FAssetCsvSyncJobQueue::Num() const
+{
+	return Pending.Num() + (Current.IsValid() ? 1 : 0);
+}
+
+bool FAssetCsvSyncJobQueue::Tick(float DeltaTime)
+{
+	if (!Current.IsValid())
+	{
+		if (Pending.IsEmpty())
+		{
+			TickerHandle.Reset();
+			return false;
+		}
+		Current = Pending[0];
+		Pending.RemoveAt(0);
+		StageIndex = 0;
+		UE_LOG(LogAssetCsvSync, Log, TEXT("JobQueue: starting '%s'"), *Current->GetName().ToString());
+	}
+
+	// A group of background stages is in flight: wait for all of them before moving on.
+	if (!Running.IsEmpty())
+	{
+		for (const UE::Tasks::TTask<bool>& Task : Running)
+		{
+			if (!Task.IsCompleted())
+			{
+				UpdateNotification();
+				return true;
+			}
+		}
+		bool bAllSucceeded = true;
+		for (UE::Tasks::TTask<bool>& Task : Running)
+		{
+			bAllSucceeded &= Task.GetResult();
+		}
+		Running.Reset();
+		if (!bAllSucceeded)
+		{
+			Finish(Current->IsCancelled() ? EAssetCsvSyncJobResult::Cancelled : EAssetCsvSyncJobResult::Failed);
+			return true;
+		}
+	}
+
+	if (Current->IsCancelled())
+	{
+		Finish(EAssetCsvSyncJobResult::Cancelled);
+		return true;
+	}
+	if (!Current->Stages.IsValidIndex(StageIndex))
+	{
+		Finish(EAssetCsvSyncJobResult::Succeeded);
+		return true;
+	}
+
+	if (Current->Stages[StageIndex].Work)
+	{
+		TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> Job = Current.ToSharedRef();
+		for (; Current->Stages.IsValidIndex(StageIndex) && Current->Stages[StageIndex].Work; ++StageIndex)
+		{
+			Running.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [Job, Work = Current->Stages[StageIndex].Work]()
+			{
+				return !Job->IsCancelled() && Work(*Job);
+			}));
+		}
+	}
+	else
+	{
+		// Step game-thread stages until the tick's budget is spent. At least one step always runs.
+		const double BudgetSeconds = UAssetCsvSyncEditorPluginSettings::Get()->JobFrameBudgetMs / 1000.0;
+		Current->SliceDeadline = FPlatformTime::Seconds() + BudgetSeconds;
+		do
+		{
+			const EAssetCsvSyncStepResult StepResult = Current->Stages[StageIndex].Step(*Current);
+			if (StepResult == EAssetCsvSyncStepResult::Failed)
+			{
+				Finish(Current->IsCancelled() ? EAssetCsvSyncJobResult::Cancelled : EAssetCsvSyncJobResult::Failed);
+				return true;
+			}
+			if (StepResult == EAssetCsvSyncStepResult::Yield)
+				break;
+			if (StepResult == EAssetCsvSyncStepResult::Done && !(Current->Stages.IsValidIndex(++StageIndex) && Current->Stages[StageIndex].Step))
+				break;
+		}
+		while (!Current->IsCancelled() && Current->GetSliceSecondsLeft() > 0.0);
+	}
+
+	UpdateNotification();
+	return true;
+}
+
+void FAssetCsvSyncJobQueue::Finish(EAssetCsvSyncJobResult Result)
+{
+	TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> Job = Current.ToSharedRef();
+	Current.Reset();
+
+	const TCHAR* ResultText = Result == EAssetCsvSyncJobResult::Succeeded ? TEXT("done") : Result == EAssetCsvSyncJobResult::Cancelled ? TEXT("cancelled") : TEXT("failed");
+	UE_LOG(LogAssetCsvSync, Log, TEXT("JobQueue: '%s' %s"), *Job->GetName().ToString(), ResultText);
+
+	if (Notification.IsValid())
+	{
+		Notification->SetText(FText::FromString(FString::Printf(TEXT("%s: %s"), *Job->GetName().ToString(), ResultText)));
+		Notification->SetSubText(Job->GetStatus());
+		Notification->SetCompletionState(Result == EAssetCsvSyncJobResult::Succeeded ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+		Notification->ExpireAndFadeout();
+		Notification.Reset();
+	}
+
+	if (Job->Finished)
+	{
+		Job->Finished(Result);
+	}
+}
+
+void FAssetCsvSyncJobQueue::UpdateNotification()
+{
+	if (!Current.IsValid() || !FSlateApplication::IsInitialized())
+		return;
+
+	if (!Notification.IsValid())
+	{
+		TWeakPtr<FAssetCsvSyncJob, ESPMode::ThreadSafe> WeakJob = Current;
+		FNotificationInfo Info(Current->GetName());
+		Info.bFireAndForget = false;
+		Info.ExpireDuration = 3.0f;
+		Info.ButtonDetails.Add(FNotificationButtonInfo(
+			FText::FromString(TEXT("Cancel")),
+			FText::FromString(TEXT("Stop after the current step. Work already applied is kept.")),
+			FSimpleDelegate::CreateLambda([WeakJob]()
+			{
+				if (TSharedPtr<FAssetCsvSyncJob, ESPMode::ThreadSafe> Job = WeakJob.Pin())
+				{
+					Job->Cancel();
+				}
+			}),
+			SNotificationItem::CS_Pending));
+		Notification = FSlateNotificationManager::Get().AddNotification(Info);
+		if (!Notification.IsValid())
+			return;
+		Notification->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+
+	FString Text = FString::Printf(TEXT("%s (%d%%)"), *Current->GetName().ToString(), FMath::RoundToInt(Current->GetProgress() * 100.0f));
+	if (!Pending.IsEmpty())
+	{
+		Text += FString::Printf(TEXT(", %d queued"), Pending.Num());
+	}
+	Notification->SetText(FText::FromString(Text));
+	Notification->SetSubText(Current->GetStatus());
+}
@@ -0,0 +1,497 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#include "AssetCsvSyncJsonLines.h"
+
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/Class.h"
+#include "UObject/PropertyPortFlags.h"
+
+// Pull parser over one line of JSON. Every call skips leading whitespace and stops right after what it read.
+struct FAssetCsvSyncJsonCursor
+{
+	explicit FAssetCsvSyncJsonCursor(FStringView Text)
+		: Pos(Text.GetData())
+		, End(Text.GetData() + Text.Len())
+	{
+	}
+
+	const TCHAR* Pos;
+	const TCHAR* End;
+
+	TCHAR Peek()
+	{
+		while (Pos < End && FChar::IsWhitespace(*Pos))
+		{
+			++Pos;
+		}
+		return Pos < End ? *Pos : TCHAR(0);
+	}
+
+	bool Consume(TCHAR Char)
+	{
+		if (Peek() != Char)
+			return false;
+		++Pos;
+		return true;
+	}
+
+	bool AtEnd()
+	{
+		return Peek() == 0;
+	}
+
+	bool ReadString(FString& Out)
+	{
+		if (!Consume(TEXT('"')))
+			return false;
+
+		Out.Reset();
+		const TCHAR* RunStart = Pos;
+		while (Pos < End)
+		{
+			const TCHAR Char = *Pos;
+			if (Char == TEXT('"'))
+			{
+				Out.AppendChars(RunStart, UE_PTRDIFF_TO_INT32(Pos - RunStart));
+				++Pos;
+				return true;
+			}
+			if (Char != TEXT('\\'))
+			{
+				++Pos;
+				continue;
+			}
+
+			Out.AppendChars(RunStart, UE_PTRDIFF_TO_INT32(Pos - RunStart));
+			if (++Pos >= End)
+				return false;
+			switch (*Pos++)
+			{
+			case TEXT('"'): Out.AppendChar(TEXT('"')); break;
+			case TEXT('\\'): Out.AppendChar(TEXT('\\')); break;
+			case TEXT('/'): Out.AppendChar(TEXT('/')); break;
+			case TEXT('b'): Out.AppendChar(TEXT('\b')); break;
+			case TEXT('f'): Out.AppendChar(TEXT('\f')); break;
+			case TEXT('n'): Out.AppendChar(TEXT('\n')); break;
+			case TEXT('r'): Out.AppendChar(TEXT('\r')); break;
+			case TEXT('t'): Out.AppendChar(TEXT('\t')); break;
+			case TEXT('u'):
+			{
+				if (End - Pos < 4)
+					return false;
+				uint32 Code = 0;
+				for (int32 Digit = 0; Digit < 4; ++Digit, ++Pos)
+				{
+					if (!FChar::IsHexDigit(*Pos))
+						return false;
+					Code = Code * 16 + FParse::HexDigit(*Pos);
+				}
+				// Surrogate pairs arrive as two escapes and are appended one code unit at a time.
+				Out.AppendChar(static_cast<TCHAR>(Code));
+				break;
+			}
+			default:
+				return false;
+			}
+			RunStart = Pos;
+		}
+		return false;
+	}
+
+	// Numbers, true, false and null.
+	FStringView ReadToken()
+	{
+		Peek();
+		const TCHAR* Start = Pos;
+		while (Pos < End && !FChar::IsWhitespace(*Pos) && *Pos != TEXT(',') && *Pos != TEXT(']') && *Pos != TEXT('}') && *Pos != TEXT(':'))
+		{
+			++Pos;
+		}
+		return FStringView(Start, UE_PTRDIFF_TO_INT32(Pos - Start));
+	}
+
+	bool SkipValue()
+	{
+		switch (Peek())
+		{
+		case TEXT('"'):
+			++Pos;
+			for (; Pos < End; ++Pos)
+			{
+				if (*Pos == TEXT('\\'))
+				{
+					++Pos;
+				}
+				else if (*Pos == TEXT('"'))
+				{
+					++Pos;
+					return true;
+				}
+			}
+			return false;
+		case TEXT('{'):
+			return ReadObject([this](const FString&) { return SkipValue(); });
+		case TEXT('['):
+			return ReadArray([this]() { return SkipValue(); });
+		case 0:
+			return false;
+		default:
+			return !ReadToken().IsEmpty();
+		}
+	}
+
+	template <typename FieldFunc>
+	bool ReadObject(FieldFunc&& OnField)
+	{
+		if (!Consume(TEXT('{')))
+			return false;
+		if (Consume(TEXT('}')))
+			return true;
+
+		FString Name;
+		do
+		{
+			if (!ReadString(Name) || !Consume(TEXT(':')) || !OnField(Name))
+				return false;
+		}
+		while (Consume(TEXT(',')));
+		return Consume(TEXT('}'));
+	}
+
+	template <typename ElementFunc>
+	bool ReadArray(ElementFunc&& OnElement)
+	{
+		if (!Consume(TEXT('[')))
+			return false;
+		if (Consume(TEXT(']')))
+			return true;
+
+		do
+		{
+			if (!OnElement())
+				return false;
+		}
+		while (Consume(TEXT(',')));
+		return Consume(TEXT(']'));
+	}
+};
+
+// Initialized value of a property, for map keys/values and set elements parsed before they are added.
+struct FAssetCsvSyncJsonTemp
+{
+	explicit FAssetCsvSyncJsonTemp(FProperty* InProperty)
+		: Property(InProperty)
+	{
+		Data = static_cast<uint8*>(FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment()));
+		Property->InitializeValue(Data);
+	}
+
+	~FAssetCsvSyncJsonTemp()
+	{
+		Property->DestroyValue(Data);
+		FMemory::Free(Data);
+	}
+
+	FProperty* Property;
+	uint8* Data;
+};
+
+// Structs with their own text format (soft object paths, gameplay tags, guids, ...) read better as that text than as their fields.
+static bool AssetCsvSync_IsNativeTextStruct(const UScriptStruct* Struct)
+{
+	return (Struct->StructFlags & STRUCT_ExportTextItemNative) && (Struct->StructFlags & STRUCT_ImportTextItemNative);
+}
+
+static FProperty* AssetCsvSync_FindJsonField(UScriptStruct* Struct, const FString& Name)
+{
+	const FName FieldName(*Name, FNAME_Find);
+	if (FieldName != NAME_None)
+	{
+		if (FProperty* Field = Struct->FindPropertyByName(FieldName))
+			return Field;
+	}
+	// Fields are written under their authored name, which differs from the property name in Blueprint structs.
+	for (TFieldIterator<FProperty> It(Struct); It; ++It)
+	{
+		if (It->GetAuthoredName() == Name)
+			return *It;
+	}
+	return nullptr;
+}
+
+static bool AssetCsvSync_ReadJson(FAssetCsvSyncJsonCursor& Cursor, FProperty* Property, uint8* Data, FAssetCsvSyncJsonLines::FStringToLeaf StringToLeaf)
+{
+	// null keeps the current value.
+	if (Cursor.Peek() == TEXT('n'))
+		return Cursor.ReadToken() == TEXTVIEW("null");
+
+	if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper Helper(ArrayProp, Data);
+		Helper.EmptyValues();
+		return Cursor.ReadArray([&]()
+		{
+			const int32 Index = Helper.AddValue();
+			return AssetCsvSync_ReadJson(Cursor, ArrayProp->Inner, Helper.GetRawPtr(Index), StringToLeaf);
+		});
+	}
+	if (FSetProperty* SetProp = CastField<FSetProperty>(Property))
+	{
+		FScriptSetHelper Helper(SetProp, Data);
+		Helper.EmptyElements();
+		FAssetCsvSyncJsonTemp Element(SetProp->ElementProp);
+		return Cursor.ReadArray([&]()
+		{
+			SetProp->ElementProp->ClearValue(Element.Data);
+			if (!AssetCsvSync_ReadJson(Cursor, SetProp->ElementProp, Element.Data, StringToLeaf))
+				return false;
+			Helper.AddElement(Element.Data);
+			return true;
+		});
+	}
+	if (FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	{
+		FScriptMapHelper Helper(MapProp, Data);
+		Helper.EmptyValues();
+		FAssetCsvSyncJsonTemp Key(MapProp->KeyProp);
+		FAssetCsvSyncJsonTemp Value(MapProp->ValueProp);
+		return Cursor.ReadObject([&](const FString& KeyText)
+		{
+			MapProp->KeyProp->ClearValue(Key.Data);
+			MapProp->ValueProp->ClearValue(Value.Data);
+			// Like a CSV map cell, a key that does not parse drops its entry.
+			if (!StringToLeaf(MapProp->KeyProp, Key.Data, KeyText))
+				return Cursor.SkipValue();
+			if (!AssetCsvSync_ReadJson(Cursor, MapProp->ValueProp, Value.Data, StringToLeaf))
+				return false;
+			Helper.AddPair(Key.Data, Value.Data);
+			return true;
+		});
+	}
+	if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+	{
+		if (Cursor.Peek() == TEXT('{'))
+		{
+			UScriptStruct* Struct = StructProp->Struct;
+			return Cursor.ReadObject([&](const FString& Name)
+			{
+				FProperty* Field = AssetCsvSync_FindJsonField(Struct, Name);
+				if (!Field)
+					return Cursor.SkipValue();
+				if (Field->ArrayDim == 1)
+					return AssetCsvSync_ReadJson(Cursor, Field, Field->ContainerPtrToValuePtr<uint8>(Data), StringToLeaf);
+
+				int32 Index = 0;
+				return Cursor.ReadArray([&]()
+				{
+					if (Index >= Field->ArrayDim)
+						return Cursor.SkipValue();
+					return AssetCsvSync_ReadJson(Cursor, Field, Field->ContainerPtrToValuePtr<uint8>(Data, Index++), StringToLeaf);
+				});
+			});
+		}
+	}
+
+	// Leaves: strings are decoded, numbers and booleans are handed over as written, so no precision is lost on the way.
+	const TCHAR Next = Cursor.Peek();
+	if (Next == TEXT('{') || Next == TEXT('['))
+	{
+		Cursor.SkipValue();
+		return false;
+	}
+
+	FString Text;
+	if (Next == TEXT('"'))
+	{
+		if (!Cursor.ReadString(Text))
+			return false;
+	}
+	else
+	{
+		const FStringView Token = Cursor.ReadToken();
+		if (Token.IsEmpty())
+			return false;
+		Text = FString(Token);
+	}
+	return StringToLeaf(Property, Data, Text);
+}
+
+bool FAssetCsvSyncJsonLines::IsJsonLinesFile(const FString& FilePath)
+{
+	return FPaths::GetExtension(FilePath).Equals(TEXT("jsonl"), ESearchCase::IgnoreCase);
+}
+
+void FAssetCsvSyncJsonLines::WriteString(FString& Out, FStringView Value)
+{
+	Out.AppendChar(TEXT('"'));
+	for (const TCHAR Char : Value)
+	{
+		switch (Char)
+		{
+		case TEXT('"'): Out += TEXT("\\\""); break;
+		case TEXT('\\'): Out += TEXT("\\\\"); break;
+		case TEXT('\n'): Out += TEXT("\\n"); break;
+		case TEXT('\r'): Out += TEXT("\\r"); break;
+		case TEXT('\t'): Out += TEXT("\\t"); break;
+		default:
+			if (Char < 0x20)
+			{
+				Out += FString::Printf(TEXT("\\u%04x"), static_cast<uint32>(Char));
+			}
+			else
+			{
+				Out.AppendChar(Char);
+			}
+		}
+	}
+	Out.AppendChar(TEXT('"'));
+}
+
+void FAssetCsvSyncJsonLines::WriteValue(FString& Out, FProperty* Property, const uint8* PropertyData, FLeafToString LeafToString)
+{
+	if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper Helper(ArrayProp, PropertyData);
+		Out.AppendChar(TEXT('['));
+		for (int32 Index = 0; Index < Helper.Num(); ++Index)
+		{
+			if (Index > 0)
+			{
+				Out.AppendChar(TEXT(','));
+			}
+			WriteValue(Out, ArrayProp->Inner, Helper.GetRawPtr(Index), LeafToString);
+		}
+		Out.AppendChar(TEXT(']'));
+		return;
+	}
+	if (FSetProperty* SetProp = CastField<FSetProperty>(Property))
+	{
+		FScriptSetHelper Helper(SetProp, PropertyData);
+		Out.AppendChar(TEXT('['));
+		bool bFirst = true;
+		for (FScriptSetHelper::FIterator It = Helper.CreateIterator(); It; ++It)
+		{
+			if (!bFirst)
+			{
+				Out.AppendChar(TEXT(','));
+			}
+			bFirst = false;
+			WriteValue(Out, SetProp->ElementProp, Helper.GetElementPtr(It), LeafToString);
+		}
+		Out.AppendChar(TEXT(']'));
+		return;
+	}
+	if (FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	{
+		// Keys use the same text as the columns of an expanded map.
+		FScriptMapHelper Helper(MapProp, PropertyData);
+		Out.AppendChar(TEXT('{'));
+		bool bFirst = true;
+		for (FScriptMapHelper::FIterator It = Helper.CreateIterator(); It; ++It)
+		{
+			if (!bFirst)
+			{
+				Out.AppendChar(TEXT(','));
+			}
+			bFirst = false;
+			WriteString(Out, LeafToString(MapProp->KeyProp, Helper.GetKeyPtr(It)));
+			Out.AppendChar(TEXT(':'));
+			WriteValue(Out, MapProp->ValueProp, Helper.GetValuePtr(It), LeafToString);
+		}
+		Out.AppendChar(TEXT('}'));
+		return;
+	}
+	if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+	{
+		if (!AssetCsvSync_IsNativeTextStruct(StructProp->Struct))
+		{
+			Out.AppendChar(TEXT('{'));
+			bool bFirst = true;
+			for (TFieldIterator<FProperty> It(StructProp->Struct); It; ++It)
+			{
+				FProperty* Field = *It;
+				if (!Field->ShouldPort(PPF_ExternalEditor))
+					continue;
+				if (!bFirst)
+				{
+					Out.AppendChar(TEXT(','));
+				}
+				bFirst = false;
+				WriteString(Out, Field->GetAuthoredName());
+				Out.AppendChar(TEXT(':'));
+				if (Field->ArrayDim == 1)
+				{
+					WriteValue(Out, Field, Field->ContainerPtrToValuePtr<uint8>(PropertyData), LeafToString);
+					continue;
+				}
+				Out.AppendChar(TEXT('['));
+				for (int32 Index = 0; Index < Field->ArrayDim; ++Index)
+				{
+					if (Index > 0)
+					{
+						Out.AppendChar(TEXT(','));
+					}
+					WriteValue(Out, Field, Field->ContainerPtrToValuePtr<uint8>(PropertyData, Index), LeafToString);
+				}
+				Out.AppendChar(TEXT(']'));
+			}
+			Out.AppendChar(TEXT('}'));
+			return;
+		}
+	}
+	if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+	{
+		Out += BoolProp->GetPropertyValue(PropertyData) ? TEXT("true") : TEXT("false");
+		return;
+	}
+	if (FNumericProperty* NumericProp = CastField<FNumericProperty>(Property))
+	{
+		// Enum bytes are written by name; NaN and infinities have no JSON number form and stay text.
+		if (!NumericProp->IsEnum() && (NumericProp->IsInteger() || FMath::IsFinite(NumericProp->GetFloatingPointPropertyValue(PropertyData))))
+		{
+			Out += LeafToString(Property, PropertyData);
+			return;
+		}
+	}
+
+	WriteString(Out, LeafToString(Property, PropertyData));
+}
+
+bool FAssetCsvSyncJsonLines::ReadValue(FStringView Json, FProperty* Property, uint8* PropertyData, FStringToLeaf StringToLeaf)
+{
+	FAssetCsvSyncJsonCursor Cursor(Json);
+	return AssetCsvSync_ReadJson(Cursor, Property, PropertyData, StringToLeaf) && Cursor.AtEnd();
+}
+
+bool FAssetCsvSyncJsonLines::SplitRecord(FStringView Line, TArray<FString>& OutNames, TArray<FString>& OutValues)
+{
+	OutNames.Reset();
+	OutValues.Reset();
+
+	FAssetCsvSyncJsonCursor Cursor(Line);
+	const bool bRead = Cursor.ReadObject([&Cursor, &OutNames, &OutValues](const FString& Name)
+	{
+		Cursor.Peek();
+		const TCHAR* Start = Cursor.Pos;
+		if (!Cursor.SkipValue())
+			return false;
+		const FStringView Value(Start, UE_PTRDIFF_TO_INT32(Cursor.Pos - Start));
+		if (Value != TEXTVIEW("null"))
+		{
+			OutNames.Add(Name);
+			OutValues.Emplace(Value);
+		}
+		return true;
+	});
+	return bRead && Cursor.AtEnd();
+}
+
+FString FAssetCsvSyncJsonLines::ValueToText(FStringView Json)
+{
+	FAssetCsvSyncJsonCursor Cursor(Json);
+	FString Text;
+	if (Cursor.Peek() == TEXT('"') && Cursor.ReadString(Text))
+		return Text;
+	return FString(Json).TrimStartAndEnd();
+}
@@ -0,0 +1,31 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UnrealType.h"
+
+// JSON Lines tables: one JSON object per line, one field per column of the CSV binding plan.
+// Structs, arrays, sets and maps are written as native JSON values, so nested data is encoded once instead of
+// as text inside a CSV cell. Values are written straight into the line and read back with a pull parser that
+// fills the property in place; only leaves (numbers, names, object paths, ...) go through the CSV cell text.
+struct FAssetCsvSyncJsonLines
+{
+	using FLeafToString = TFunctionRef<FString(FProperty*, const uint8*)>;
+	using FStringToLeaf = TFunctionRef<bool(FProperty*, uint8*, const FString&)>;
+
+	static bool IsJsonLinesFile(const FString& FilePath);
+
+	// Appends the value as JSON. LeafToString formats the leaves that have no native JSON form.
+	static void WriteValue(FString& Out, FProperty* Property, const uint8* PropertyData, FLeafToString LeafToString);
+	static void WriteString(FString& Out, FStringView Value);
+
+	// Reads one JSON value into the property. Struct fields that are not named keep their value; containers are replaced.
+	static bool ReadValue(FStringView Json, FProperty* Property, uint8* PropertyData, FStringToLeaf StringToLeaf);
+
+	// Splits a line into its top-level fields. Values are kept as JSON text and decoded only when applied; null fields are dropped.
+	static bool SplitRecord(FStringView Line, TArray<FString>& OutNames, TArray<FString>& OutValues);
+
+	// The text of a JSON string value; any other value is returned as written.
+	static FString ValueToText(FStringView Json);
+};
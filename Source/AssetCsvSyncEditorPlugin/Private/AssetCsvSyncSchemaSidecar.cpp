@@ -0,0 +1,389 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#include "AssetCsvSyncSchemaSidecar.h"
+
+#include "AssetCsvSyncLog.h"
+#include "AssetCsvSyncSourceStamp.h"
+
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+static const int32 AssetCsvSync_SidecarVersion = 1;
+
+static const TCHAR* AssetCsvSync_ConverterNames[] = {
+	TEXT("none"), TEXT("int32"), TEXT("int64"), TEXT("float"), TEXT("double"), TEXT("bool"), TEXT("name"), TEXT("string"), TEXT("enum")
+};
+
+const TCHAR* FAssetCsvSyncTypedColumn::GetConverterName(EAssetCsvSyncConverter Converter)
+{
+	return AssetCsvSync_ConverterNames[static_cast<uint8>(Converter)];
+}
+
+static EAssetCsvSyncConverter AssetCsvSync_FindConverter(const FString& Name)
+{
+	for (uint8 Index = 0; Index < UE_ARRAY_COUNT(AssetCsvSync_ConverterNames); ++Index)
+	{
+		if (Name == AssetCsvSync_ConverterNames[Index])
+			return static_cast<EAssetCsvSyncConverter>(Index);
+	}
+	return EAssetCsvSyncConverter::None;
+}
+
+FString FAssetCsvSyncSchemaSidecar::GetPath(const FString& TablePath)
+{
+	return TablePath + TEXT(".schema.json");
+}
+
+EAssetCsvSyncConverter FAssetCsvSyncSchemaSidecar::GetConverter(const FProperty* Property)
+{
+	if (Property->IsA<FIntProperty>())
+		return EAssetCsvSyncConverter::Int32;
+	if (Property->IsA<FInt64Property>())
+		return EAssetCsvSyncConverter::Int64;
+	if (Property->IsA<FFloatProperty>())
+		return EAssetCsvSyncConverter::Float;
+	if (Property->IsA<FDoubleProperty>())
+		return EAssetCsvSyncConverter::Double;
+	if (Property->IsA<FBoolProperty>())
+		return EAssetCsvSyncConverter::Bool;
+	if (Property->IsA<FNameProperty>())
+		return EAssetCsvSyncConverter::Name;
+	if (Property->IsA<FStrProperty>())
+		return EAssetCsvSyncConverter::String;
+	if (const FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+		return ByteProp->Enum ? EAssetCsvSyncConverter::Enum : EAssetCsvSyncConverter::None;
+	return EAssetCsvSyncConverter::None;
+}
+
+void FAssetCsvSyncSchemaSidecar::AddClass(UClass* Class)
+{
+	const FString ClassPath = Class->GetPathName();
+	if (!ClassSchemas.Contains(ClassPath))
+	{
+		ClassSchemas.Add(ClassPath, FAssetCsvSyncSourceStamp::GetSchema(Class));
+	}
+}
+
+void FAssetCsvSyncSchemaSidecar::AddColumn(const FString& ColumnName, const FProperty* Property)
+{
+	FColumn* Existing = Columns.Find(ColumnName);
+	if (Existing && Existing->Property == Property)
+		return;
+
+	const EAssetCsvSyncConverter Converter = GetConverter(Property);
+	const FByteProperty* ByteProp = CastField<FByteProperty>(Property);
+	const FString EnumPath = Converter == EAssetCsvSyncConverter::Enum ? ByteProp->Enum->GetPathName() : FString();
+	if (!Existing)
+	{
+		FColumn& Column = Columns.Add(ColumnName);
+		Column.Converter = Converter;
+		Column.EnumPath = EnumPath;
+		Column.Property = Property;
+		return;
+	}
+	if (Existing->Converter != Converter || Existing->EnumPath != EnumPath)
+	{
+		Existing->Converter = EAssetCsvSyncConverter::None;
+		Existing->EnumPath.Reset();
+	}
+	Existing->Property = Property;
+}
+
+bool FAssetCsvSyncSchemaSidecar::Save(const FString& TablePath) const
+{
+	FString Text;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Text);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("version"), AssetCsvSync_SidecarVersion);
+	Writer->WriteObjectStart(TEXT("classes"));
+	for (const TPair<FString, FString>& Pair : ClassSchemas)
+	{
+		Writer->WriteValue(Pair.Key, Pair.Value);
+	}
+	Writer->WriteObjectEnd();
+	// Enum columns name their enum after the converter: "enum:/Script/Module.EEnum".
+	Writer->WriteObjectStart(TEXT("columns"));
+	for (const TPair<FString, FColumn>& Pair : Columns)
+	{
+		if (Pair.Value.Converter == EAssetCsvSyncConverter::None)
+			continue;
+		const FString Converter = FAssetCsvSyncTypedColumn::GetConverterName(Pair.Value.Converter);
+		Writer->WriteValue(Pair.Key, Pair.Value.EnumPath.IsEmpty() ? Converter : Converter + TEXT(":") + Pair.Value.EnumPath);
+	}
+	Writer->WriteObjectEnd();
+	Writer->WriteObjectEnd();
+	Writer->Close();
+	return FFileHelper::SaveStringToFile(Text, *GetPath(TablePath));
+}
+
+bool FAssetCsvSyncSchemaSidecar::Load(const FString& TablePath)
+{
+	const FString Path = GetPath(TablePath);
+	FString Text;
+	if (!FPaths::FileExists(Path) || !FFileHelper::LoadFileToString(Text, *Path))
+		return false;
+
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Text);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || Root->GetIntegerField(TEXT("version")) != AssetCsvSync_SidecarVersion)
+	{
+		UE_LOG(LogAssetCsvSync, Warning, TEXT("LoadSchemaSidecar: %s is not a schema sidecar; ignored"), *Path);
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* Classes = nullptr;
+	if (Root->TryGetObjectField(TEXT("classes"), Classes))
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Classes)->Values)
+		{
+			ClassSchemas.Add(Pair.Key, Pair.Value->AsString());
+		}
+	}
+	const TSharedPtr<FJsonObject>* ColumnObject = nullptr;
+	if (Root->TryGetObjectField(TEXT("columns"), ColumnObject))
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*ColumnObject)->Values)
+		{
+			FString Name = Pair.Value->AsString();
+			FString EnumPath;
+			Name.Split(TEXT(":"), &Name, &EnumPath);
+			const EAssetCsvSyncConverter Converter = AssetCsvSync_FindConverter(Name);
+			if (Converter == EAssetCsvSyncConverter::None)
+				continue;
+			FColumn& Column = Columns.Add(Pair.Key);
+			Column.Converter = Converter;
+			Column.EnumPath = MoveTemp(EnumPath);
+		}
+	}
+	return true;
+}
+
+void FAssetCsvSyncSchemaSidecar::ResolveEnums()
+{
+	for (auto It = Columns.CreateIterator(); It; ++It)
+	{
+		if (It->Value.Converter != EAssetCsvSyncConverter::Enum)
+			continue;
+		It->Value.Enum = LoadObject<UEnum>(nullptr, *It->Value.EnumPath);
+		if (!It->Value.Enum)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+// Kernels: strict forms of what the exporter writes. Atoi/Atof accept any prefix and turn the rest into 0.
+
+static bool AssetCsvSync_ParseInteger(const FString& Cell, int64 Min, int64 Max, int64& OutValue)
+{
+	const TCHAR* It = *Cell;
+	const bool bNegative = *It == TEXT('-');
+	if (*It == TEXT('-') || *It == TEXT('+'))
+	{
+		++It;
+	}
+	if (!FChar::IsDigit(*It))
+		return false;
+
+	uint64 Magnitude = 0;
+	for (; FChar::IsDigit(*It); ++It)
+	{
+		const uint64 Digit = *It - TEXT('0');
+		if (Magnitude > (MAX_uint64 - Digit) / 10)
+			return false;
+		Magnitude = Magnitude * 10 + Digit;
+	}
+	if (*It != TEXT('\0'))
+		return false;
+
+	if (bNegative)
+	{
+		if (Magnitude > uint64(MAX_int64) + 1)
+			return false;
+		OutValue = Magnitude == uint64(MAX_int64) + 1 ? MIN_int64 : -static_cast<int64>(Magnitude);
+	}
+	else
+	{
+		if (Magnitude > uint64(MAX_int64))
+			return false;
+		OutValue = static_cast<int64>(Magnitude);
+	}
+	return OutValue >= Min && OutValue <= Max;
+}
+
+static bool AssetCsvSync_ParseReal(const FString& Cell, double& OutValue)
+{
+	const TCHAR* It = *Cell;
+	if (*It == TEXT('-') || *It == TEXT('+'))
+	{
+		++It;
+	}
+	if (FCString::Stricmp(It, TEXT("inf")) == 0 || FCString::Stricmp(It, TEXT("nan")) == 0)
+	{
+		OutValue = FCString::Atod(*Cell);
+		return true;
+	}
+
+	int32 Digits = 0;
+	for (; FChar::IsDigit(*It); ++It, ++Digits) {}
+	if (*It == TEXT('.'))
+	{
+		for (++It; FChar::IsDigit(*It); ++It, ++Digits) {}
+	}
+	if (Digits == 0)
+		return false;
+	if (*It == TEXT('e') || *It == TEXT('E'))
+	{
+		++It;
+		if (*It == TEXT('-') || *It == TEXT('+'))
+		{
+			++It;
+		}
+		if (!FChar::IsDigit(*It))
+			return false;
+		for (; FChar::IsDigit(*It); ++It) {}
+	}
+	if (*It != TEXT('\0'))
+		return false;
+	OutValue = FCString::Atod(*Cell);
+	return true;
+}
+
+// The words FString::ToBool understands, plus integers (non-zero is true).
+static bool AssetCsvSync_ParseBool(const FString& Cell, int64& OutValue)
+{
+	static const TCHAR* TrueWords[] = { TEXT("true"), TEXT("yes"), TEXT("on") };
+	static const TCHAR* FalseWords[] = { TEXT("false"), TEXT("no"), TEXT("off") };
+	for (const TCHAR* Word : TrueWords)
+	{
+		if (Cell.Equals(Word, ESearchCase::IgnoreCase))
+		{
+			OutValue = 1;
+			return true;
+		}
+	}
+	for (const TCHAR* Word : FalseWords)
+	{
+		if (Cell.Equals(Word, ESearchCase::IgnoreCase))
+		{
+			OutValue = 0;
+			return true;
+		}
+	}
+	int64 Number = 0;
+	if (!AssetCsvSync_ParseInteger(Cell, MIN_int64, MAX_int64, Number))
+		return false;
+	OutValue = Number != 0 ? 1 : 0;
+	return true;
+}
+
+void FAssetCsvSyncTypedColumn::ParseColumn(const FAssetCsvSyncSchemaSidecar::FColumn& Column, int32 NumRows, TFunctionRef<const FString*(int32)> GetCell, TArray<int32>& OutInvalidRows)
+{
+	Converter = Column.Converter;
+	if (Converter == EAssetCsvSyncConverter::String || Converter == EAssetCsvSyncConverter::None)
+		return;
+
+	Parsed.SetNumZeroed(NumRows);
+	const bool bReal = Converter == EAssetCsvSyncConverter::Float || Converter == EAssetCsvSyncConverter::Double;
+	if (Converter == EAssetCsvSyncConverter::Name)
+	{
+		Names.SetNum(NumRows);
+	}
+	else if (bReal)
+	{
+		Doubles.SetNumZeroed(NumRows);
+	}
+	else
+	{
+		Ints.SetNumZeroed(NumRows);
+	}
+
+	// One branch per column instead of per cell: each converter gets its own loop.
+	auto Run = [this, NumRows, &GetCell, &OutInvalidRows](auto&& Kernel)
+	{
+		for (int32 Row = 0; Row < NumRows; ++Row)
+		{
+			const FString* Cell = GetCell(Row);
+			if (!Cell || Cell->IsEmpty())
+				continue;
+			if (Kernel(*Cell, Row))
+			{
+				Parsed[Row] = 1;
+			}
+			else
+			{
+				OutInvalidRows.Add(Row);
+			}
+		}
+	};
+
+	switch (Converter)
+	{
+	case EAssetCsvSyncConverter::Int32:
+		Run([this](const FString& Cell, int32 Row) { return AssetCsvSync_ParseInteger(Cell, MIN_int32, MAX_int32, Ints[Row]); });
+		break;
+	case EAssetCsvSyncConverter::Int64:
+		Run([this](const FString& Cell, int32 Row) { return AssetCsvSync_ParseInteger(Cell, MIN_int64, MAX_int64, Ints[Row]); });
+		break;
+	case EAssetCsvSyncConverter::Float:
+	case EAssetCsvSyncConverter::Double:
+		Run([this](const FString& Cell, int32 Row) { return AssetCsvSync_ParseReal(Cell, Doubles[Row]); });
+		break;
+	case EAssetCsvSyncConverter::Bool:
+		Run([this](const FString& Cell, int32 Row) { return AssetCsvSync_ParseBool(Cell, Ints[Row]); });
+		break;
+	case EAssetCsvSyncConverter::Name:
+		Run([this](const FString& Cell, int32 Row) { Names[Row] = FName(*Cell); return true; });
+		break;
+	case EAssetCsvSyncConverter::Enum:
+	{
+		// By value name like StringToProperty, or the numeric form of older exports.
+		const UEnum* Enum = Column.Enum;
+		Run([this, Enum](const FString& Cell, int32 Row)
+		{
+			Ints[Row] = Enum ? Enum->GetValueByNameString(Cell) : INDEX_NONE;
+			return Ints[Row] != INDEX_NONE || AssetCsvSync_ParseInteger(Cell, 0, MAX_uint8, Ints[Row]);
+		});
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+bool FAssetCsvSyncTypedColumn::Apply(int32 Row, const FProperty* Property, uint8* PropertyData) const
+{
+	if (!Parsed.IsValidIndex(Row) || !Parsed[Row] || FAssetCsvSyncSchemaSidecar::GetConverter(Property) != Converter)
+		return false;
+
+	switch (Converter)
+	{
+	case EAssetCsvSyncConverter::Int32:
+		CastField<FIntProperty>(Property)->SetPropertyValue(PropertyData, static_cast<int32>(Ints[Row]));
+		return true;
+	case EAssetCsvSyncConverter::Int64:
+		CastField<FInt64Property>(Property)->SetPropertyValue(PropertyData, Ints[Row]);
+		return true;
+	case EAssetCsvSyncConverter::Float:
+		CastField<FFloatProperty>(Property)->SetPropertyValue(PropertyData, static_cast<float>(Doubles[Row]));
+		return true;
+	case EAssetCsvSyncConverter::Double:
+		CastField<FDoubleProperty>(Property)->SetPropertyValue(PropertyData, Doubles[Row]);
+		return true;
+	case EAssetCsvSyncConverter::Bool:
+		CastField<FBoolProperty>(Property)->SetPropertyValue(PropertyData, Ints[Row] != 0);
+		return true;
+	case EAssetCsvSyncConverter::Name:
+		CastField<FNameProperty>(Property)->SetPropertyValue(PropertyData, Names[Row]);
+		return true;
+	case EAssetCsvSyncConverter::Enum:
+		CastField<FByteProperty>(Property)->SetPropertyValue(PropertyData, static_cast<uint8>(Ints[Row]));
+		return true;
+	default:
+		return false;
+	}
+}
@@ -0,0 +1,77 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UnrealType.h"
+
+// How a leaf column's cell text is converted; mirrors the typed branches of StringToProperty.
+enum class EAssetCsvSyncConverter : uint8
+{
+	None,
+	Int32,
+	Int64,
+	Float,
+	Double,
+	Bool,
+	Name,
+	String,
+	// Byte properties backed by a UEnum, exported by value name.
+	Enum,
+};
+
+// Typed schema sidecar (<table>.schema.json) written next to a table CSV on export: the converter of every typed
+// leaf column and the schema fingerprint (FAssetCsvSyncSourceStamp::GetSchema) of every exported class.
+// An import that finds the sidecar rejects a table exported from an unrelated class before reading it, and while
+// the fingerprints still match it validates and parses the listed columns with one kernel per converter before any
+// asset is touched, so a mistyped cell rejects its row instead of being applied as 0.
+struct FAssetCsvSyncSchemaSidecar
+{
+	struct FColumn
+	{
+		EAssetCsvSyncConverter Converter = EAssetCsvSyncConverter::None;
+		FString EnumPath;
+		// Export: the property the converter was taken from. Import: resolved from EnumPath on the game thread.
+		const FProperty* Property = nullptr;
+		const UEnum* Enum = nullptr;
+	};
+
+	// Class path -> schema fingerprint.
+	TMap<FString, FString> ClassSchemas;
+	TMap<FString, FColumn> Columns;
+
+	static FString GetPath(const FString& TablePath);
+	static EAssetCsvSyncConverter GetConverter(const FProperty* Property);
+
+	// Game thread: the fingerprint is taken from reflection.
+	void AddClass(UClass* Class);
+	// A column whose properties disagree on the converter is dropped; its cells are parsed through reflection.
+	void AddColumn(const FString& Column, const FProperty* Property);
+
+	bool Save(const FString& TablePath) const;
+	// False when there is no sidecar or it cannot be read.
+	bool Load(const FString& TablePath);
+	// Game thread: finds the enums of Enum columns; columns whose enum is gone are dropped.
+	void ResolveEnums();
+};
+
+// One sidecar column parsed for every row of a table, indexed by the row's position when it was parsed.
+struct FAssetCsvSyncTypedColumn
+{
+	EAssetCsvSyncConverter Converter = EAssetCsvSyncConverter::None;
+	// 1 where the row had a non-empty cell that parsed.
+	TArray<uint8> Parsed;
+	// Int32, Int64, Bool and Enum values.
+	TArray<int64> Ints;
+	TArray<double> Doubles;
+	TArray<FName> Names;
+
+	// Runs the converter's kernel over the column. Empty cells are left to reflection; rows whose cell does not
+	// convert are added to OutInvalidRows.
+	void ParseColumn(const FAssetCsvSyncSchemaSidecar::FColumn& Column, int32 NumRows, TFunctionRef<const FString*(int32)> GetCell, TArray<int32>& OutInvalidRows);
+
+	// Sets the property from the parsed cell. False when the row has no parsed cell or the property's converter differs.
+	bool Apply(int32 Row, const FProperty* Property, uint8* PropertyData) const;
+
+	static const TCHAR* GetConverterName(EAssetCsvSyncConverter Converter);
+};
@@ -0,0 +1,248 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#include "AssetCsvSyncSourceStamp.h"
+
+#include "AssetCsvSyncCSVHandler.h"
+#include "AssetCsvSyncCoreAdapter.h"
+#include "AssetCsvSyncEditorPluginSettings.h"
+#include "ExportableMetaData.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "Editor.h"
+#include "Engine/DataAsset.h"
+#include "Hash/CityHash.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/MetaData.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+const FName FAssetCsvSyncSourceStamp::RowHashTag(TEXT("AssetCsvSyncRowHash"));
+const FName FAssetCsvSyncSourceStamp::SchemaTag(TEXT("AssetCsvSyncSchema"));
+
+// Bump when the meaning of a stamp changes, so every asset is re-imported once.
+// 2: the schema covers the binding plan (column types and expansion shapes), not only the column names.
+// 3: row hashes cover the imported cells by column instead of the raw records.
+static const TCHAR* AssetCsvSync_StampVersion = TEXT("3");
+
+static FDelegateHandle AssetCsvSync_RegistryTagsHandle;
+static FDelegateHandle AssetCsvSync_PropertyChangedHandle;
+
+// Schemas by class, dropped whenever a class can have changed shape: modules loading or unloading, hot reload and
+// Blueprint compiles (which also follow edits to user-defined structs).
+struct FAssetCsvSyncSchemaCache
+{
+	TMap<FObjectKey, FString> Schemas;
+	EAssetCsvSyncWriteBackScope Scope = EAssetCsvSyncWriteBackScope::RootOnly;
+
+	FDelegateHandle ModulesChangedHandle;
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle PostEngineInitHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+};
+
+static FAssetCsvSyncSchemaCache AssetCsvSync_SchemaCache;
+
+static void AssetCsvSync_InvalidateSchemas()
+{
+	AssetCsvSync_SchemaCache.Schemas.Reset();
+}
+
+static void AssetCsvSync_BindSchemaEditorEvents()
+{
+	if (GEditor && !AssetCsvSync_SchemaCache.BlueprintCompiledHandle.IsValid())
+	{
+		AssetCsvSync_SchemaCache.BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&AssetCsvSync_InvalidateSchemas);
+	}
+}
+
+static uint64 AssetCsvSync_HashString(const FString& Value, uint64 Seed)
+{
+	return CityHash64WithSeed(reinterpret_cast<const char*>(*Value), Value.Len() * sizeof(TCHAR), Seed);
+}
+
+// The stamped root asset for an edited object: the object itself or the DataAsset it is a subobject of.
+static UDataAsset* AssetCsvSync_FindStampedAsset(UObject* Object)
+{
+	UDataAsset* DataAsset = Cast<UDataAsset>(Object);
+	if (!DataAsset && Object)
+	{
+		DataAsset = Object->GetTypedOuter<UDataAsset>();
+	}
+	if (!DataAsset || !DataAsset->IsAsset() || !FExportableMetaData::IsExportable(DataAsset->GetClass()))
+		return nullptr;
+	return DataAsset;
+}
+
+static void AssetCsvSync_AddStampTags(const UObject* Object, TFunctionRef<void(FName, const FString&)> AddTag)
+{
+	UDataAsset* DataAsset = AssetCsvSync_FindStampedAsset(const_cast<UObject*>(Object));
+	if (DataAsset != Object)
+		return;
+	UMetaData* MetaData = DataAsset->GetPackage()->GetMetaData();
+	if (!MetaData || !MetaData->HasValue(DataAsset, FAssetCsvSyncSourceStamp::RowHashTag))
+		return;
+	AddTag(FAssetCsvSyncSourceStamp::RowHashTag, MetaData->GetValue(DataAsset, FAssetCsvSyncSourceStamp::RowHashTag));
+	AddTag(FAssetCsvSyncSourceStamp::SchemaTag, MetaData->GetValue(DataAsset, FAssetCsvSyncSourceStamp::SchemaTag));
+}
+
+FString FAssetCsvSyncSourceStamp::HashRow(const TMap<FString, FString>& ColumnToValue)
+{
+	TArray<FString> Columns;
+	ColumnToValue.GenerateKeyArray(Columns);
+	Columns.Sort();
+
+	uint64 Hash = 0;
+	for (const FString& Column : Columns)
+	{
+		Hash = AssetCsvSync_HashString(ColumnToValue[Column], AssetCsvSync_HashString(Column, Hash));
+	}
+	return FString::Printf(TEXT("%016llx"), Hash);
+}
+
+FString FAssetCsvSyncSourceStamp::HashRow(const FString& HeaderRecord, const FString& ValueRecord)
+{
+	TArray<FAssetCsvSyncCoreView> Headers;
+	TArray<FAssetCsvSyncCoreView> Values;
+	AssetCsvSync::Core::ParseCsvLine(AssetCsvSync_CoreView(HeaderRecord), [&Headers](FAssetCsvSyncCoreView Cell) { Headers.Add(Cell); });
+	AssetCsvSync::Core::ParseCsvLine(AssetCsvSync_CoreView(ValueRecord), [&Values](FAssetCsvSyncCoreView Cell) { Values.Add(Cell); });
+	if (Headers.Num() != Values.Num())
+		return FString();
+
+	// Later duplicates win, as in an import.
+	TMap<FString, FString> ColumnToValue;
+	ColumnToValue.Reserve(Headers.Num());
+	for (int32 Index = 0; Index < Headers.Num(); ++Index)
+	{
+		ColumnToValue.Add(AssetCsvSync_FromCoreView(Headers[Index]), AssetCsvSync_FromCoreView(Values[Index]));
+	}
+	return HashRow(ColumnToValue);
+}
+
+FString FAssetCsvSyncSourceStamp::GetSchema(UClass* Class)
+{
+	if (!Class)
+		return FString();
+	check(IsInGameThread());
+
+	FAssetCsvSyncSchemaCache& Cache = AssetCsvSync_SchemaCache;
+	const EAssetCsvSyncWriteBackScope Scope = UAssetCsvSyncEditorPluginSettings::Get()->WriteBackScope;
+	if (Cache.Scope != Scope)
+	{
+		Cache.Schemas.Reset();
+		Cache.Scope = Scope;
+	}
+	if (const FString* Schema = Cache.Schemas.Find(FObjectKey(Class)))
+		return *Schema;
+
+	const FString Text = FString::Printf(TEXT("%s|%s|%d|%s"),
+		AssetCsvSync_StampVersion, *Class->GetPathName(), static_cast<int32>(Scope), *FString::Join(UAssetCsvSyncCSVHandler::GetBindingPlan(Class), TEXT(",")));
+	return Cache.Schemas.Add(FObjectKey(Class), FString::Printf(TEXT("%016llx"), AssetCsvSync_HashString(Text, 0)));
+}
+
+bool FAssetCsvSyncSourceStamp::IsUpToDate(const FAssetData& AssetData, const FString& RowHash, const FString& Schema)
+{
+	if (!AssetData.IsValid() || RowHash.IsEmpty() || Schema.IsEmpty())
+		return false;
+
+	// The registry describes the package on disk; unsaved edits in memory make it stale.
+	const UPackage* LoadedPackage = FindPackage(nullptr, *AssetData.PackageName.ToString());
+	if (LoadedPackage && LoadedPackage->IsDirty())
+		return false;
+
+	FString Stored;
+	if (!AssetData.GetTagValue(RowHashTag, Stored) || Stored != RowHash)
+		return false;
+	return AssetData.GetTagValue(SchemaTag, Stored) && Stored == Schema;
+}
+
+void FAssetCsvSyncSourceStamp::Stamp(UDataAsset* DataAsset, const FString& RowHash, const FString& Schema)
+{
+	if (!DataAsset || !DataAsset->IsAsset() || RowHash.IsEmpty())
+		return;
+
+	if (UMetaData* MetaData = DataAsset->GetPackage()->GetMetaData())
+	{
+		MetaData->SetValue(DataAsset, RowHashTag, *RowHash);
+		MetaData->SetValue(DataAsset, SchemaTag, *Schema);
+	}
+}
+
+void FAssetCsvSyncSourceStamp::Clear(UObject* Object)
+{
+	UDataAsset* DataAsset = AssetCsvSync_FindStampedAsset(Object);
+	if (!DataAsset)
+		return;
+	UMetaData* MetaData = DataAsset->GetPackage()->GetMetaData();
+	if (!MetaData || !MetaData->HasValue(DataAsset, RowHashTag))
+		return;
+	MetaData->RemoveValue(DataAsset, RowHashTag);
+	MetaData->RemoveValue(DataAsset, SchemaTag);
+}
+
+void FAssetCsvSyncSourceStamp::Register()
+{
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+	AssetCsvSync_RegistryTagsHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTags.AddLambda([](const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags)
+	{
+		AssetCsvSync_AddStampTags(Object, [&OutTags](FName Name, const FString& Value)
+		{
+			OutTags.Add(UObject::FAssetRegistryTag(Name, Value, UObject::FAssetRegistryTag::TT_Hidden));
+		});
+	});
+#else
+	AssetCsvSync_RegistryTagsHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTagsWithContext.AddLambda([](FAssetRegistryTagsContext Context)
+	{
+		AssetCsvSync_AddStampTags(Context.GetObject(), [&Context](FName Name, const FString& Value)
+		{
+			Context.AddTag(UObject::FAssetRegistryTag(Name, Value, UObject::FAssetRegistryTag::TT_Hidden));
+		});
+	});
+#endif
+
+	// Imports stamp after their own PostEditChange, so this only ever clears stamps for edits made elsewhere.
+	AssetCsvSync_PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda([](UObject* Object, FPropertyChangedEvent&)
+	{
+		Clear(Object);
+	});
+
+	FAssetCsvSyncSchemaCache& Cache = AssetCsvSync_SchemaCache;
+	Cache.ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddLambda([](FName, EModuleChangeReason)
+	{
+		AssetCsvSync_InvalidateSchemas();
+	});
+	Cache.ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason)
+	{
+		AssetCsvSync_InvalidateSchemas();
+	});
+	if (GEditor)
+	{
+		AssetCsvSync_BindSchemaEditorEvents();
+	}
+	else
+	{
+		Cache.PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddStatic(&AssetCsvSync_BindSchemaEditorEvents);
+	}
+}
+
+void FAssetCsvSyncSourceStamp::Unregister()
+{
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+	UObject::FAssetRegistryTag::OnGetExtraObjectTags.Remove(AssetCsvSync_RegistryTagsHandle);
+#else
+	UObject::FAssetRegistryTag::OnGetExtraObjectTagsWithContext.Remove(AssetCsvSync_RegistryTagsHandle);
+#endif
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(AssetCsvSync_PropertyChangedHandle);
+
+	FAssetCsvSyncSchemaCache& Cache = AssetCsvSync_SchemaCache;
+	FModuleManager::Get().OnModulesChanged().Remove(Cache.ModulesChangedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(Cache.ReloadCompleteHandle);
+	FCoreDelegates::OnPostEngineInit.Remove(Cache.PostEngineInitHandle);
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(Cache.BlueprintCompiledHandle);
+	}
+	Cache = FAssetCsvSyncSchemaCache();
+}
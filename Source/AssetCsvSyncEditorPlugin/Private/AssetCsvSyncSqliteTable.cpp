@@ -0,0 +1,318 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#include "AssetCsvSyncSqliteTable.h"
+
+#include "AssetCsvSyncLog.h"
+
+#include "Misc/Paths.h"
+#include "SQLiteDatabase.h"
+
+static const TCHAR* AssetCsvSync_SqliteCatalog = TEXT("AssetCsvSync_Tables");
+
+static FString AssetCsvSync_QuoteIdentifier(const FString& Name)
+{
+	return TEXT("\"") + Name.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+}
+
+static const TCHAR* AssetCsvSync_SqliteType(EAssetCsvSyncBinaryKind Kind)
+{
+	switch (Kind)
+	{
+	case EAssetCsvSyncBinaryKind::Int64:
+	case EAssetCsvSyncBinaryKind::Bool:
+		return TEXT("INTEGER");
+	case EAssetCsvSyncBinaryKind::Double:
+		return TEXT("REAL");
+	default:
+		return TEXT("TEXT");
+	}
+}
+
+bool FAssetCsvSyncSqliteWriter::IsSqliteFile(const FString& FilePath)
+{
+	const FString Extension = FPaths::GetExtension(FilePath);
+	return Extension.Equals(TEXT("db"), ESearchCase::IgnoreCase) || Extension.Equals(TEXT("sqlite"), ESearchCase::IgnoreCase);
+}
+
+int32 FAssetCsvSyncSqliteWriter::AddRow(const UClass* Class)
+{
+	const FString ClassPath = Class->GetPathName();
+	int32 Table = INDEX_NONE;
+	if (const int32* Found = TableIndex.Find(ClassPath))
+	{
+		Table = *Found;
+	}
+	else
+	{
+		Table = Tables.AddDefaulted();
+		Tables[Table].ClassPath = ClassPath;
+		Tables[Table].ClassName = Class->GetName();
+		TableIndex.Add(ClassPath, Table);
+	}
+
+	FRow& Row = Rows.AddDefaulted_GetRef();
+	Row.Table = Table;
+	return Rows.Num() - 1;
+}
+
+void FAssetCsvSyncSqliteWriter::SetCell(int32 RowIndex, const FString& ColumnName, FAssetCsvSyncTypedCell&& Value)
+{
+	FRow& Row = Rows[RowIndex];
+	FTable& Table = Tables[Row.Table];
+	FCell& Cell = Row.Cells.AddDefaulted_GetRef();
+	if (const int32* Found = Table.ColumnIndex.Find(ColumnName))
+	{
+		Cell.Column = *Found;
+		// SQLite keeps each value's own type, so a column only needs its declared type relaxed.
+		if (Table.Kinds[Cell.Column] != Value.Kind)
+		{
+			Table.Kinds[Cell.Column] = EAssetCsvSyncBinaryKind::Text;
+		}
+	}
+	else
+	{
+		Cell.Column = Table.Columns.Add(ColumnName);
+		Table.Kinds.Add(Value.Kind);
+		Table.ColumnIndex.Add(ColumnName, Cell.Column);
+	}
+	Cell.Value = MoveTemp(Value);
+}
+
+// The table name a class already has in the catalog, or its class name (suffixed while another table has it).
+static FString AssetCsvSync_ResolveTableName(FSQLiteDatabase& Database, const FString& ClassPath, const FString& ClassName)
+{
+	FSQLitePreparedStatement ByClass = Database.PrepareStatement(*FString::Printf(TEXT("SELECT TableName FROM %s WHERE ClassPath = ?1"), AssetCsvSync_SqliteCatalog));
+	ByClass.SetBindingValueByIndex(1, ClassPath);
+	FString TableName;
+	if (ByClass.Step() == ESQLitePreparedStatementStepResult::Row && ByClass.GetColumnValueByIndex(0, TableName))
+		return TableName;
+
+	FSQLitePreparedStatement Existing = Database.PrepareStatement(TEXT("SELECT 1 FROM sqlite_master WHERE name = ?1"));
+	TableName = ClassName;
+	for (int32 Attempt = 2; ; ++Attempt)
+	{
+		Existing.Reset();
+		Existing.SetBindingValueByIndex(1, TableName);
+		if (Existing.Step() != ESQLitePreparedStatementStepResult::Row)
+			return TableName;
+		TableName = FString::Printf(TEXT("%s_%d"), *ClassName, Attempt);
+	}
+}
+
+bool FAssetCsvSyncSqliteWriter::Save(const FString& FilePath, const FString& KeyColumn) const
+{
+	FSQLiteDatabase Database;
+	if (!Database.Open(*FilePath, ESQLiteDatabaseOpenMode::ReadWriteCreate))
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("SaveSqliteTables: Could not open %s: %s"), *FilePath, *Database.GetLastError());
+		return false;
+	}
+
+	auto Fail = [&Database, &FilePath](bool bInTransaction)
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("SaveSqliteTables: %s: %s"), *FilePath, *Database.GetLastError());
+		if (bInTransaction)
+		{
+			Database.Execute(TEXT("ROLLBACK"));
+		}
+		Database.Close();
+		return false;
+	};
+
+	// One transaction for every table: a single journal sync instead of one per row, and readers never see half an export.
+	if (!Database.Execute(TEXT("BEGIN TRANSACTION")))
+		return Fail(false);
+	if (!Database.Execute(*FString::Printf(TEXT("CREATE TABLE IF NOT EXISTS %s (TableName TEXT PRIMARY KEY, ClassPath TEXT NOT NULL UNIQUE, KeyColumn TEXT NOT NULL)"), AssetCsvSync_SqliteCatalog)))
+		return Fail(true);
+
+	TArray<TArray<const FRow*>> RowsByTable;
+	RowsByTable.SetNum(Tables.Num());
+	for (const FRow& Row : Rows)
+	{
+		RowsByTable[Row.Table].Add(&Row);
+	}
+
+	// Writes one table. Its prepared statements are finalized when it returns, before a failure closes the database:
+	// a statement still alive would keep the connection, and the file lock with it, open.
+	auto WriteTable = [this, &Database, &KeyColumn, &RowsByTable](int32 TableIndexValue)
+	{
+		const FTable& Table = Tables[TableIndexValue];
+		const FString TableName = AssetCsvSync_ResolveTableName(Database, Table.ClassPath, Table.ClassName);
+		const FString QuotedTable = AssetCsvSync_QuoteIdentifier(TableName);
+
+		// The key column is the primary key, which gives it a unique index.
+		FString Create = FString::Printf(TEXT("CREATE TABLE %s ("), *QuotedTable);
+		FString Insert = FString::Printf(TEXT("INSERT INTO %s ("), *QuotedTable);
+		FString Parameters;
+		for (int32 Column = 0; Column < Table.Columns.Num(); ++Column)
+		{
+			const FString QuotedColumn = AssetCsvSync_QuoteIdentifier(Table.Columns[Column]);
+			const TCHAR* Separator = Column > 0 ? TEXT(", ") : TEXT("");
+			Create += FString::Printf(TEXT("%s%s %s%s"), Separator, *QuotedColumn, AssetCsvSync_SqliteType(Table.Kinds[Column]),
+				Table.Columns[Column] == KeyColumn ? TEXT(" PRIMARY KEY") : TEXT(""));
+			Insert += Separator + QuotedColumn;
+			Parameters += FString::Printf(TEXT("%s?%d"), Separator, Column + 1);
+		}
+		Create += TEXT(")");
+		Insert += TEXT(") VALUES (") + Parameters + TEXT(")");
+
+		if (!Database.Execute(*FString::Printf(TEXT("DROP TABLE IF EXISTS %s"), *QuotedTable)) || !Database.Execute(*Create))
+			return false;
+
+		FSQLitePreparedStatement Catalog = Database.PrepareStatement(*FString::Printf(TEXT("INSERT OR REPLACE INTO %s (TableName, ClassPath, KeyColumn) VALUES (?1, ?2, ?3)"), AssetCsvSync_SqliteCatalog));
+		Catalog.SetBindingValueByIndex(1, TableName);
+		Catalog.SetBindingValueByIndex(2, Table.ClassPath);
+		Catalog.SetBindingValueByIndex(3, KeyColumn);
+		if (!Catalog.Execute())
+			return false;
+
+		// One prepared insert per table, rebound for every row; unbound parameters insert NULL.
+		FSQLitePreparedStatement Statement = Database.PrepareStatement(*Insert, ESQLitePreparedStatementFlags::Persistent);
+		if (!Statement.IsValid())
+			return false;
+		for (const FRow* Row : RowsByTable[TableIndexValue])
+		{
+			Statement.Reset();
+			Statement.ClearBindings();
+			for (const FCell& Cell : Row->Cells)
+			{
+				switch (Cell.Value.Kind)
+				{
+				case EAssetCsvSyncBinaryKind::Int64:
+				case EAssetCsvSyncBinaryKind::Bool:
+					Statement.SetBindingValueByIndex(Cell.Column + 1, Cell.Value.Int);
+					break;
+				case EAssetCsvSyncBinaryKind::Double:
+					Statement.SetBindingValueByIndex(Cell.Column + 1, Cell.Value.Double);
+					break;
+				default:
+					Statement.SetBindingValueByIndex(Cell.Column + 1, Cell.Value.String);
+					break;
+				}
+			}
+			if (!Statement.Execute())
+				return false;
+		}
+		return true;
+	};
+	for (int32 TableIndexValue = 0; TableIndexValue < Tables.Num(); ++TableIndexValue)
+	{
+		if (!WriteTable(TableIndexValue))
+			return Fail(true);
+	}
+
+	if (!Database.Execute(TEXT("COMMIT")))
+		return Fail(true);
+	return Database.Close();
+}
+
+// Table names of the catalog entries whose class is in ClassPaths (all of them when empty).
+static bool AssetCsvSync_ReadCatalog(FSQLiteDatabase& Database, const TSet<FString>& ClassPaths, TArray<FString>& OutTables)
+{
+	FSQLitePreparedStatement Catalog = Database.PrepareStatement(*FString::Printf(TEXT("SELECT TableName, ClassPath FROM %s ORDER BY TableName"), AssetCsvSync_SqliteCatalog));
+	if (!Catalog.IsValid())
+		return false;
+
+	ESQLitePreparedStatementStepResult Step;
+	while ((Step = Catalog.Step()) == ESQLitePreparedStatementStepResult::Row)
+	{
+		FString TableName;
+		FString ClassPath;
+		Catalog.GetColumnValueByIndex(0, TableName);
+		Catalog.GetColumnValueByIndex(1, ClassPath);
+		if (ClassPaths.Num() == 0 || ClassPaths.Contains(ClassPath))
+		{
+			OutTables.Add(MoveTemp(TableName));
+		}
+	}
+	return Step == ESQLitePreparedStatementStepResult::Done;
+}
+
+bool FAssetCsvSyncSqliteReader::ForEachRow(const FString& FilePath, const TSet<FString>& ClassPaths, FOnRow OnRow)
+{
+	FSQLiteDatabase Database;
+	if (!Database.Open(*FilePath, ESQLiteDatabaseOpenMode::ReadOnly))
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: Could not open %s: %s"), *FilePath, *Database.GetLastError());
+		return false;
+	}
+
+	TArray<FString> Tables;
+	bool bOk = AssetCsvSync_ReadCatalog(Database, ClassPaths, Tables);
+	for (int32 Index = 0; bOk && Index < Tables.Num(); ++Index)
+	{
+		// Rows are stepped one at a time; only the current row's cells are copied out.
+		FSQLitePreparedStatement Statement = Database.PrepareStatement(*FString::Printf(TEXT("SELECT * FROM %s"), *AssetCsvSync_QuoteIdentifier(Tables[Index])));
+		bOk = Statement.IsValid();
+		const TArray<FString> Columns = bOk ? Statement.GetColumnNames() : TArray<FString>();
+
+		TArray<FString> Names;
+		TArray<FString> Values;
+		ESQLitePreparedStatementStepResult Step = ESQLitePreparedStatementStepResult::Error;
+		while (bOk && (Step = Statement.Step()) == ESQLitePreparedStatementStepResult::Row)
+		{
+			Names.Reset();
+			Values.Reset();
+			for (int32 Column = 0; Column < Columns.Num(); ++Column)
+			{
+				ESQLiteColumnType Type = ESQLiteColumnType::Null;
+				Statement.GetColumnTypeByIndex(Column, Type);
+				FString Value;
+				switch (Type)
+				{
+				case ESQLiteColumnType::Null:
+					continue;
+				case ESQLiteColumnType::Integer:
+				{
+					int64 Int = 0;
+					Statement.GetColumnValueByIndex(Column, Int);
+					Value = LexToString(Int);
+					break;
+				}
+				case ESQLiteColumnType::Float:
+				{
+					// Round-trip precision; SQLite's own text conversion keeps only 15 digits.
+					double Double = 0.0;
+					Statement.GetColumnValueByIndex(Column, Double);
+					Value = FString::Printf(TEXT("%.17g"), Double);
+					break;
+				}
+				default:
+					Statement.GetColumnValueByIndex(Column, Value);
+					break;
+				}
+				Names.Add(Columns[Column]);
+				Values.Add(MoveTemp(Value));
+			}
+			OnRow(Names, Values);
+		}
+		bOk = bOk && Step == ESQLitePreparedStatementStepResult::Done;
+	}
+
+	if (!bOk)
+	{
+		UE_LOG(LogAssetCsvSync, Error, TEXT("ImportCSVTableToDataAssets: Could not read %s: %s"), *FilePath, *Database.GetLastError());
+	}
+	Database.Close();
+	return bOk;
+}
+
+bool FAssetCsvSyncSqliteReader::GetColumns(const FString& FilePath, TArray<FString>& OutColumns)
+{
+	FSQLiteDatabase Database;
+	if (!Database.Open(*FilePath, ESQLiteDatabaseOpenMode::ReadOnly))
+		return false;
+
+	TArray<FString> Tables;
+	const bool bOk = AssetCsvSync_ReadCatalog(Database, TSet<FString>(), Tables);
+	for (const FString& Table : Tables)
+	{
+		FSQLitePreparedStatement Statement = Database.PrepareStatement(*FString::Printf(TEXT("SELECT * FROM %s LIMIT 0"), *AssetCsvSync_QuoteIdentifier(Table)));
+		for (const FString& Column : Statement.GetColumnNames())
+		{
+			OutColumns.AddUnique(Column);
+		}
+	}
+	Database.Close();
+	return bOk;
+}
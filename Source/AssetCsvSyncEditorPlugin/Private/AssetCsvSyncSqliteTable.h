@@ -0,0 +1,68 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UnrealType.h"
+#include "AssetCsvSyncBinaryTable.h"
+
+// SQLite table databases (.db, .sqlite): one SQL table per exported class, named after the class and listed with
+// its class path in the AssetCsvSync_Tables catalog. The key column is the table's primary key, so lookups by asset
+// path are indexed. Numbers and booleans are stored as INTEGER/REAL values, names and strings as TEXT; other
+// leaves (structs, object paths, containers) keep their CSV cell text. Cells without a value are NULL.
+//
+// Exporting a class replaces its table; tables of other classes in the same database are kept.
+class FAssetCsvSyncSqliteWriter
+{
+public:
+	static bool IsSqliteFile(const FString& FilePath);
+
+	// Adds a row to the table of Class.
+	int32 AddRow(const UClass* Class);
+	int32 NumRows() const { return Rows.Num(); }
+
+	void SetCell(int32 Row, const FString& Column, FAssetCsvSyncTypedCell&& Cell);
+
+	// Writes every table in one transaction with one prepared insert per table.
+	bool Save(const FString& FilePath, const FString& KeyColumn) const;
+
+private:
+	struct FCell
+	{
+		int32 Column = INDEX_NONE;
+		FAssetCsvSyncTypedCell Value;
+	};
+
+	struct FRow
+	{
+		int32 Table = INDEX_NONE;
+		TArray<FCell> Cells;
+	};
+
+	struct FTable
+	{
+		FString ClassPath;
+		FString ClassName;
+		TArray<FString> Columns;
+		// Declared type of each column: the kind of its first value, Text once values of different kinds meet.
+		TArray<EAssetCsvSyncBinaryKind> Kinds;
+		TMap<FString, int32> ColumnIndex;
+	};
+
+	TArray<FTable> Tables;
+	TMap<FString, int32> TableIndex;
+	TArray<FRow> Rows;
+};
+
+// Reads rows back out of a table database through one prepared SELECT per table.
+struct FAssetCsvSyncSqliteReader
+{
+	// Called for each row with the names and text of its non-NULL cells.
+	using FOnRow = TFunctionRef<void(const TArray<FString>& Names, const TArray<FString>& Values)>;
+
+	// Streams the rows of the tables whose class path is in ClassPaths (every table when empty), table by table.
+	static bool ForEachRow(const FString& FilePath, const TSet<FString>& ClassPaths, FOnRow OnRow);
+
+	// Column names of every table in catalog order, without duplicates.
+	static bool GetColumns(const FString& FilePath, TArray<FString>& OutColumns);
+};
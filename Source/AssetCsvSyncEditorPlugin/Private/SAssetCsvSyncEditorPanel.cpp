@@ -4,6 +4,7 @@
 
 #include "AssetCsvSyncCSVHandler.h"
 #include "AssetCsvSyncEditorPanelSettings.h"
+#include "AssetCsvSyncJobs.h"
 
 #include "Framework/Notifications/NotificationManager.h"
 #include "Modules/ModuleManager.h"
@@ -111,7 +112,7 @@ void SAssetCsvSyncEditorPanel::Construct(const FArguments& InArgs)
 					.Text(FText::FromString(TEXT("Import CSV")))
 					.IsEnabled_Lambda([this]()
 					{
-						return ImportSettings.IsValid() && ImportSettings->DataAsset != nullptr && !ImportSettings->CSVFile.FilePath.IsEmpty() && ImportSettings->ImportColumns.Num() > 0;
+						return ImportSettings.IsValid() && (ImportSettings->DataAsset != nullptr || ImportSettings->TableClass != nullptr) && !ImportSettings->CSVFile.FilePath.IsEmpty() && ImportSettings->ImportColumns.Num() > 0;
 					})
 					.OnClicked(this, &SAssetCsvSyncEditorPanel::OnImportClicked)
 				]
@@ -132,8 +133,8 @@ FReply SAssetCsvSyncEditorPanel::OnExportClicked()
 		return FReply::Handled();
 	}
 
-	const bool bOk = UAssetCsvSyncCSVHandler::ExportDataAssetToCSV_Columns(ExportSettings->DataAsset, ExportSettings->CSVFile.FilePath, ExportSettings->ExportColumns);
-	Notify(bOk ? FText::FromString(TEXT("Export complete.")) : FText::FromString(TEXT("Export failed. Check Output Log.")), bOk);
+	// Runs from the job queue, which reports progress and the outcome in its own notification.
+	FAssetCsvSyncJobQueue::Get().Enqueue(UAssetCsvSyncCSVHandler::MakeExportJob(ExportSettings->DataAsset, ExportSettings->CSVFile.FilePath, ExportSettings->ExportColumns));
 	return FReply::Handled();
 }
 FReply SAssetCsvSyncEditorPanel::OnImportClicked()
@@ -151,14 +152,34 @@ FReply SAssetCsvSyncEditorPanel::OnImportClicked()
 		return FReply::Handled();
 	}
 
+	if (ImportSettings->TableClass)
+	{
+		if (ImportSettings->AssetFolder.Path.IsEmpty())
+		{
+			Notify(FText::FromString(TEXT("Select a content folder for the table's assets.")), false);
+			return FReply::Handled();
+		}
+
+		// Importing every header column is a full-row import, which lets unchanged rows be skipped by their source stamp.
+		TArray<FString> Columns = ImportSettings->ImportColumns;
+		TArray<FString> HeaderColumns;
+		if (UAssetCsvSyncCSVHandler::GetCSVHeaderColumns(SourcePath, HeaderColumns) && HeaderColumns.Num() == Columns.Num() && !HeaderColumns.ContainsByPredicate([&Columns](const FString& Column) { return !Columns.Contains(Column); }))
+		{
+			Columns.Reset();
+		}
+
+		FAssetCsvSyncJobQueue::Get().Enqueue(UAssetCsvSyncCSVHandler::MakeTableImportJob(SourcePath, ImportSettings->TableClass, ImportSettings->AssetFolder.Path, Columns, ImportSettings->bSavePackage));
+		return FReply::Handled();
+	}
+
 	if (!ImportSettings->DataAsset)
 	{
-		Notify(FText::FromString(TEXT("Select a Data Asset to update.")), false);
+		Notify(FText::FromString(TEXT("Select a Data Asset to update, or a table class to import rows into.")), false);
 		return FReply::Handled();
 	}
 
-	const bool bOk = UAssetCsvSyncCSVHandler::ImportCSVToDataAssetInPlace(SourcePath, ImportSettings->DataAsset, ImportSettings->ImportColumns, ImportSettings->bSavePackage);
-	Notify(bOk ? FText::FromString(TEXT("Import complete.")) : FText::FromString(TEXT("Import failed. Check Output Log.")), bOk);
+	// The job's notification shows progress, a Cancel button and the number of changed columns when done.
+	FAssetCsvSyncJobQueue::Get().Enqueue(UAssetCsvSyncCSVHandler::MakeImportJob(SourcePath, ImportSettings->DataAsset, ImportSettings->ImportColumns, ImportSettings->bSavePackage));
 	return FReply::Handled();
 }
 void SAssetCsvSyncEditorPanel::Notify(const FText& Message, bool bSuccess) const
@@ -10,6 +10,193 @@
 #include "ExportableMetaData.h"
 #include "AssetCsvSyncCSVHandler.generated.h"
 
+struct FAssetCsvSyncImportContext;
+struct FAssetCsvSyncColumnFilter;
+struct FAssetCsvSyncTableWriter;
+struct FAssetCsvSyncExportSink;
+struct FAssetCsvSyncStagedRow;
+struct FAssetCsvSyncSingleRowCSV;
+struct FAssetCsvSyncTableImport;
+struct FAssetCsvSyncBulkExport;
+class FAssetCsvSyncJob;
+enum class EAssetCsvSyncJobResult : uint8;
+
+// On-disk table formats, picked by file extension: .csv, .jsonl (JSON Lines), .acsb (binary columnar) or .db/.sqlite.
+enum class EAssetCsvSyncTableFormat : uint8
+{
+	Csv,
+	JsonLines,
+	Binary,
+	Sqlite,
+};
+
+USTRUCT(BlueprintType)
+struct ASSETCSVSYNCEDITORPLUGIN_API FAssetCsvSyncImportResult
+{
+	GENERATED_BODY()
+
+	// Number of CSV columns whose parsed value differed from the asset and was written.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 ChangedColumns = 0;
+
+	// True when at least one package was saved. Unchanged assets are never saved.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	bool bSaved = false;
+};
+
+USTRUCT(BlueprintType)
+struct ASSETCSVSYNCEDITORPLUGIN_API FAssetCsvSyncTableImportResult
+{
+	GENERATED_BODY()
+
+	// Data rows read from the CSV (header excluded).
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 Rows = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 AssetsCreated = 0;
+
+	// Rows skipped without loading their asset, because the registry shows it was imported from the same row.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 AssetsUpToDate = 0;
+
+	// Existing or created assets that had at least one column changed.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 AssetsChanged = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 ChangedColumns = 0;
+
+	// Unchanged assets that were stamped and queued for saving: by RestampCSVTableAssets, or because another row
+	// already saves their package.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 AssetsRestamped = 0;
+
+	// Packages written by the save passes (one at the end, plus one per memory budget release).
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 PackagesSaved = 0;
+
+	// Rows skipped because of a column count mismatch, a bad key or a class mismatch.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 FailedRows = 0;
+
+	// Times the import released packages and collected garbage because it crossed MemoryBudgetMB.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 GarbageCollections = 0;
+
+	// Highest process physical memory use sampled after each batch.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	double PeakUsedPhysicalMB = 0.0;
+};
+
+UENUM(BlueprintType)
+enum class EAssetCsvSyncShardMode : uint8
+{
+	// One file, no manifest.
+	None UMETA(DisplayName = "Single File"),
+	// A new shard every MaxRowsPerShard rows.
+	RowCount UMETA(DisplayName = "Row Count"),
+	// A new shard once the current one would exceed MaxShardSizeMB.
+	ByteSize UMETA(DisplayName = "Byte Size"),
+	// One shard per distinct value of PartitionColumn.
+	PartitionColumn UMETA(DisplayName = "Partition Column"),
+};
+
+// How a bulk export splits its rows into shard files. Shards sit next to the manifest and are named
+// <Manifest>.<Index or partition value>.csv; each one has the full header, so it also opens on its own.
+USTRUCT(BlueprintType)
+struct ASSETCSVSYNCEDITORPLUGIN_API FAssetCsvSyncShardOptions
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetCsvSync")
+	EAssetCsvSyncShardMode Mode = EAssetCsvSyncShardMode::None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetCsvSync", meta = (ClampMin = "1"))
+	int32 MaxRowsPerShard = 50000;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetCsvSync", meta = (ClampMin = "1", Units = "Megabytes"))
+	int32 MaxShardSizeMB = 64;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetCsvSync")
+	FString PartitionColumn;
+};
+
+USTRUCT(BlueprintType)
+struct ASSETCSVSYNCEDITORPLUGIN_API FAssetCsvSyncBulkExportResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 AssetsExported = 0;
+
+	// Registry entries that could not be loaded as a DataAsset.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 AssetsSkipped = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	double Seconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	double AssetsPerSecond = 0.0;
+
+	// Highest process physical memory use sampled after each batch was loaded.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	double PeakUsedPhysicalMB = 0.0;
+
+	// Times the export released loaded packages and collected garbage: on crossing MemoryBudgetMB or, without a
+	// budget, once every few batches.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 GarbageCollections = 0;
+
+	// Shard files written; 0 for a single-file export.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 ShardsWritten = 0;
+};
+
+USTRUCT(BlueprintType)
+struct ASSETCSVSYNCEDITORPLUGIN_API FAssetCsvSyncUpsertResult
+{
+	GENERATED_BODY()
+
+	// Data rows already in the file.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 RowsScanned = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 RowsReplaced = 0;
+
+	// Rows whose key matched an asset but whose cells already held its values.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 RowsUnchanged = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int32 RowsAppended = 0;
+
+	// Bytes of the old file copied through unchanged.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	int64 BytesCopied = 0;
+
+	// False when nothing changed and the file was left untouched.
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	bool bFileWritten = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AssetCsvSync")
+	double Seconds = 0.0;
+};
+
+// Marks the imports made while it is alive as one bulk operation: table imports, directory syncs and the commandlet.
+// Game thread only. See UAssetCsvSyncCSVHandler::ShouldRecordImportUndo.
+struct ASSETCSVSYNCEDITORPLUGIN_API FAssetCsvSyncBulkImportScope
+{
+	UE_NONCOPYABLE(FAssetCsvSyncBulkImportScope);
+
+	FAssetCsvSyncBulkImportScope();
+	~FAssetCsvSyncBulkImportScope();
+
+	static bool IsActive();
+};
+
 UCLASS()
 class ASSETCSVSYNCEDITORPLUGIN_API UAssetCsvSyncCSVHandler : public UObject
 {
@@ -23,6 +210,50 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
 	static bool ExportDataAssetToCSV_Columns(UDataAsset* DataAsset, const FString& FilePath, const TArray<FString>& ColumnsToExport);
 
+	// Table mode: exports every asset as one row under a shared header.
+	// The first column is the key column (see TableKeyColumn in the plugin settings) holding the asset path.
+	// A .jsonl FilePath writes JSON Lines instead: one object per asset, with structs and containers as JSON values.
+	// A .acsb FilePath writes a binary columnar table: numbers, booleans, names and strings typed, per-column zlib.
+	// A .db/.sqlite FilePath writes into a SQLite database, one table per asset class keyed by the key column.
+	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
+	static bool ExportDataAssetsToCSVTable(const TArray<UDataAsset*>& DataAssets, const FString& FilePath, const TArray<FString>& ColumnsToExport);
+
+	// Table mode, in place: rewrites only the rows of an existing table CSV whose key matches one of the assets
+	// and appends rows for the others. Columns not being exported keep the file's values. Every other byte is
+	// copied through as is, and the file is replaced atomically (temp file + move) only if something changed.
+	// Creates the file like ExportDataAssetsToCSVTable when it does not exist. An existing schema sidecar gets the
+	// upserted classes and columns merged in, or is deleted when its class fingerprints are stale.
+	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
+	static bool UpsertDataAssetsInCSVTable(const TArray<UDataAsset*>& DataAssets, const FString& FilePath, const TArray<FString>& ColumnsToExport, FAssetCsvSyncUpsertResult& OutResult);
+
+	// Exports every asset of a CsvExport class found in the Asset Registry into one table, in the format FilePath's
+	// extension selects (see ExportDataAssetsToCSVTable).
+	// Assets are loaded in async batches (BulkExportBatchSize) and released again before the next batch.
+	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
+	static bool ExportAllDataAssetsOfClassToCSV(UClass* DataAssetClass, const FString& FilePath, const TArray<FString>& ColumnsToExport, bool bIncludeSubclasses, FAssetCsvSyncBulkExportResult& OutResult);
+
+	// Like ExportAllDataAssetsOfClassToCSV, but splits the rows into shard files that are written concurrently,
+	// plus a JSON manifest at ManifestPath listing them. The table import accepts the manifest in place of a CSV.
+	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
+	static bool ExportAllDataAssetsOfClassToShards(UClass* DataAssetClass, const FString& ManifestPath, const TArray<FString>& ColumnsToExport, bool bIncludeSubclasses, const FAssetCsvSyncShardOptions& Shards, FAssetCsvSyncBulkExportResult& OutResult);
+
+	// Table mode: applies each row to the asset named by its key column. A key is either an asset path
+	// ("/Game/Data/Sword") or an asset name resolved inside AssetFolder. Missing assets are created.
+	// FilePath may also be a shard manifest (.json); the shards are then read and parsed in parallel.
+	// A JSON Lines file (.jsonl) is read the same way, one record per line, with the key column as a field.
+	// A binary table (.acsb) is memory mapped and its typed cells are set on the properties without text parsing.
+	// A SQLite database (.db/.sqlite) is read from the tables of DataAssetClass and its subclasses, row by row.
+	// A CSV with a schema sidecar (<FilePath>.schema.json, see bWriteSchemaSidecar) has its typed columns validated
+	// before any asset is loaded; rows with a cell that does not convert are counted as failed and not applied.
+	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
+	static bool ImportCSVTableToDataAssets(const FString& FilePath, UClass* DataAssetClass, const FString& AssetFolder, const TArray<FString>& ColumnsToImport, bool bSavePackage, FAssetCsvSyncTableImportResult& OutResult);
+
+	// Full-row ImportCSVTableToDataAssets that also stamps the assets the table leaves unchanged, and saves them
+	// when bSavePackage is set. Run it once over assets imported before source stamps, or with stale stamps, so
+	// later imports skip them without loading.
+	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
+	static bool RestampCSVTableAssets(const FString& FilePath, UClass* DataAssetClass, const FString& AssetFolder, bool bSavePackage, FAssetCsvSyncTableImportResult& OutResult);
+
 	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
 	static bool ImportCSVToDataAsset(const FString& FilePath, UDataAsset*& OutDataAsset, UClass* DataAssetClass);
 
@@ -30,6 +261,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
 	static bool ImportCSVToDataAssetInPlace(const FString& FilePath, UDataAsset* DataAsset, const TArray<FString>& ColumnsToImport, bool bSavePackage);
 
+	// Same as ImportCSVToDataAssetInPlace, but reports what was changed.
+	// Only properties whose value differs are written; the asset is not dirtied or saved when nothing changed.
+	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
+	static bool ImportCSVToDataAssetInPlaceWithResult(const FString& FilePath, UDataAsset* DataAsset, const TArray<FString>& ColumnsToImport, bool bSavePackage, FAssetCsvSyncImportResult& OutResult);
+
 	// Creates a new DataAsset at AssetPath and imports the CSV into it
 	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
 	static bool ImportCSVToNewDataAsset(const FString& FilePath, const FString& AssetPath, UClass* DataAssetClass, UDataAsset*& OutDataAsset, bool bSavePackage);
@@ -38,31 +274,79 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
 	static bool CreateNewDataAssetAsset(const FString& AssetPath, UClass* DataAssetClass, UDataAsset*& OutDataAsset, bool bSavePackage);
 
+	// Saves the given packages in one pass (single source control checkout, concurrent save when enabled).
+	// Returns the number of packages written.
+	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
+	static int32 SavePackages(const TArray<UPackage*>& Packages);
+
+	// True when the process uses more physical memory than MemoryBudgetMB (never when the budget is 0).
+	static bool IsOverMemoryBudget();
+
+	// bRecordImportUndo, except for bulk imports while MemoryBudgetMB is set: the transaction buffer references
+	// every object it recorded, so those packages could never be released to stay under the budget.
+	static bool ShouldRecordImportUndo();
+	static double GetUsedPhysicalMB();
+
+	// Lets the garbage collector reclaim packages a batch operation loaded, then collects.
+	// Dirty packages and assets open in an editor are kept.
+	static void ReleasePackagesAndCollect(const TArray<TWeakObjectPtr<UPackage>>& Packages);
+
+	// Class paths of the exportable DataAsset classes, including Blueprint classes that are not loaded. Served from an index.
 	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
 	static TArray<FString> GetExportableDataAssetClasses();
 
 	UFUNCTION(BlueprintCallable, Category = "AssetCsvSync")
 	static TArray<FString> GetExportableProperties(UClass* Class);
+	// The columns a class binds without looking at an instance, as "Column:Type" (sorted), plus one "Prefix*:Type"
+	// entry per container expansion, whose columns depend on the data. Optionally maps each column to its leaf property.
+	static TArray<FString> GetBindingPlan(UClass* Class, TMap<FString, FProperty*>* OutColumnProperties = nullptr);
 	static bool GetCSVHeaderColumns(const FString& FilePath, TArray<FString>& OutColumns);
 
+	// Job versions of the operations above, for FAssetCsvSyncJobQueue. File IO and parsing run on workers;
+	// asset work runs on the game thread in small steps. OnComplete is called on the game thread.
+	static TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> MakeExportJob(UDataAsset* DataAsset, const FString& FilePath, const TArray<FString>& ColumnsToExport, TFunction<void(EAssetCsvSyncJobResult)> OnComplete = nullptr);
+	static TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> MakeImportJob(const FString& FilePath, UDataAsset* DataAsset, const TArray<FString>& ColumnsToImport, bool bSavePackage, TFunction<void(EAssetCsvSyncJobResult, const FAssetCsvSyncImportResult&)> OnComplete = nullptr);
+	static TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> MakeTableImportJob(const FString& FilePath, UClass* DataAssetClass, const FString& AssetFolder, const TArray<FString>& ColumnsToImport, bool bSavePackage, TFunction<void(EAssetCsvSyncJobResult, const FAssetCsvSyncTableImportResult&)> OnComplete = nullptr);
+	// With shard options other than None, FilePath is the manifest path (see ExportAllDataAssetsOfClassToShards).
+	static TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> MakeBulkExportJob(UClass* DataAssetClass, const FString& FilePath, const TArray<FString>& ColumnsToExport, bool bIncludeSubclasses, TFunction<void(EAssetCsvSyncJobResult, const FAssetCsvSyncBulkExportResult&)> OnComplete = nullptr, const FAssetCsvSyncShardOptions& Shards = FAssetCsvSyncShardOptions());
+
 private:
+	friend struct FAssetCsvSyncTableImport;
+	friend struct FAssetCsvSyncBulkExport;
+
+	static bool BuildDataAssetCSV(UDataAsset* DataAsset, const TArray<FString>& ColumnsToExport, FString& OutContent);
+	static bool ReadSingleRowCSV(const FString& FilePath, const TCHAR* LogContext, FAssetCsvSyncSingleRowCSV& OutCSV);
+	static bool ApplySingleRowCSV(const FAssetCsvSyncSingleRowCSV& CSV, UDataAsset* DataAsset, const TArray<FString>& ColumnsToImport, bool bSavePackage, FAssetCsvSyncImportResult& OutResult);
 	static bool CanExportClass(UClass* Class);
 	static bool ApplyCSVRowToObject(UObject* TargetObject, UClass* TargetClass, const TArray<FString>& Headers, const TArray<FString>& Values);
-	static bool ApplyColumnsToObject(UObject* TargetObject, UClass* TargetClass, const TMap<FString, FString>& ColumnToValue, const FString& Prefix, TSet<const UObject*>& Visited);
-	static void ExportObjectToColumns(UObject* ObjectOrNull, UClass* Class, TMap<FString, FString>& InOutColumnToValue, TArray<FString>& InOutColumnOrder, const FString& Prefix, TSet<const UObject*>& Visited);
+	static bool ApplyColumnsToDataAsset(UDataAsset* DataAsset, const TMap<FString, FString>& ColumnToValue, TArray<UPackage*>& InOutPackagesToSave, const FText& TransactionName, FAssetCsvSyncImportResult& OutResult, FAssetCsvSyncStagedRow* Staging = nullptr);
+	static bool ApplyColumnsToObject(UObject* TargetObject, UClass* TargetClass, const TMap<FString, FString>& ColumnToValue, const FString& Prefix, FAssetCsvSyncImportContext& Context);
+	static void ExportObjectToColumns(UObject* ObjectOrNull, UClass* Class, FAssetCsvSyncExportSink& Sink, const FString& Prefix, const FAssetCsvSyncColumnFilter& Filter, TSet<const UObject*>& Visited);
 	static void ExportClassColumnsEmpty(UClass* Class, TMap<FString, FString>& InOutColumnToValue, TArray<FString>& InOutColumnOrder, const FString& Prefix);
-	static void ExportStructToColumns(const void* StructPtr, UScriptStruct* Struct, TMap<FString, FString>& InOutColumnToValue, TArray<FString>& InOutColumnOrder, const FString& Prefix, TSet<const UObject*>& Visited);
+	static void ExportStructToColumns(const void* StructPtr, UScriptStruct* Struct, FAssetCsvSyncExportSink& Sink, const FString& Prefix, const FAssetCsvSyncColumnFilter& Filter, TSet<const UObject*>& Visited);
 	static void ExportStructColumnsEmpty(UScriptStruct* Struct, TMap<FString, FString>& InOutColumnToValue, TArray<FString>& InOutColumnOrder, const FString& Prefix);
+	static void AppendBindingPlan(UStruct* Struct, const FString& Prefix, TArray<FString>& OutPlan, TMap<FString, FProperty*>* OutColumnProperties, TArray<const UStruct*>& Stack);
 	static UObject* ResolveObjectPropertyValue(UObject* Container, FProperty* Property, bool bLoadSoft);
 	static UObject* ResolveObjectPropertyValueFromContainerPtr(const void* ContainerPtr, FProperty* Property, bool bLoadSoft);
 	static UClass* GetObjectPropertyClass(FProperty* Property);
-	static bool ApplyColumnsToStruct(void* StructPtr, UScriptStruct* Struct, const TMap<FString, FString>& ColumnToValue, const FString& Prefix, TSet<const UObject*>& Visited);
+	static bool ApplyColumnsToStruct(void* StructPtr, UScriptStruct* Struct, const TMap<FString, FString>& ColumnToValue, const FString& Prefix, FAssetCsvSyncImportContext& Context);
+	static void AddLeafValue(FAssetCsvSyncExportSink& Sink, const FString& ColumnName, FProperty* Property, const void* ValuePtr);
+	static void FormatStagedValues(FAssetCsvSyncExportSink& Sink, EAssetCsvSyncTableFormat Format);
+	static bool ImportLeafValue(FProperty* Property, void* ValuePtr, const FString& ColumnName, const FString& StringValue, FAssetCsvSyncImportContext& Context);
 
 	static FString PropertyToString(FProperty* Property, const uint8* PropertyData);
 	static bool StringToProperty(FProperty* Property, uint8* PropertyData, const FString& StringValue);
+	// Table cells are CSV text, JSON values when the row came from a JSON Lines file, or read by Column from the
+	// row's binary table.
+	static bool ParseCell(FProperty* Property, uint8* PropertyData, const FString& Column, const FString& Cell, const FAssetCsvSyncStagedRow* Staging);
 	static FString EscapeCSVString(const FString& Value);
 	static TArray<FString> ParseCSVLine(const FString& Line);
-	static FString EscapeListItem(const FString& Value);
+	static void AppendCSVRow(FString& InOutContent, const TArray<FString>& Cells);
+	static void CollectTableRows(TArray<FAssetCsvSyncExportSink>& OutSinks, const TArray<UDataAsset*>& DataAssets, const FString& KeyColumn, const FAssetCsvSyncColumnFilter& Filter, EAssetCsvSyncTableFormat Format = EAssetCsvSyncTableFormat::Csv);
+	static void AppendTableRows(FAssetCsvSyncTableWriter& Writer, const TArray<UDataAsset*>& DataAssets, const FAssetCsvSyncColumnFilter& Filter);
+	static bool SaveCSVTable(const FAssetCsvSyncTableWriter& Writer, const FString& FilePath, const TArray<int32>* RowIndices = nullptr);
+	static bool ReadCSVRecord(const FString& Content, int32& InOutPos, FString& OutRecord);
+	static UDataAsset* FindOrCreateTableAsset(const FString& AssetPath, UClass* DataAssetClass, bool& bOutCreated);
 	static TArray<FString> ParseListCell(const FString& Cell);
 	static FString JoinListCell(const TArray<FString>& Items);
 	static bool SplitAssetPath(const FString& InAssetPath, FString& OutPackageName, FString& OutAssetName);
@@ -0,0 +1,20 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Index of the DataAsset classes that can be exported (meta=(CsvExport)), so listing them does not walk every UClass.
+// Native classes are scanned once and then kept current per module as modules load and unload; a hot reload
+// rescans them. Blueprint classes come from the Asset Registry tags of Blueprint assets, so unloaded ones are
+// listed without loading them; that part is refreshed when Blueprints are added, removed, renamed or compiled.
+// Game thread only.
+class ASSETCSVSYNCEDITORPLUGIN_API FAssetCsvSyncClassIndex
+{
+public:
+	// Sorted class path names, e.g. /Script/MyGame.MyDataAsset or /Game/Data/BP_MyDataAsset.BP_MyDataAsset_C.
+	static const TArray<FString>& GetExportableClassPaths();
+
+	static void Register();
+	static void Unregister();
+};
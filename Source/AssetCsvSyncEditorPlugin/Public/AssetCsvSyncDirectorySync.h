@@ -0,0 +1,70 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UClass;
+
+enum class EAssetCsvSyncDirection : uint8
+{
+	// CSV files are the source of truth: assets are created or updated from them.
+	Import,
+	// Assets are the source of truth: CSV files are (re)written from them.
+	Export,
+	// Whichever side changed since the last sync wins. When both changed, the CSV wins.
+	Both,
+};
+
+struct ASSETCSVSYNCEDITORPLUGIN_API FAssetCsvSyncDirectorySyncOptions
+{
+	// Folder of single-asset CSVs. "<CsvDirectory>/Sub/Sword.csv" pairs with "<ContentPath>/Sub/Sword".
+	FString CsvDirectory;
+	// Long package path, e.g. "/Game/Data".
+	FString ContentPath;
+	// Class used for assets created from CSVs without a counterpart. Also limits which assets are paired (subclasses included).
+	UClass* DataAssetClass = nullptr;
+	EAssetCsvSyncDirection Direction = EAssetCsvSyncDirection::Import;
+	// Wildcards matched against the pair key (relative path without extension, "/" separated). Empty include = everything.
+	TArray<FString> IncludePatterns;
+	TArray<FString> ExcludePatterns;
+	// Apply/compare everything but do not save packages, write CSV files or update the manifest.
+	bool bDryRun = false;
+	// Only process pairs where a side changed since the last sync (per the manifest).
+	bool bIncremental = true;
+	// Defaults to Saved/AssetCsvSync/Manifest_<hash of both folders>.json.
+	FString ManifestPath;
+};
+
+struct ASSETCSVSYNCEDITORPLUGIN_API FAssetCsvSyncDirectorySyncResult
+{
+	int32 Pairs = 0;
+	// Pairs skipped because neither side changed since the last sync.
+	int32 Unchanged = 0;
+	int32 Imported = 0;
+	int32 Exported = 0;
+	int32 Created = 0;
+	int32 Failed = 0;
+	int32 PackagesSaved = 0;
+	int64 BytesRead = 0;
+	int64 BytesWritten = 0;
+	// Times loaded packages were released because the process crossed MemoryBudgetMB.
+	int32 GarbageCollections = 0;
+	double PeakUsedPhysicalMB = 0.0;
+
+	double DiscoverSeconds = 0.0;
+	double SyncSeconds = 0.0;
+	double SaveSeconds = 0.0;
+};
+
+// Keeps a folder of CSV files and a content folder in sync, one CSV per DataAsset.
+// A manifest remembers, per pair, the size/timestamp/MD5 of both the CSV and the .uasset as of the last sync,
+// so a run only stats files and touches the pairs where one side changed. Content is hashed only when the
+// size or timestamp differs from the manifest.
+class ASSETCSVSYNCEDITORPLUGIN_API FAssetCsvSyncDirectorySync
+{
+public:
+	static bool Run(const FAssetCsvSyncDirectorySyncOptions& Options, FAssetCsvSyncDirectorySyncResult& OutResult);
+
+	static bool MatchesFilters(const FString& Key, const TArray<FString>& IncludePatterns, const TArray<FString>& ExcludePatterns);
+};
@@ -43,4 +43,12 @@ public:
 
 	UPROPERTY(EditAnywhere, Category = "Import")
 	bool bSavePackage = true;
+
+	// Set to import the file as a table, one asset of this class (or the row's class) per row, instead of into DataAsset.
+	UPROPERTY(EditAnywhere, Category = "Import")
+	TSubclassOf<UDataAsset> TableClass;
+
+	// Content folder the table's assets are found in and created under.
+	UPROPERTY(EditAnywhere, Category = "Import", meta = (ContentDir))
+	FDirectoryPath AssetFolder;
 };
@@ -38,6 +38,52 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Import")
 	EAssetCsvSyncWriteBackScope WriteBackScope = EAssetCsvSyncWriteBackScope::RootAndExpanded;
 
+	// Record undo for imports. Only the properties that actually change are recorded.
+	// Table imports, directory syncs and the commandlet only record it when MemoryBudgetMB is 0 (the default):
+	// recorded assets stay referenced by the transaction buffer and could not be released. Each such import logs
+	// a warning when a budget turns its undo off.
+	UPROPERTY(EditAnywhere, config, Category = "Import")
+	bool bRecordImportUndo = true;
+
+	// Key column of multi-row (table) CSVs. Holds the asset path, or an asset name relative to the import folder.
+	UPROPERTY(EditAnywhere, config, Category = "Table")
+	FString TableKeyColumn = TEXT("AssetPath");
+
+	// Assets loaded per batch by bulk export. Larger batches overlap more IO but keep more packages in memory at once.
+	UPROPERTY(EditAnywhere, config, Category = "Table", meta = (ClampMin = "1"))
+	int32 BulkExportBatchSize = 256;
+
+	// Compress the column blocks of binary (.acsb) tables with zlib. Blocks that do not shrink are stored as is;
+	// uncompressed tables are read straight from the memory mapping on import.
+	UPROPERTY(EditAnywhere, config, Category = "Table")
+	bool bCompressBinaryTables = true;
+
+	// Write <table>.schema.json next to exported table CSVs: column converters plus class schema fingerprints.
+	// Import uses it to reject tables of unrelated classes and to validate and pre-parse typed columns up front.
+	UPROPERTY(EditAnywhere, config, Category = "Table")
+	bool bWriteSchemaSidecar = true;
+
+	// Save the packages touched by an import in one concurrent pass (UPackage::SaveConcurrent).
+	// When disabled, or for a single package, they are saved one after another.
+	UPROPERTY(EditAnywhere, config, Category = "Saving")
+	bool bConcurrentPackageSave = true;
+
+	// Upper bound on worker threads used for parallel formatting/parsing. 0 uses all task graph workers, 1 runs inline.
+	UPROPERTY(EditAnywhere, config, Category = "Performance", meta = (ClampMin = "0"))
+	int32 MaxWorkerThreads = 0;
+
+	// Game-thread time a queued import/export may use per editor tick. Rows are applied until the budget runs out,
+	// so large imports run alongside normal editing instead of hitching the editor.
+	UPROPERTY(EditAnywhere, config, Category = "Performance", meta = (ClampMin = "1", Units = "Milliseconds"))
+	float JobFrameBudgetMs = 8.0f;
+
+	// Resident memory ceiling for bulk imports, exports and directory syncs. Between batches, once the process
+	// uses more than this, packages touched so far are saved (when the operation saves), packages it loaded are
+	// released and garbage is collected. 0 disables the ceiling; bulk export then collects every few batches.
+	// Bulk imports do not record undo while a ceiling is set (see bRecordImportUndo), so it is off by default.
+	UPROPERTY(EditAnywhere, config, Category = "Performance", meta = (ClampMin = "0", Units = "Megabytes"))
+	int32 MemoryBudgetMB = 0;
+
 	static const UAssetCsvSyncEditorPluginSettings* Get()
 	{
 		return GetDefault<UAssetCsvSyncEditorPluginSettings>();
@@ -0,0 +1,115 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+
+#include <atomic>
+
+class SNotificationItem;
+
+enum class EAssetCsvSyncJobResult : uint8
+{
+	Succeeded,
+	Failed,
+	Cancelled,
+};
+
+enum class EAssetCsvSyncStepResult : uint8
+{
+	// Made progress; call the stage again while the tick's budget lasts.
+	Continue,
+	// Waiting on something else (e.g. async loads); call the stage again next tick.
+	Yield,
+	Done,
+	Failed,
+};
+
+// A queued sync operation: an ordered list of stages.
+// Background stages run on workers through UE::Tasks; consecutive background stages run concurrently.
+// Game-thread stages are stepped repeatedly until they report Done, within a per-tick time budget
+// (JobFrameBudgetMs), so the editor keeps a steady frame rate while a job runs.
+// Cancellation is cooperative: the queue stops between stages and steps, and stages poll IsCancelled()
+// between units of work (rows, batches), so an asset is never left half-applied.
+class ASSETCSVSYNCEDITORPLUGIN_API FAssetCsvSyncJob : public TSharedFromThis<FAssetCsvSyncJob, ESPMode::ThreadSafe>
+{
+public:
+	using FBackgroundWork = TFunction<bool(FAssetCsvSyncJob&)>;
+	using FGameThreadStep = TFunction<EAssetCsvSyncStepResult(FAssetCsvSyncJob&)>;
+	using FFinished = TFunction<void(EAssetCsvSyncJobResult)>;
+
+	explicit FAssetCsvSyncJob(const FText& InName);
+
+	FAssetCsvSyncJob& AddBackgroundStage(FBackgroundWork Work);
+	FAssetCsvSyncJob& AddGameThreadStage(FGameThreadStep Step);
+	// Called on the game thread exactly once, whatever the outcome.
+	FAssetCsvSyncJob& OnFinished(FFinished Callback);
+
+	// Thread-safe.
+	void Cancel();
+	bool IsCancelled() const;
+	void SetProgress(float Fraction, const FText& Status = FText::GetEmpty());
+	float GetProgress() const;
+	FText GetStatus() const;
+
+	// Game-thread time left in the current tick's budget. Steps use it to size their next unit of work.
+	double GetSliceSecondsLeft() const;
+
+	const FText& GetName() const
+	{
+		return Name;
+	}
+
+private:
+	friend class FAssetCsvSyncJobQueue;
+
+	struct FStage
+	{
+		FBackgroundWork Work;
+		FGameThreadStep Step;
+	};
+
+	FText Name;
+	TArray<FStage> Stages;
+	FFinished Finished;
+	std::atomic<bool> bCancelled{ false };
+
+	double SliceDeadline = 0.0;
+
+	mutable FCriticalSection ProgressLock;
+	float Progress = 0.0f;
+	FText Status;
+};
+
+// Runs queued jobs one after another from the core ticker, with a progress notification and a Cancel button per job.
+// Jobs are serialized because they usually touch the same assets; parallelism lives inside a job's stages.
+class ASSETCSVSYNCEDITORPLUGIN_API FAssetCsvSyncJobQueue
+{
+public:
+	static FAssetCsvSyncJobQueue& Get();
+
+	void Enqueue(const TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe>& Job);
+	void CancelAll();
+	// Runs every queued job to completion on the calling (game) thread. For scripts and commandlets.
+	void Flush();
+	// Cancels everything, waits for running background stages and finishes each job as Cancelled.
+	void Shutdown();
+
+	// Running and queued jobs.
+	int32 Num() const;
+
+private:
+	bool Tick(float DeltaTime);
+	void Finish(EAssetCsvSyncJobResult Result);
+	void UpdateNotification();
+
+	TArray<TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe>> Pending;
+	TSharedPtr<FAssetCsvSyncJob, ESPMode::ThreadSafe> Current;
+	int32 StageIndex = 0;
+	TArray<UE::Tasks::TTask<bool>> Running;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	TSharedPtr<SNotificationItem> Notification;
+};
@@ -0,0 +1,41 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UClass;
+class UDataAsset;
+struct FAssetData;
+
+// Remembers which CSV row an asset was last imported from, without having to load the asset to find out.
+// An import writes the row hash and the class schema into the package metadata; both are surfaced as hidden
+// Asset Registry tags, so a later import can compare the incoming row against FAssetData and skip the load.
+// Editing the asset by hand clears the stamp, so only assets that still hold exactly the imported row are skipped.
+class ASSETCSVSYNCEDITORPLUGIN_API FAssetCsvSyncSourceStamp
+{
+public:
+	static const FName RowHashTag;
+	static const FName SchemaTag;
+
+	// Hash of the imported cells as column=value pairs sorted by column, so column order, the key column and cells
+	// outside the import do not move it.
+	static FString HashRow(const TMap<FString, FString>& ColumnToValue);
+	// Same hash for a header and a value record imported whole. Empty when the cell counts differ.
+	static FString HashRow(const FString& HeaderRecord, const FString& ValueRecord);
+
+	// Fingerprint of the class's binding plan (UAssetCsvSyncCSVHandler::GetBindingPlan) and the write-back scope:
+	// changes whenever a column is added, removed, renamed or changes type. Cached per class. Game thread only.
+	static FString GetSchema(UClass* Class);
+
+	// True when the saved asset was imported from this exact row and has no unsaved edits. Never loads the asset.
+	static bool IsUpToDate(const FAssetData& AssetData, const FString& RowHash, const FString& Schema);
+
+	// Records the row on the asset without dirtying its package: call it for rows that changed or created the asset,
+	// so the stamp is saved with them. Restamping an unchanged asset would re-save it for nothing.
+	static void Stamp(UDataAsset* DataAsset, const FString& RowHash, const FString& Schema);
+	static void Clear(UObject* Object);
+
+	static void Register();
+	static void Unregister();
+};
@@ -32,6 +32,11 @@ public:
 		if (!Class)
 			return false;
 
+		// Blueprint classes follow their nearest native ancestor; class metadata does not carry over to them.
+		while (!Class->HasAnyClassFlags(CLASS_Native) && Class->GetSuperClass())
+		{
+			Class = Class->GetSuperClass();
+		}
 		return Class->HasMetaData(GetExportableMetaDataKey());
 	}
 
@@ -0,0 +1,24 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+using UnrealBuildTool;
+
+// Automation tests and the fixture classes they generate assets from, kept out of the plugin module itself.
+public class AssetCsvSyncEditorPluginTests : ModuleRules
+{
+	public AssetCsvSyncEditorPluginTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"DeveloperSettings",
+			"UnrealEd",
+			"AssetRegistry",
+			"Json",
+			"Projects",
+			"AssetCsvSyncEditorPlugin",
+		});
+	}
+}
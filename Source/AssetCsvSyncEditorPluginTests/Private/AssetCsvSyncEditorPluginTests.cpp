@@ -0,0 +1,5 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, AssetCsvSyncEditorPluginTests)
@@ -0,0 +1,276 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "UObject/SoftObjectPtr.h"
+#include "AssetCsvSyncPerfTestTypes.generated.h"
+
+// Fixture classes for the automation tests in AssetCsvSyncPerfTests.cpp. Each class has a fixed column layout;
+// the tests control the row count and container sizes per scenario. HideDropdown keeps them out of the panel.
+
+UENUM()
+enum class EAssetCsvSyncPerfQuality : uint8
+{
+	Common,
+	Rare,
+	Epic,
+	Legendary,
+};
+
+// Sixteen leaf columns of mixed types; the wide asset expands several of these.
+USTRUCT()
+struct FAssetCsvSyncPerfWideBlock
+{
+	GENERATED_BODY()
+
+	UPROPERTY(meta = (CsvColumn))
+	int32 Int32Value = 0;
+
+	UPROPERTY(meta = (CsvColumn))
+	int64 Int64Value = 0;
+
+	UPROPERTY(meta = (CsvColumn))
+	uint8 ByteValue = 0;
+
+	UPROPERTY(meta = (CsvColumn))
+	float FloatValue = 0.0f;
+
+	UPROPERTY(meta = (CsvColumn))
+	double DoubleValue = 0.0;
+
+	UPROPERTY(meta = (CsvColumn))
+	bool bFlag = false;
+
+	UPROPERTY(meta = (CsvColumn))
+	EAssetCsvSyncPerfQuality Quality = EAssetCsvSyncPerfQuality::Common;
+
+	UPROPERTY(meta = (CsvColumn))
+	FName Name;
+
+	UPROPERTY(meta = (CsvColumn))
+	FString Label;
+
+	UPROPERTY(meta = (CsvColumn))
+	FText DisplayName;
+
+	UPROPERTY(meta = (CsvColumn))
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY(meta = (CsvColumn))
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	UPROPERTY(meta = (CsvColumn))
+	FLinearColor Color = FLinearColor::Black;
+
+	UPROPERTY(meta = (CsvColumn))
+	FGuid Id;
+
+	UPROPERTY(meta = (CsvColumn))
+	FSoftObjectPath Path;
+
+	UPROPERTY(meta = (CsvColumn))
+	TArray<int32> Small;
+};
+
+UCLASS(HideDropdown, meta = (CsvExport))
+class UAssetCsvSyncPerfWideAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(meta = (CsvColumn))
+	int32 Level = 0;
+
+	UPROPERTY(meta = (CsvColumn))
+	FString Description;
+
+	UPROPERTY(meta = (CsvExpand))
+	FAssetCsvSyncPerfWideBlock Base;
+
+	UPROPERTY(meta = (CsvExpand))
+	FAssetCsvSyncPerfWideBlock Bonus;
+
+	UPROPERTY(meta = (CsvExpand))
+	FAssetCsvSyncPerfWideBlock Upgrade;
+
+	UPROPERTY(meta = (CsvExpand))
+	FAssetCsvSyncPerfWideBlock Cosmetic;
+};
+
+USTRUCT()
+struct FAssetCsvSyncPerfLeaf
+{
+	GENERATED_BODY()
+
+	UPROPERTY(meta = (CsvColumn))
+	int32 Value = 0;
+
+	UPROPERTY(meta = (CsvColumn))
+	float Scale = 0.0f;
+
+	UPROPERTY(meta = (CsvColumn))
+	FName Tag;
+};
+
+// Four levels of expanded structs, two branches per level.
+USTRUCT()
+struct FAssetCsvSyncPerfLevel3
+{
+	GENERATED_BODY()
+
+	UPROPERTY(meta = (CsvExpand))
+	FAssetCsvSyncPerfLeaf Left;
+
+	UPROPERTY(meta = (CsvExpand))
+	FAssetCsvSyncPerfLeaf Right;
+
+	UPROPERTY(meta = (CsvColumn))
+	FString Note;
+};
+
+USTRUCT()
+struct FAssetCsvSyncPerfLevel2
+{
+	GENERATED_BODY()
+
+	UPROPERTY(meta = (CsvExpand))
+	FAssetCsvSyncPerfLevel3 Left;
+
+	UPROPERTY(meta = (CsvExpand))
+	FAssetCsvSyncPerfLevel3 Right;
+
+	UPROPERTY(meta = (CsvColumn))
+	int32 Weight = 0;
+};
+
+USTRUCT()
+struct FAssetCsvSyncPerfLevel1
+{
+	GENERATED_BODY()
+
+	UPROPERTY(meta = (CsvExpand))
+	FAssetCsvSyncPerfLevel2 Left;
+
+	UPROPERTY(meta = (CsvExpand))
+	FAssetCsvSyncPerfLevel2 Right;
+
+	UPROPERTY(meta = (CsvColumn))
+	bool bEnabled = false;
+};
+
+UCLASS(HideDropdown, meta = (CsvExport))
+class UAssetCsvSyncPerfDeepAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(meta = (CsvExpand))
+	FAssetCsvSyncPerfLevel1 Primary;
+
+	UPROPERTY(meta = (CsvExpand))
+	FAssetCsvSyncPerfLevel1 Secondary;
+};
+
+UCLASS(HideDropdown, meta = (CsvExport))
+class UAssetCsvSyncPerfArrayAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(meta = (CsvColumn))
+	TArray<int32> Ints;
+
+	UPROPERTY(meta = (CsvColumn))
+	TArray<float> Floats;
+
+	UPROPERTY(meta = (CsvColumn))
+	TArray<FName> Names;
+
+	UPROPERTY(meta = (CsvColumn))
+	TArray<FString> Strings;
+
+	UPROPERTY(meta = (CsvColumn))
+	TArray<FVector> Vectors;
+
+	// Indexed columns, one set per element.
+	UPROPERTY(meta = (CsvExpand))
+	TArray<FAssetCsvSyncPerfLeaf> Entries;
+};
+
+UCLASS(HideDropdown, meta = (CsvExport))
+class UAssetCsvSyncPerfMapAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(meta = (CsvColumn))
+	TMap<FName, float> Weights;
+
+	UPROPERTY(meta = (CsvColumn))
+	TMap<FString, int32> Counts;
+
+	UPROPERTY(meta = (CsvColumn))
+	TMap<int32, FString> Labels;
+
+	UPROPERTY(meta = (CsvColumn))
+	TMap<FName, bool> Flags;
+};
+
+// Reference target; not exported itself.
+UCLASS(HideDropdown)
+class UAssetCsvSyncPerfTarget : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	int32 Value = 0;
+};
+
+UCLASS(HideDropdown, meta = (CsvExport))
+class UAssetCsvSyncPerfReferenceAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(meta = (CsvColumn))
+	TObjectPtr<UAssetCsvSyncPerfTarget> Primary;
+
+	UPROPERTY(meta = (CsvColumn))
+	TSoftObjectPtr<UAssetCsvSyncPerfTarget> Fallback;
+
+	UPROPERTY(meta = (CsvColumn))
+	TArray<TObjectPtr<UAssetCsvSyncPerfTarget>> Targets;
+
+	UPROPERTY(meta = (CsvColumn))
+	TArray<TSoftObjectPtr<UAssetCsvSyncPerfTarget>> SoftTargets;
+
+	UPROPERTY(meta = (CsvColumn))
+	TMap<FName, TSoftObjectPtr<UAssetCsvSyncPerfTarget>> Slots;
+};
+
+// Declares columns for UAssetCsvSyncPerfInheritedAsset, which only adds its own on top.
+UCLASS(HideDropdown, meta = (CsvExport))
+class UAssetCsvSyncPerfInheritedBaseAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(meta = (CsvColumn))
+	int32 BaseValue = 0;
+
+	UPROPERTY(meta = (CsvColumn))
+	TArray<FName> BaseTags;
+};
+
+UCLASS(HideDropdown, meta = (CsvExport))
+class UAssetCsvSyncPerfInheritedAsset : public UAssetCsvSyncPerfInheritedBaseAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(meta = (CsvColumn))
+	FString Label;
+};
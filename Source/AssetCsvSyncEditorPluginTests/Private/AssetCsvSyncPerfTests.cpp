@@ -0,0 +1,1062 @@
+// MIT Licensed. Copyright (c) 2026 Olga Taranova
+
+#include "AssetCsvSyncPerfTestTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AssetCsvSyncCSVHandler.h"
+#include "AssetCsvSyncDirectorySync.h"
+#include "AssetCsvSyncEditorPluginSettings.h"
+#include "AssetCsvSyncJobs.h"
+#include "AssetCsvSyncSourceStamp.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/MemoryBase.h"
+#include "Interfaces/IPluginManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+
+#include <atomic>
+
+// Export, import and round-trip tests over generated assets of controlled sizes, for every table backend, upserts,
+// shards, directory sync, source stamps and job cancellation. The AssetCsvSync.Perf.Table tests
+// (perf filter) also time each phase and count its allocations, and fail when either goes over its budget in
+// Config/AssetCsvSyncPerfBudgets.json or when the phase has no budget there. Run headless with
+//   UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests AssetCsvSync;Quit"
+// Command line options:
+//   -AssetCsvSyncPerfBudgets=<file>     read budgets from another file, e.g. one per build agent
+//   -AssetCsvSyncPerfTimeScale=<x>      multiply the time budgets, for slower machines
+//   -AssetCsvSyncPerfRecord             write the measurements with headroom to Saved/AssetCsvSync/PerfBudgets.json;
+//                                       missing budgets are not errors in a recording run
+
+static const int32 AssetCsvSync_PerfIterations = 3;
+static const double AssetCsvSync_RecordTimeHeadroom = 2.0;
+static const double AssetCsvSync_RecordAllocationHeadroom = 1.25;
+
+// Counts allocation calls while installed in place of GMalloc. Everything is forwarded to the allocator it
+// replaced, so blocks may be freed on either side of the swap. Counts every thread, not only the game thread.
+class FAssetCsvSyncCountingMalloc final : public FMalloc
+{
+public:
+	FMalloc* Inner = nullptr;
+	std::atomic<int64> Allocations{ 0 };
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		Allocations.fetch_add(1, std::memory_order_relaxed);
+		return Inner->Malloc(Count, Alignment);
+	}
+
+	virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+	{
+		Allocations.fetch_add(1, std::memory_order_relaxed);
+		return Inner->TryMalloc(Count, Alignment);
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0)
+			Allocations.fetch_add(1, std::memory_order_relaxed);
+		return Inner->Realloc(Original, Count, Alignment);
+	}
+
+	virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0)
+			Allocations.fetch_add(1, std::memory_order_relaxed);
+		return Inner->TryRealloc(Original, Count, Alignment);
+	}
+
+	virtual void Free(void* Original) override { Inner->Free(Original); }
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+	virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+	virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual void UpdateStats() override { Inner->UpdateStats(); }
+	virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+	virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+	virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+	virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+	virtual const TCHAR* GetDescriptiveName() override { return TEXT("AssetCsvSyncCounting"); }
+};
+
+// Never destroyed: another thread may still be inside a call when the proxy is uninstalled.
+static FAssetCsvSyncCountingMalloc AssetCsvSync_CountingMalloc;
+
+// Installs the counting proxy through GFixedMallocLocationPtr, the slot the crash handler swaps its allocator into.
+// Counts are INDEX_NONE when the platform does not expose the slot.
+struct FAssetCsvSyncAllocationCounter
+{
+	bool bInstalled = false;
+	int64 Count = INDEX_NONE;
+
+	FAssetCsvSyncAllocationCounter()
+	{
+		check(IsInGameThread());
+		if (!GFixedMallocLocationPtr || !*GFixedMallocLocationPtr || *GFixedMallocLocationPtr == &AssetCsvSync_CountingMalloc)
+			return;
+		AssetCsvSync_CountingMalloc.Inner = *GFixedMallocLocationPtr;
+		AssetCsvSync_CountingMalloc.Allocations = 0;
+		*GFixedMallocLocationPtr = &AssetCsvSync_CountingMalloc;
+		bInstalled = true;
+	}
+
+	~FAssetCsvSyncAllocationCounter()
+	{
+		Stop();
+	}
+
+	int64 Stop()
+	{
+		if (bInstalled)
+		{
+			*GFixedMallocLocationPtr = AssetCsvSync_CountingMalloc.Inner;
+			Count = AssetCsvSync_CountingMalloc.Allocations.load();
+			bInstalled = false;
+		}
+		return Count;
+	}
+};
+
+struct FAssetCsvSyncPerfSample
+{
+	double Milliseconds = 0.0;
+	int64 Allocations = INDEX_NONE;
+
+	// Best of several iterations: the least disturbed run is the one to compare against a budget.
+	void Keep(const FAssetCsvSyncPerfSample& Other, bool bFirst)
+	{
+		Milliseconds = bFirst ? Other.Milliseconds : FMath::Min(Milliseconds, Other.Milliseconds);
+		Allocations = bFirst || Allocations == INDEX_NONE ? Other.Allocations : FMath::Min(Allocations, Other.Allocations);
+	}
+};
+
+static bool AssetCsvSync_Measure(TFunctionRef<bool()> Function, FAssetCsvSyncPerfSample& OutSample)
+{
+	FAssetCsvSyncAllocationCounter Counter;
+	const double Start = FPlatformTime::Seconds();
+	const bool bResult = Function();
+	OutSample.Milliseconds = (FPlatformTime::Seconds() - Start) * 1000.0;
+	OutSample.Allocations = Counter.Stop();
+	return bResult;
+}
+
+// Budgets file: { "version": 1, "scenarios": { "<Scenario>": { "<phase>": { "milliseconds": .., "allocations": .. } } } }
+static const int32 AssetCsvSync_PerfBudgetsVersion = 1;
+
+struct FAssetCsvSyncPerfBudget
+{
+	double Milliseconds = 0.0;
+	int64 Allocations = 0;
+};
+
+static FString AssetCsvSync_GetPerfBudgetsPath()
+{
+	FString Path;
+	if (FParse::Value(FCommandLine::Get(), TEXT("AssetCsvSyncPerfBudgets="), Path))
+		return Path;
+	TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("AssetCsvSyncEditorPlugin"));
+	return Plugin.IsValid() ? Plugin->GetBaseDir() / TEXT("Config/AssetCsvSyncPerfBudgets.json") : FString();
+}
+
+static FString AssetCsvSync_GetPerfRecordPath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("AssetCsvSync/PerfBudgets.json");
+}
+
+static TSharedPtr<FJsonObject> AssetCsvSync_LoadPerfBudgets(const FString& Path)
+{
+	FString Text;
+	TSharedPtr<FJsonObject> Root;
+	if (Path.IsEmpty() || !FFileHelper::LoadFileToString(Text, *Path))
+		return nullptr;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), Root) || !Root.IsValid())
+		return nullptr;
+	int32 Version = 0;
+	if (!Root->TryGetNumberField(TEXT("version"), Version) || Version != AssetCsvSync_PerfBudgetsVersion)
+		return nullptr;
+	return Root;
+}
+
+static bool AssetCsvSync_FindPerfBudget(const TSharedPtr<FJsonObject>& Budgets, const FString& Scenario, const FString& Phase, FAssetCsvSyncPerfBudget& OutBudget)
+{
+	const TSharedPtr<FJsonObject>* Scenarios = nullptr;
+	const TSharedPtr<FJsonObject>* Phases = nullptr;
+	const TSharedPtr<FJsonObject>* Budget = nullptr;
+	if (!Budgets.IsValid() || !Budgets->TryGetObjectField(TEXT("scenarios"), Scenarios)
+		|| !(*Scenarios)->TryGetObjectField(Scenario, Phases) || !(*Phases)->TryGetObjectField(Phase, Budget))
+		return false;
+
+	double Allocations = 0.0;
+	if (!(*Budget)->TryGetNumberField(TEXT("milliseconds"), OutBudget.Milliseconds) || !(*Budget)->TryGetNumberField(TEXT("allocations"), Allocations))
+		return false;
+	OutBudget.Allocations = static_cast<int64>(Allocations);
+	return OutBudget.Milliseconds > 0.0 && OutBudget.Allocations > 0;
+}
+
+// Merges one measurement into the record file, so a full run leaves a complete budgets file to review and copy.
+static void AssetCsvSync_RecordPerfSample(const FString& Scenario, const FString& Phase, const FAssetCsvSyncPerfSample& Sample)
+{
+	const FString Path = AssetCsvSync_GetPerfRecordPath();
+	TSharedPtr<FJsonObject> Root = AssetCsvSync_LoadPerfBudgets(Path);
+	if (!Root.IsValid())
+	{
+		Root = MakeShared<FJsonObject>();
+		Root->SetNumberField(TEXT("version"), AssetCsvSync_PerfBudgetsVersion);
+	}
+
+	const TSharedPtr<FJsonObject>* Found = nullptr;
+	TSharedPtr<FJsonObject> Scenarios = Root->TryGetObjectField(TEXT("scenarios"), Found) ? *Found : MakeShared<FJsonObject>();
+	TSharedPtr<FJsonObject> Phases = Scenarios->TryGetObjectField(Scenario, Found) ? *Found : MakeShared<FJsonObject>();
+
+	TSharedPtr<FJsonObject> Budget = MakeShared<FJsonObject>();
+	Budget->SetNumberField(TEXT("milliseconds"), FMath::CeilToDouble(Sample.Milliseconds * AssetCsvSync_RecordTimeHeadroom));
+	Budget->SetNumberField(TEXT("allocations"), Sample.Allocations == INDEX_NONE ? 0.0 : FMath::CeilToDouble(Sample.Allocations * AssetCsvSync_RecordAllocationHeadroom));
+	Phases->SetObjectField(Phase, Budget);
+	Scenarios->SetObjectField(Scenario, Phases);
+	Root->SetObjectField(TEXT("scenarios"), Scenarios);
+
+	FString Text;
+	FJsonSerializer::Serialize(Root.ToSharedRef(), TJsonWriterFactory<>::Create(&Text));
+	FFileHelper::SaveStringToFile(Text, *Path);
+}
+
+static void AssetCsvSync_CheckPerfBudget(FAutomationTestBase& Test, const FString& Scenario, const FString& Phase, const FAssetCsvSyncPerfSample& Sample)
+{
+	Test.AddInfo(FString::Printf(TEXT("%s %s: %.2f ms, %lld allocations"), *Scenario, *Phase, Sample.Milliseconds, Sample.Allocations));
+	const bool bRecording = FParse::Param(FCommandLine::Get(), TEXT("AssetCsvSyncPerfRecord"));
+	if (bRecording)
+	{
+		AssetCsvSync_RecordPerfSample(Scenario, Phase, Sample);
+	}
+
+	// An unbudgeted phase would let any regression through, so it fails unless this run is recording budgets.
+	FAssetCsvSyncPerfBudget Budget;
+	if (!AssetCsvSync_FindPerfBudget(AssetCsvSync_LoadPerfBudgets(AssetCsvSync_GetPerfBudgetsPath()), Scenario, Phase, Budget))
+	{
+		const FString Message = FString::Printf(TEXT("%s %s: no budget in %s; record one with -AssetCsvSyncPerfRecord"), *Scenario, *Phase, *AssetCsvSync_GetPerfBudgetsPath());
+		if (bRecording)
+		{
+			Test.AddInfo(Message);
+		}
+		else
+		{
+			Test.AddError(Message);
+		}
+		return;
+	}
+
+	double TimeScale = 1.0;
+	FParse::Value(FCommandLine::Get(), TEXT("AssetCsvSyncPerfTimeScale="), TimeScale);
+	if (Sample.Milliseconds > Budget.Milliseconds * TimeScale)
+	{
+		Test.AddError(FString::Printf(TEXT("%s %s took %.2f ms, budget %.2f ms"), *Scenario, *Phase, Sample.Milliseconds, Budget.Milliseconds * TimeScale));
+	}
+	if (Sample.Allocations == INDEX_NONE)
+	{
+		Test.AddWarning(FString::Printf(TEXT("%s %s: allocation counting is not available on this platform"), *Scenario, *Phase));
+	}
+	else if (Sample.Allocations > Budget.Allocations)
+	{
+		Test.AddError(FString::Printf(TEXT("%s %s made %lld allocations, budget %lld"), *Scenario, *Phase, Sample.Allocations, Budget.Allocations));
+	}
+}
+
+// Values are whole numbers or quarter steps, so they survive the decimal text of float columns unchanged.
+static float AssetCsvSync_RandomQuarter(FRandomStream& Random, int32 Range)
+{
+	return Random.RandRange(-Range, Range) * 0.25f;
+}
+
+static void AssetCsvSync_FillWideBlock(FAssetCsvSyncPerfWideBlock& Block, FRandomStream& Random, int32 Index)
+{
+	Block.Int32Value = Random.RandRange(-100000, 100000);
+	Block.Int64Value = static_cast<int64>(Random.RandRange(0, MAX_int32)) * 4096;
+	Block.ByteValue = static_cast<uint8>(Random.RandRange(0, 255));
+	Block.FloatValue = AssetCsvSync_RandomQuarter(Random, 4000);
+	Block.DoubleValue = AssetCsvSync_RandomQuarter(Random, 400000);
+	Block.bFlag = Random.RandRange(0, 1) == 1;
+	Block.Quality = static_cast<EAssetCsvSyncPerfQuality>(Random.RandRange(0, 3));
+	Block.Name = FName(TEXT("Item"), Random.RandRange(1, 999));
+	Block.Label = FString::Printf(TEXT("Label, \"%d\""), Index);
+	Block.DisplayName = FText::FromString(FString::Printf(TEXT("Display %d"), Index));
+	Block.Location = FVector(Random.RandRange(-512, 512), Random.RandRange(-512, 512), Random.RandRange(0, 64));
+	Block.Rotation = FRotator(Random.RandRange(-90, 90), Random.RandRange(-180, 180), 0.0);
+	Block.Color = FLinearColor(Random.RandRange(0, 4) * 0.25f, Random.RandRange(0, 4) * 0.25f, Random.RandRange(0, 4) * 0.25f, 1.0f);
+	Block.Id = FGuid(Random.GetUnsignedInt(), Random.GetUnsignedInt(), Random.GetUnsignedInt(), Random.GetUnsignedInt());
+	Block.Path = FSoftObjectPath(FString::Printf(TEXT("/Game/Data/Items/DA_Item_%d.DA_Item_%d"), Index, Index));
+	Block.Small = { Random.RandRange(0, 9), Random.RandRange(0, 9), Random.RandRange(0, 9) };
+}
+
+static void AssetCsvSync_FillWide(UDataAsset* DataAsset, FRandomStream& Random, int32 ContainerSize, const TArray<UAssetCsvSyncPerfTarget*>& Targets)
+{
+	UAssetCsvSyncPerfWideAsset* Asset = CastChecked<UAssetCsvSyncPerfWideAsset>(DataAsset);
+	Asset->Level = Random.RandRange(1, 60);
+	Asset->Description = FString::Printf(TEXT("Generated row %d\nwith a line break"), Random.RandRange(0, 100000));
+	AssetCsvSync_FillWideBlock(Asset->Base, Random, 0);
+	AssetCsvSync_FillWideBlock(Asset->Bonus, Random, 1);
+	AssetCsvSync_FillWideBlock(Asset->Upgrade, Random, 2);
+	AssetCsvSync_FillWideBlock(Asset->Cosmetic, Random, 3);
+}
+
+static void AssetCsvSync_FillLeaf(FAssetCsvSyncPerfLeaf& Leaf, FRandomStream& Random)
+{
+	Leaf.Value = Random.RandRange(-1000, 1000);
+	Leaf.Scale = AssetCsvSync_RandomQuarter(Random, 400);
+	Leaf.Tag = FName(TEXT("Tag"), Random.RandRange(1, 99));
+}
+
+static void AssetCsvSync_FillLevel3(FAssetCsvSyncPerfLevel3& Level, FRandomStream& Random)
+{
+	AssetCsvSync_FillLeaf(Level.Left, Random);
+	AssetCsvSync_FillLeaf(Level.Right, Random);
+	Level.Note = FString::Printf(TEXT("Note %d"), Random.RandRange(0, 1000));
+}
+
+static void AssetCsvSync_FillLevel2(FAssetCsvSyncPerfLevel2& Level, FRandomStream& Random)
+{
+	AssetCsvSync_FillLevel3(Level.Left, Random);
+	AssetCsvSync_FillLevel3(Level.Right, Random);
+	Level.Weight = Random.RandRange(0, 100);
+}
+
+static void AssetCsvSync_FillLevel1(FAssetCsvSyncPerfLevel1& Level, FRandomStream& Random)
+{
+	AssetCsvSync_FillLevel2(Level.Left, Random);
+	AssetCsvSync_FillLevel2(Level.Right, Random);
+	Level.bEnabled = Random.RandRange(0, 1) == 1;
+}
+
+static void AssetCsvSync_FillDeep(UDataAsset* DataAsset, FRandomStream& Random, int32 ContainerSize, const TArray<UAssetCsvSyncPerfTarget*>& Targets)
+{
+	UAssetCsvSyncPerfDeepAsset* Asset = CastChecked<UAssetCsvSyncPerfDeepAsset>(DataAsset);
+	AssetCsvSync_FillLevel1(Asset->Primary, Random);
+	AssetCsvSync_FillLevel1(Asset->Secondary, Random);
+}
+
+static void AssetCsvSync_FillArrays(UDataAsset* DataAsset, FRandomStream& Random, int32 ContainerSize, const TArray<UAssetCsvSyncPerfTarget*>& Targets)
+{
+	UAssetCsvSyncPerfArrayAsset* Asset = CastChecked<UAssetCsvSyncPerfArrayAsset>(DataAsset);
+	for (int32 Index = 0; Index < ContainerSize; ++Index)
+	{
+		Asset->Ints.Add(Random.RandRange(MIN_int32 / 2, MAX_int32 / 2));
+		Asset->Floats.Add(AssetCsvSync_RandomQuarter(Random, 40000));
+		Asset->Names.Add(FName(TEXT("Entry"), Index + 1));
+		// Every eighth item needs quoting inside the list cell.
+		Asset->Strings.Add(Index % 8 == 0 ? FString::Printf(TEXT("a;b \"%d\""), Index) : FString::Printf(TEXT("Item %d"), Index));
+		if (Index % 4 == 0)
+		{
+			Asset->Vectors.Add(FVector(Random.RandRange(-512, 512), Random.RandRange(-512, 512), Random.RandRange(-512, 512)));
+		}
+	}
+	for (int32 Index = 0; Index < FMath::Min(ContainerSize / 32, 32); ++Index)
+	{
+		AssetCsvSync_FillLeaf(Asset->Entries.AddDefaulted_GetRef(), Random);
+	}
+}
+
+static void AssetCsvSync_FillMaps(UDataAsset* DataAsset, FRandomStream& Random, int32 ContainerSize, const TArray<UAssetCsvSyncPerfTarget*>& Targets)
+{
+	UAssetCsvSyncPerfMapAsset* Asset = CastChecked<UAssetCsvSyncPerfMapAsset>(DataAsset);
+	for (int32 Index = 0; Index < ContainerSize; ++Index)
+	{
+		Asset->Weights.Add(FName(TEXT("Stat"), Index + 1), AssetCsvSync_RandomQuarter(Random, 4000));
+		Asset->Counts.Add(FString::Printf(TEXT("Key \"%d\""), Index), Random.RandRange(-100000, 100000));
+		Asset->Labels.Add(Index * 7, FString::Printf(TEXT("Label %d\t%d"), Index, Random.RandRange(0, 1000)));
+		Asset->Flags.Add(FName(TEXT("Flag"), Index + 1), Random.RandRange(0, 1) == 1);
+	}
+}
+
+static void AssetCsvSync_FillReferences(UDataAsset* DataAsset, FRandomStream& Random, int32 ContainerSize, const TArray<UAssetCsvSyncPerfTarget*>& Targets)
+{
+	UAssetCsvSyncPerfReferenceAsset* Asset = CastChecked<UAssetCsvSyncPerfReferenceAsset>(DataAsset);
+	auto PickTarget = [&Random, &Targets]() { return Targets[Random.RandRange(0, Targets.Num() - 1)]; };
+	Asset->Primary = PickTarget();
+	Asset->Fallback = PickTarget();
+	for (int32 Index = 0; Index < ContainerSize; ++Index)
+	{
+		Asset->Targets.Add(PickTarget());
+		Asset->SoftTargets.Add(PickTarget());
+	}
+	for (int32 Index = 0; Index < FMath::Min(ContainerSize / 4, 16); ++Index)
+	{
+		Asset->Slots.Add(FName(TEXT("Slot"), Index + 1), PickTarget());
+	}
+}
+
+static void AssetCsvSync_FillInherited(UDataAsset* DataAsset, FRandomStream& Random, int32 ContainerSize, const TArray<UAssetCsvSyncPerfTarget*>& Targets)
+{
+	UAssetCsvSyncPerfInheritedAsset* Asset = CastChecked<UAssetCsvSyncPerfInheritedAsset>(DataAsset);
+	Asset->BaseValue = Random.RandRange(1, 100000);
+	Asset->BaseTags = { FName(TEXT("Tag"), Random.RandRange(1, 99)), FName(TEXT("Tag"), Random.RandRange(100, 199)) };
+	Asset->Label = FString::Printf(TEXT("Derived %d"), Random.RandRange(0, 1000));
+}
+
+struct FAssetCsvSyncPerfScenario
+{
+	const TCHAR* Name;
+	UClass* (*GetClass)();
+	int32 NumAssets;
+	int32 ContainerSize;
+	int32 NumTargets;
+	void (*Fill)(UDataAsset* DataAsset, FRandomStream& Random, int32 ContainerSize, const TArray<UAssetCsvSyncPerfTarget*>& Targets);
+};
+
+// Budgets in Config/AssetCsvSyncPerfBudgets.json are per scenario; re-record them when these sizes change.
+static const FAssetCsvSyncPerfScenario AssetCsvSync_PerfScenarios[] = {
+	{ TEXT("Wide"), &UAssetCsvSyncPerfWideAsset::StaticClass, 200, 0, 0, &AssetCsvSync_FillWide },
+	{ TEXT("Deep"), &UAssetCsvSyncPerfDeepAsset::StaticClass, 200, 0, 0, &AssetCsvSync_FillDeep },
+	{ TEXT("LargeArrays"), &UAssetCsvSyncPerfArrayAsset::StaticClass, 50, 1000, 0, &AssetCsvSync_FillArrays },
+	{ TEXT("LargeMaps"), &UAssetCsvSyncPerfMapAsset::StaticClass, 50, 500, 0, &AssetCsvSync_FillMaps },
+	{ TEXT("ManyReferences"), &UAssetCsvSyncPerfReferenceAsset::StaticClass, 100, 64, 256, &AssetCsvSync_FillReferences },
+};
+
+// Not a perf scenario; used by the inherited columns test only.
+static const FAssetCsvSyncPerfScenario AssetCsvSync_InheritedScenario = { TEXT("Inherited"), &UAssetCsvSyncPerfInheritedAsset::StaticClass, 1, 0, 0, &AssetCsvSync_FillInherited };
+
+static const TCHAR* AssetCsvSync_PerfPhases[] = { TEXT("export"), TEXT("import") };
+
+static const FAssetCsvSyncPerfScenario* AssetCsvSync_FindPerfScenario(const FString& Name)
+{
+	for (const FAssetCsvSyncPerfScenario& Scenario : AssetCsvSync_PerfScenarios)
+	{
+		if (Name == Scenario.Name)
+			return &Scenario;
+	}
+	return nullptr;
+}
+
+// Creates the assets of one scenario, unsaved, in a content folder and a scratch directory unique to the fixture,
+// and removes all of it again when destroyed, including packages a test saved into the folder.
+struct FAssetCsvSyncPerfFixture
+{
+	FString Folder;
+	FString Directory;
+	TArray<UDataAsset*> Assets;
+	TArray<UAssetCsvSyncPerfTarget*> Targets;
+
+	FAssetCsvSyncPerfFixture()
+	{
+		const FString RunId = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+		Folder = TEXT("/Game/AssetCsvSyncTests/") + RunId;
+		Directory = FPaths::AutomationTransientDir() / TEXT("AssetCsvSync") / RunId;
+	}
+
+	~FAssetCsvSyncPerfFixture()
+	{
+		TArray<UObject*> Objects(Assets);
+		Objects.Append(Targets);
+		for (UObject* Object : Objects)
+		{
+			FAssetRegistryModule::AssetDeleted(Object);
+			Object->ClearFlags(RF_Public | RF_Standalone);
+			Object->MarkAsGarbage();
+			Object->GetPackage()->MarkAsGarbage();
+		}
+		IFileManager::Get().DeleteDirectory(*Directory, false, true);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		IFileManager::Get().DeleteDirectory(*FPackageName::LongPackageNameToFilename(Folder), false, true);
+	}
+
+	bool Create(FAutomationTestBase& Test, const FAssetCsvSyncPerfScenario& Scenario, int32 NumAssets)
+	{
+		for (int32 Index = 0; Index < Scenario.NumTargets; ++Index)
+		{
+			const FString AssetName = FString::Printf(TEXT("Target_%04d"), Index);
+			UPackage* Package = CreatePackage(*(Folder / TEXT("Targets") / AssetName));
+			UAssetCsvSyncPerfTarget* Target = NewObject<UAssetCsvSyncPerfTarget>(Package, *AssetName, RF_Public | RF_Standalone);
+			Target->Value = Index;
+			FAssetRegistryModule::AssetCreated(Target);
+			Targets.Add(Target);
+		}
+
+		for (int32 Index = 0; Index < NumAssets; ++Index)
+		{
+			UDataAsset* Asset = nullptr;
+			const FString AssetPath = Folder / Scenario.Name / FString::Printf(TEXT("%s_%04d"), Scenario.Name, Index);
+			if (!UAssetCsvSyncCSVHandler::CreateNewDataAssetAsset(AssetPath, Scenario.GetClass(), Asset, false))
+			{
+				Test.AddError(FString::Printf(TEXT("Could not create %s"), *AssetPath));
+				return false;
+			}
+			FRandomStream Random(Index + 1);
+			Scenario.Fill(Asset, Random, Scenario.ContainerSize, Targets);
+			Assets.Add(Asset);
+		}
+		return true;
+	}
+
+	// Puts every exported property back to the class default and drops the source stamp, so the import has to write
+	// each row again.
+	void ResetToDefaults()
+	{
+		for (UDataAsset* Asset : Assets)
+		{
+			const UObject* Defaults = Asset->GetClass()->GetDefaultObject();
+			for (TFieldIterator<FProperty> It(Asset->GetClass()); It; ++It)
+			{
+				It->CopyCompleteValue_InContainer(Asset, Defaults);
+			}
+			FAssetCsvSyncSourceStamp::Clear(Asset);
+		}
+	}
+};
+
+// Reports the first differing line, rather than two whole tables.
+static bool AssetCsvSync_TestSameFile(FAutomationTestBase& Test, const FString& ExpectedPath, const FString& ActualPath)
+{
+	TArray<FString> Expected;
+	TArray<FString> Actual;
+	if (!FFileHelper::LoadFileToStringArray(Expected, *ExpectedPath) || !FFileHelper::LoadFileToStringArray(Actual, *ActualPath))
+	{
+		Test.AddError(FString::Printf(TEXT("Could not read %s or %s"), *ExpectedPath, *ActualPath));
+		return false;
+	}
+	for (int32 Line = 0; Line < FMath::Min(Expected.Num(), Actual.Num()); ++Line)
+	{
+		if (!Expected[Line].Equals(Actual[Line], ESearchCase::CaseSensitive))
+		{
+			Test.AddError(FString::Printf(TEXT("Round trip differs at line %d:\n  before: %s\n  after:  %s"), Line + 1, *Expected[Line].Left(512), *Actual[Line].Left(512)));
+			return false;
+		}
+	}
+	return Test.TestEqual(TEXT("Round trip line count"), Actual.Num(), Expected.Num());
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FAssetCsvSyncPerfTableTest, "AssetCsvSync.Perf.Table", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FAssetCsvSyncPerfTableTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const FAssetCsvSyncPerfScenario& Scenario : AssetCsvSync_PerfScenarios)
+	{
+		OutBeautifiedNames.Add(Scenario.Name);
+		OutTestCommands.Add(Scenario.Name);
+	}
+}
+
+// Exports the scenario's assets to a table, resets them, imports the table back and checks that the imported assets
+// export to the same table. Each phase keeps its best of AssetCsvSync_PerfIterations runs for the budget check.
+bool FAssetCsvSyncPerfTableTest::RunTest(const FString& Parameters)
+{
+	const FAssetCsvSyncPerfScenario* Scenario = AssetCsvSync_FindPerfScenario(Parameters);
+	if (!TestNotNull(TEXT("Scenario"), Scenario))
+		return false;
+
+	FAssetCsvSyncPerfFixture Fixture;
+	if (!Fixture.Create(*this, *Scenario, Scenario->NumAssets))
+		return false;
+
+	const FString TablePath = Fixture.Directory / TEXT("Table.csv");
+	const FString CheckPath = Fixture.Directory / TEXT("Check.csv");
+	const TArray<FString> AllColumns;
+
+	// Binding plans and schema fingerprints are built once per class and session; keep them out of the samples.
+	if (!TestTrue(TEXT("Warm-up export"), UAssetCsvSyncCSVHandler::ExportDataAssetsToCSVTable(Fixture.Assets, CheckPath, AllColumns)))
+		return false;
+
+	FAssetCsvSyncPerfSample Export;
+	FAssetCsvSyncPerfSample Import;
+	for (int32 Iteration = 0; Iteration < AssetCsvSync_PerfIterations; ++Iteration)
+	{
+		FAssetCsvSyncPerfSample Sample;
+		const bool bExported = AssetCsvSync_Measure([&Fixture, &TablePath, &AllColumns]()
+		{
+			return UAssetCsvSyncCSVHandler::ExportDataAssetsToCSVTable(Fixture.Assets, TablePath, AllColumns);
+		}, Sample);
+		if (!TestTrue(TEXT("Export"), bExported))
+			return false;
+		Export.Keep(Sample, Iteration == 0);
+
+		Fixture.ResetToDefaults();
+		FAssetCsvSyncTableImportResult Result;
+		const bool bImported = AssetCsvSync_Measure([&Fixture, &TablePath, &AllColumns, &Result, Scenario]()
+		{
+			return UAssetCsvSyncCSVHandler::ImportCSVTableToDataAssets(TablePath, Scenario->GetClass(), Fixture.Folder, AllColumns, false, Result);
+		}, Sample);
+		if (!TestTrue(TEXT("Import"), bImported))
+			return false;
+		Import.Keep(Sample, Iteration == 0);
+
+		TestEqual(TEXT("Imported rows"), Result.Rows, Scenario->NumAssets);
+		TestEqual(TEXT("Changed assets"), Result.AssetsChanged, Scenario->NumAssets);
+		TestEqual(TEXT("Created assets"), Result.AssetsCreated, 0);
+
+		if (!TestTrue(TEXT("Round trip export"), UAssetCsvSyncCSVHandler::ExportDataAssetsToCSVTable(Fixture.Assets, CheckPath, AllColumns))
+			|| !AssetCsvSync_TestSameFile(*this, TablePath, CheckPath))
+			return false;
+	}
+
+	AssetCsvSync_CheckPerfBudget(*this, Scenario->Name, AssetCsvSync_PerfPhases[0], Export);
+	AssetCsvSync_CheckPerfBudget(*this, Scenario->Name, AssetCsvSync_PerfPhases[1], Import);
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FAssetCsvSyncRoundTripTest, "AssetCsvSync.RoundTrip.SingleAsset", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+void FAssetCsvSyncRoundTripTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const FAssetCsvSyncPerfScenario& Scenario : AssetCsvSync_PerfScenarios)
+	{
+		OutBeautifiedNames.Add(Scenario.Name);
+		OutTestCommands.Add(Scenario.Name);
+	}
+}
+
+// The single-row path: ExportDataAssetToCSV, then an in-place import into the reset asset.
+bool FAssetCsvSyncRoundTripTest::RunTest(const FString& Parameters)
+{
+	const FAssetCsvSyncPerfScenario* Scenario = AssetCsvSync_FindPerfScenario(Parameters);
+	if (!TestNotNull(TEXT("Scenario"), Scenario))
+		return false;
+
+	FAssetCsvSyncPerfFixture Fixture;
+	if (!Fixture.Create(*this, *Scenario, 1))
+		return false;
+
+	UDataAsset* Asset = Fixture.Assets[0];
+	const FString RowPath = Fixture.Directory / TEXT("Row.csv");
+	const FString CheckPath = Fixture.Directory / TEXT("Check.csv");
+	if (!TestTrue(TEXT("Export"), UAssetCsvSyncCSVHandler::ExportDataAssetToCSV(Asset, RowPath)))
+		return false;
+
+	Fixture.ResetToDefaults();
+	FAssetCsvSyncImportResult Result;
+	if (!TestTrue(TEXT("Import"), UAssetCsvSyncCSVHandler::ImportCSVToDataAssetInPlaceWithResult(RowPath, Asset, TArray<FString>(), false, Result)))
+		return false;
+	TestTrue(TEXT("Changed columns"), Result.ChangedColumns > 0);
+
+	return TestTrue(TEXT("Round trip export"), UAssetCsvSyncCSVHandler::ExportDataAssetToCSV(Asset, CheckPath))
+		&& AssetCsvSync_TestSameFile(*this, RowPath, CheckPath);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAssetCsvSyncInheritedColumnsTest, "AssetCsvSync.RoundTrip.InheritedColumns", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+// Columns a superclass declares are exported and imported along with the subclass's own.
+bool FAssetCsvSyncInheritedColumnsTest::RunTest(const FString& Parameters)
+{
+	FAssetCsvSyncPerfFixture Fixture;
+	if (!Fixture.Create(*this, AssetCsvSync_InheritedScenario, 1))
+		return false;
+
+	UAssetCsvSyncPerfInheritedAsset* Asset = CastChecked<UAssetCsvSyncPerfInheritedAsset>(Fixture.Assets[0]);
+	const int32 BaseValue = Asset->BaseValue;
+	const TArray<FName> BaseTags = Asset->BaseTags;
+	const FString Label = Asset->Label;
+
+	const FString RowPath = Fixture.Directory / TEXT("Row.csv");
+	TArray<FString> Columns;
+	if (!TestTrue(TEXT("Export"), UAssetCsvSyncCSVHandler::ExportDataAssetToCSV(Asset, RowPath))
+		|| !TestTrue(TEXT("Read header"), UAssetCsvSyncCSVHandler::GetCSVHeaderColumns(RowPath, Columns)))
+		return false;
+	TestTrue(TEXT("Inherited column BaseValue exported"), Columns.Contains(TEXT("BaseValue")));
+	TestTrue(TEXT("Inherited column BaseTags exported"), Columns.Contains(TEXT("BaseTags")));
+	TestTrue(TEXT("Own column Label exported"), Columns.Contains(TEXT("Label")));
+
+	Fixture.ResetToDefaults();
+	FAssetCsvSyncImportResult Result;
+	if (!TestTrue(TEXT("Import"), UAssetCsvSyncCSVHandler::ImportCSVToDataAssetInPlaceWithResult(RowPath, Asset, TArray<FString>(), false, Result)))
+		return false;
+	TestEqual(TEXT("Inherited BaseValue"), Asset->BaseValue, BaseValue);
+	TestTrue(TEXT("Inherited BaseTags"), Asset->BaseTags == BaseTags);
+	TestEqual(TEXT("Own Label"), Asset->Label, Label);
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAssetCsvSyncMemoryBudgetTest, "AssetCsvSync.Memory.ReleasesSavedPackages", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+// With undo enabled and a budget every process exceeds, a saving table import has to release the packages it
+// created and changed after each batch, so only the last batch can still be loaded when it returns.
+bool FAssetCsvSyncMemoryBudgetTest::RunTest(const FString& Parameters)
+{
+	const FAssetCsvSyncPerfScenario& Scenario = AssetCsvSync_PerfScenarios[0];
+	const int32 LastBatchRows = 64;
+
+	FAssetCsvSyncPerfFixture Fixture;
+	if (!Fixture.Create(*this, Scenario, Scenario.NumAssets))
+		return false;
+
+	// The rows are imported as new assets in their own folder, which makes them packages the import loaded itself.
+	const FString TablePath = Fixture.Directory / TEXT("Table.csv");
+	const FString SourceFolder = Fixture.Folder / Scenario.Name + TEXT("/");
+	const FString ImportFolder = Fixture.Folder / TEXT("Imported/");
+	FString Table;
+	if (!TestTrue(TEXT("Export"), UAssetCsvSyncCSVHandler::ExportDataAssetsToCSVTable(Fixture.Assets, TablePath, TArray<FString>()))
+		|| !TestTrue(TEXT("Read table"), FFileHelper::LoadFileToString(Table, *TablePath)))
+		return false;
+	Table.ReplaceInline(*SourceFolder, *ImportFolder, ESearchCase::CaseSensitive);
+	FFileHelper::SaveStringToFile(Table, *TablePath);
+
+	UAssetCsvSyncEditorPluginSettings* Settings = GetMutableDefault<UAssetCsvSyncEditorPluginSettings>();
+	const bool bRecordImportUndo = Settings->bRecordImportUndo;
+	const int32 MemoryBudgetMB = Settings->MemoryBudgetMB;
+	Settings->bRecordImportUndo = true;
+	Settings->MemoryBudgetMB = 1;
+	ON_SCOPE_EXIT
+	{
+		Settings->bRecordImportUndo = bRecordImportUndo;
+		Settings->MemoryBudgetMB = MemoryBudgetMB;
+	};
+
+	FAssetCsvSyncTableImportResult Result;
+	TestTrue(TEXT("Import"), UAssetCsvSyncCSVHandler::ImportCSVTableToDataAssets(TablePath, Scenario.GetClass(), Fixture.Folder, TArray<FString>(), true, Result));
+	TestEqual(TEXT("Created assets"), Result.AssetsCreated, Scenario.NumAssets);
+	TestEqual(TEXT("Saved packages"), Result.PackagesSaved, Scenario.NumAssets);
+	TestTrue(TEXT("Garbage collections"), Result.GarbageCollections > 0);
+
+	int32 StillLoaded = 0;
+	for (UDataAsset* Asset : TArray<UDataAsset*>(Fixture.Assets))
+	{
+		const FString ImportedPath = Asset->GetPathName().Replace(*SourceFolder, *ImportFolder, ESearchCase::CaseSensitive);
+		if (UDataAsset* Imported = FindObject<UDataAsset>(nullptr, *ImportedPath))
+		{
+			++StillLoaded;
+			Fixture.Assets.Add(Imported);
+		}
+	}
+	if (StillLoaded > LastBatchRows)
+	{
+		AddError(FString::Printf(TEXT("%d of %d imported assets are still loaded, expected at most the last batch of %d"), StillLoaded, Scenario.NumAssets, LastBatchRows));
+	}
+	return !HasAnyErrors();
+}
+
+// Table backends, picked by the table's extension.
+struct FAssetCsvSyncTableBackend
+{
+	const TCHAR* Name;
+	const TCHAR* Extension;
+};
+
+static const FAssetCsvSyncTableBackend AssetCsvSync_TableBackends[] = {
+	{ TEXT("JsonLines"), TEXT(".jsonl") },
+	{ TEXT("Binary"), TEXT(".acsb") },
+	{ TEXT("Sqlite"), TEXT(".db") },
+};
+
+// Enough rows for several import batches without making the functional tests slow.
+static const int32 AssetCsvSync_FunctionalRows = 16;
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FAssetCsvSyncBackendRoundTripTest, "AssetCsvSync.RoundTrip.Backend", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+void FAssetCsvSyncBackendRoundTripTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const FAssetCsvSyncTableBackend& Backend : AssetCsvSync_TableBackends)
+	{
+		for (const FAssetCsvSyncPerfScenario& Scenario : AssetCsvSync_PerfScenarios)
+		{
+			OutBeautifiedNames.Add(FString::Printf(TEXT("%s.%s"), Backend.Name, Scenario.Name));
+			OutTestCommands.Add(FString::Printf(TEXT("%s %s"), Backend.Name, Scenario.Name));
+		}
+	}
+}
+
+// Exports the assets to the backend, resets them and imports them back. The CSV table before and after has to match,
+// so every backend is held to the same values as the CSV round trip.
+bool FAssetCsvSyncBackendRoundTripTest::RunTest(const FString& Parameters)
+{
+	FString BackendName;
+	FString ScenarioName;
+	Parameters.Split(TEXT(" "), &BackendName, &ScenarioName);
+	const FAssetCsvSyncTableBackend* Backend = nullptr;
+	for (const FAssetCsvSyncTableBackend& Candidate : AssetCsvSync_TableBackends)
+	{
+		if (BackendName == Candidate.Name)
+		{
+			Backend = &Candidate;
+		}
+	}
+	const FAssetCsvSyncPerfScenario* Scenario = AssetCsvSync_FindPerfScenario(ScenarioName);
+	if (!TestNotNull(TEXT("Backend"), Backend) || !TestNotNull(TEXT("Scenario"), Scenario))
+		return false;
+
+	const int32 NumAssets = FMath::Min(Scenario->NumAssets, AssetCsvSync_FunctionalRows);
+	FAssetCsvSyncPerfFixture Fixture;
+	if (!Fixture.Create(*this, *Scenario, NumAssets))
+		return false;
+
+	const FString ExpectedPath = Fixture.Directory / TEXT("Expected.csv");
+	const FString TablePath = Fixture.Directory / TEXT("Table") + Backend->Extension;
+	const FString CheckPath = Fixture.Directory / TEXT("Check.csv");
+	const TArray<FString> AllColumns;
+	if (!TestTrue(TEXT("Export CSV"), UAssetCsvSyncCSVHandler::ExportDataAssetsToCSVTable(Fixture.Assets, ExpectedPath, AllColumns))
+		|| !TestTrue(TEXT("Export table"), UAssetCsvSyncCSVHandler::ExportDataAssetsToCSVTable(Fixture.Assets, TablePath, AllColumns)))
+		return false;
+
+	Fixture.ResetToDefaults();
+	FAssetCsvSyncTableImportResult Result;
+	if (!TestTrue(TEXT("Import table"), UAssetCsvSyncCSVHandler::ImportCSVTableToDataAssets(TablePath, Scenario->GetClass(), Fixture.Folder, AllColumns, false, Result)))
+		return false;
+	TestEqual(TEXT("Imported rows"), Result.Rows, NumAssets);
+	TestEqual(TEXT("Changed assets"), Result.AssetsChanged, NumAssets);
+	TestEqual(TEXT("Created assets"), Result.AssetsCreated, 0);
+	TestEqual(TEXT("Failed rows"), Result.FailedRows, 0);
+
+	return TestTrue(TEXT("Round trip export"), UAssetCsvSyncCSVHandler::ExportDataAssetsToCSVTable(Fixture.Assets, CheckPath, AllColumns))
+		&& AssetCsvSync_TestSameFile(*this, ExpectedPath, CheckPath);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAssetCsvSyncUpsertTest, "AssetCsvSync.Table.Upsert", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+// Upserting into a table exported from some of the assets replaces the changed row in place, appends the missing
+// ones and keeps the schema sidecar valid for the import; upserting the same assets again leaves the file alone.
+bool FAssetCsvSyncUpsertTest::RunTest(const FString& Parameters)
+{
+	const FAssetCsvSyncPerfScenario& Scenario = AssetCsvSync_PerfScenarios[0];
+	const int32 NumExported = AssetCsvSync_FunctionalRows / 2;
+	FAssetCsvSyncPerfFixture Fixture;
+	if (!Fixture.Create(*this, Scenario, AssetCsvSync_FunctionalRows))
+		return false;
+
+	const FString TablePath = Fixture.Directory / TEXT("Table.csv");
+	const FString SidecarPath = TablePath + TEXT(".schema.json");
+	const FString CheckPath = Fixture.Directory / TEXT("Check.csv");
+	const TArray<FString> AllColumns;
+	const TArray<UDataAsset*> Exported(Fixture.Assets.GetData(), NumExported);
+	if (!TestTrue(TEXT("Export"), UAssetCsvSyncCSVHandler::ExportDataAssetsToCSVTable(Exported, TablePath, AllColumns)))
+		return false;
+	TestTrue(TEXT("Schema sidecar written"), IFileManager::Get().FileExists(*SidecarPath));
+
+	CastChecked<UAssetCsvSyncPerfWideAsset>(Fixture.Assets[0])->Level += 1;
+	FAssetCsvSyncUpsertResult Result;
+	if (!TestTrue(TEXT("Upsert"), UAssetCsvSyncCSVHandler::UpsertDataAssetsInCSVTable(Fixture.Assets, TablePath, AllColumns, Result)))
+		return false;
+	TestEqual(TEXT("Rows scanned"), Result.RowsScanned, NumExported);
+	TestEqual(TEXT("Rows replaced"), Result.RowsReplaced, 1);
+	TestEqual(TEXT("Rows unchanged"), Result.RowsUnchanged, NumExported - 1);
+	TestEqual(TEXT("Rows appended"), Result.RowsAppended, AssetCsvSync_FunctionalRows - NumExported);
+	TestTrue(TEXT("File written"), Result.bFileWritten);
+	TestTrue(TEXT("Schema sidecar kept"), IFileManager::Get().FileExists(*SidecarPath));
+
+	if (!TestTrue(TEXT("Full export"), UAssetCsvSyncCSVHandler::ExportDataAssetsToCSVTable(Fixture.Assets, CheckPath, AllColumns))
+		|| !AssetCsvSync_TestSameFile(*this, CheckPath, TablePath))
+		return false;
+
+	if (!TestTrue(TEXT("Second upsert"), UAssetCsvSyncCSVHandler::UpsertDataAssetsInCSVTable(Fixture.Assets, TablePath, AllColumns, Result)))
+		return false;
+	TestEqual(TEXT("Rows unchanged on the second upsert"), Result.RowsUnchanged, AssetCsvSync_FunctionalRows);
+	TestFalse(TEXT("File written on the second upsert"), Result.bFileWritten);
+
+	// The import checks the table against the merged sidecar before it touches an asset.
+	Fixture.ResetToDefaults();
+	FAssetCsvSyncTableImportResult ImportResult;
+	if (!TestTrue(TEXT("Import"), UAssetCsvSyncCSVHandler::ImportCSVTableToDataAssets(TablePath, Scenario.GetClass(), Fixture.Folder, AllColumns, false, ImportResult)))
+		return false;
+	TestEqual(TEXT("Changed assets"), ImportResult.AssetsChanged, AssetCsvSync_FunctionalRows);
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAssetCsvSyncShardTest, "AssetCsvSync.Table.Shards", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+// A bulk export split by row count writes one shard per MaxRowsPerShard rows, and importing the manifest brings
+// every row back.
+bool FAssetCsvSyncShardTest::RunTest(const FString& Parameters)
+{
+	const FAssetCsvSyncPerfScenario& Scenario = AssetCsvSync_PerfScenarios[0];
+	FAssetCsvSyncPerfFixture Fixture;
+	if (!Fixture.Create(*this, Scenario, AssetCsvSync_FunctionalRows))
+		return false;
+
+	const FString ShardDirectory = Fixture.Directory / TEXT("Shards");
+	const FString ManifestPath = ShardDirectory / TEXT("Table.json");
+	const FString ExpectedPath = Fixture.Directory / TEXT("Expected.csv");
+	const FString CheckPath = Fixture.Directory / TEXT("Check.csv");
+	const TArray<FString> AllColumns;
+
+	FAssetCsvSyncShardOptions Shards;
+	Shards.Mode = EAssetCsvSyncShardMode::RowCount;
+	Shards.MaxRowsPerShard = 5;
+	const int32 ExpectedShards = FMath::DivideAndRoundUp(AssetCsvSync_FunctionalRows, Shards.MaxRowsPerShard);
+	FAssetCsvSyncBulkExportResult ExportResult;
+	if (!TestTrue(TEXT("Sharded export"), UAssetCsvSyncCSVHandler::ExportAllDataAssetsOfClassToShards(Scenario.GetClass(), ManifestPath, AllColumns, false, Shards, ExportResult)))
+		return false;
+	TestEqual(TEXT("Exported assets"), ExportResult.AssetsExported, AssetCsvSync_FunctionalRows);
+	TestEqual(TEXT("Shards written"), ExportResult.ShardsWritten, ExpectedShards);
+
+	TArray<FString> ShardFiles;
+	IFileManager::Get().FindFiles(ShardFiles, *(ShardDirectory / TEXT("*.csv")), true, false);
+	TestEqual(TEXT("Shard files"), ShardFiles.Num(), ExpectedShards);
+
+	if (!TestTrue(TEXT("Export CSV"), UAssetCsvSyncCSVHandler::ExportDataAssetsToCSVTable(Fixture.Assets, ExpectedPath, AllColumns)))
+		return false;
+	Fixture.ResetToDefaults();
+	FAssetCsvSyncTableImportResult Result;
+	if (!TestTrue(TEXT("Import manifest"), UAssetCsvSyncCSVHandler::ImportCSVTableToDataAssets(ManifestPath, Scenario.GetClass(), Fixture.Folder, AllColumns, false, Result)))
+		return false;
+	TestEqual(TEXT("Imported rows"), Result.Rows, AssetCsvSync_FunctionalRows);
+	TestEqual(TEXT("Changed assets"), Result.AssetsChanged, AssetCsvSync_FunctionalRows);
+
+	return TestTrue(TEXT("Round trip export"), UAssetCsvSyncCSVHandler::ExportDataAssetsToCSVTable(Fixture.Assets, CheckPath, AllColumns))
+		&& AssetCsvSync_TestSameFile(*this, ExpectedPath, CheckPath);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAssetCsvSyncDirectorySyncTest, "AssetCsvSync.DirectorySync.RoundTrip", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+// Exports a content folder to one CSV per asset, imports those CSVs into a second folder as new assets, then runs the
+// import again: with the manifest from the first import every pair is unchanged.
+bool FAssetCsvSyncDirectorySyncTest::RunTest(const FString& Parameters)
+{
+	const FAssetCsvSyncPerfScenario& Scenario = AssetCsvSync_PerfScenarios[0];
+	FAssetCsvSyncPerfFixture Fixture;
+	if (!Fixture.Create(*this, Scenario, AssetCsvSync_FunctionalRows))
+		return false;
+
+	FAssetCsvSyncDirectorySyncOptions Options;
+	Options.CsvDirectory = Fixture.Directory / TEXT("Csv");
+	Options.ContentPath = Fixture.Folder / Scenario.Name;
+	Options.DataAssetClass = Scenario.GetClass();
+	Options.Direction = EAssetCsvSyncDirection::Export;
+	Options.ManifestPath = Fixture.Directory / TEXT("ExportManifest.json");
+	FAssetCsvSyncDirectorySyncResult Result;
+	if (!TestTrue(TEXT("Export sync"), FAssetCsvSyncDirectorySync::Run(Options, Result)))
+		return false;
+	TestEqual(TEXT("Exported pairs"), Result.Exported, AssetCsvSync_FunctionalRows);
+
+	const FString SyncedFolder = Fixture.Folder / TEXT("Synced");
+	Options.ContentPath = SyncedFolder;
+	Options.Direction = EAssetCsvSyncDirection::Import;
+	Options.ManifestPath = Fixture.Directory / TEXT("ImportManifest.json");
+	Result = FAssetCsvSyncDirectorySyncResult();
+	const bool bImported = FAssetCsvSyncDirectorySync::Run(Options, Result);
+
+	// The fixture only cleans up assets it knows about.
+	TArray<UDataAsset*> Synced;
+	for (const UDataAsset* Asset : TArray<UDataAsset*>(Fixture.Assets))
+	{
+		const FString SyncedPath = SyncedFolder / Asset->GetName() + TEXT(".") + Asset->GetName();
+		if (UDataAsset* SyncedAsset = FindObject<UDataAsset>(nullptr, *SyncedPath))
+		{
+			Synced.Add(SyncedAsset);
+			Fixture.Assets.Add(SyncedAsset);
+		}
+	}
+	if (!TestTrue(TEXT("Import sync"), bImported))
+		return false;
+	TestEqual(TEXT("Created assets"), Result.Created, AssetCsvSync_FunctionalRows);
+	TestEqual(TEXT("Saved packages"), Result.PackagesSaved, AssetCsvSync_FunctionalRows);
+	if (!TestEqual(TEXT("Synced assets found"), Synced.Num(), AssetCsvSync_FunctionalRows))
+		return false;
+
+	const FString CheckPath = Fixture.Directory / TEXT("Check.csv");
+	for (UDataAsset* SyncedAsset : Synced)
+	{
+		if (!TestTrue(TEXT("Export synced asset"), UAssetCsvSyncCSVHandler::ExportDataAssetToCSV(SyncedAsset, CheckPath))
+			|| !AssetCsvSync_TestSameFile(*this, Options.CsvDirectory / SyncedAsset->GetName() + TEXT(".csv"), CheckPath))
+			return false;
+	}
+
+	Result = FAssetCsvSyncDirectorySyncResult();
+	if (!TestTrue(TEXT("Incremental import sync"), FAssetCsvSyncDirectorySync::Run(Options, Result)))
+		return false;
+	TestEqual(TEXT("Unchanged pairs"), Result.Unchanged, AssetCsvSync_FunctionalRows);
+	TestEqual(TEXT("Imported pairs"), Result.Imported, 0);
+	TestEqual(TEXT("Saved packages"), Result.PackagesSaved, 0);
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAssetCsvSyncSourceStampTest, "AssetCsvSync.Table.SourceStampSkip", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+// A saved import stamps each asset with its row, so importing the same table again skips every asset without
+// loading or writing it. An unsaved edit makes that asset stale and it is imported again.
+bool FAssetCsvSyncSourceStampTest::RunTest(const FString& Parameters)
+{
+	const FAssetCsvSyncPerfScenario& Scenario = AssetCsvSync_PerfScenarios[0];
+	FAssetCsvSyncPerfFixture Fixture;
+	if (!Fixture.Create(*this, Scenario, AssetCsvSync_FunctionalRows))
+		return false;
+
+	const FString TablePath = Fixture.Directory / TEXT("Table.csv");
+	const TArray<FString> AllColumns;
+	if (!TestTrue(TEXT("Export"), UAssetCsvSyncCSVHandler::ExportDataAssetsToCSVTable(Fixture.Assets, TablePath, AllColumns)))
+		return false;
+
+	Fixture.ResetToDefaults();
+	FAssetCsvSyncTableImportResult Result;
+	if (!TestTrue(TEXT("First import"), UAssetCsvSyncCSVHandler::ImportCSVTableToDataAssets(TablePath, Scenario.GetClass(), Fixture.Folder, AllColumns, true, Result)))
+		return false;
+	TestEqual(TEXT("Changed assets"), Result.AssetsChanged, AssetCsvSync_FunctionalRows);
+	TestEqual(TEXT("Saved packages"), Result.PackagesSaved, AssetCsvSync_FunctionalRows);
+
+	if (!TestTrue(TEXT("Second import"), UAssetCsvSyncCSVHandler::ImportCSVTableToDataAssets(TablePath, Scenario.GetClass(), Fixture.Folder, AllColumns, true, Result)))
+		return false;
+	TestEqual(TEXT("Up-to-date assets"), Result.AssetsUpToDate, AssetCsvSync_FunctionalRows);
+	TestEqual(TEXT("Changed assets on the second import"), Result.AssetsChanged, 0);
+	TestEqual(TEXT("Saved packages on the second import"), Result.PackagesSaved, 0);
+
+	UAssetCsvSyncPerfWideAsset* Edited = CastChecked<UAssetCsvSyncPerfWideAsset>(Fixture.Assets[0]);
+	Edited->Level += 1;
+	Edited->MarkPackageDirty();
+	if (!TestTrue(TEXT("Import after an edit"), UAssetCsvSyncCSVHandler::ImportCSVTableToDataAssets(TablePath, Scenario.GetClass(), Fixture.Folder, AllColumns, false, Result)))
+		return false;
+	TestEqual(TEXT("Up-to-date assets after an edit"), Result.AssetsUpToDate, AssetCsvSync_FunctionalRows - 1);
+	TestEqual(TEXT("Changed assets after an edit"), Result.AssetsChanged, 1);
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAssetCsvSyncJobCancelTest, "AssetCsvSync.Jobs.Cancel", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+// A cancelled table import job finishes as Cancelled without applying a row, and the queue goes on to the next job.
+bool FAssetCsvSyncJobCancelTest::RunTest(const FString& Parameters)
+{
+	const FAssetCsvSyncPerfScenario& Scenario = AssetCsvSync_PerfScenarios[0];
+	FAssetCsvSyncPerfFixture Fixture;
+	if (!Fixture.Create(*this, Scenario, AssetCsvSync_FunctionalRows))
+		return false;
+
+	const FString TablePath = Fixture.Directory / TEXT("Table.csv");
+	const TArray<FString> AllColumns;
+	if (!TestTrue(TEXT("Export"), UAssetCsvSyncCSVHandler::ExportDataAssetsToCSVTable(Fixture.Assets, TablePath, AllColumns)))
+		return false;
+	Fixture.ResetToDefaults();
+
+	int32 CancelledCalls = 0;
+	EAssetCsvSyncJobResult CancelledResult = EAssetCsvSyncJobResult::Succeeded;
+	FAssetCsvSyncTableImportResult CancelledImport;
+	TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> Cancelled = UAssetCsvSyncCSVHandler::MakeTableImportJob(TablePath, Scenario.GetClass(), Fixture.Folder, AllColumns, false,
+		[&CancelledCalls, &CancelledResult, &CancelledImport](EAssetCsvSyncJobResult JobResult, const FAssetCsvSyncTableImportResult& ImportResult)
+		{
+			++CancelledCalls;
+			CancelledResult = JobResult;
+			CancelledImport = ImportResult;
+		});
+
+	int32 NextCalls = 0;
+	EAssetCsvSyncJobResult NextResult = EAssetCsvSyncJobResult::Failed;
+	FAssetCsvSyncTableImportResult NextImport;
+	TSharedRef<FAssetCsvSyncJob, ESPMode::ThreadSafe> Next = UAssetCsvSyncCSVHandler::MakeTableImportJob(TablePath, Scenario.GetClass(), Fixture.Folder, AllColumns, false,
+		[&NextCalls, &NextResult, &NextImport](EAssetCsvSyncJobResult JobResult, const FAssetCsvSyncTableImportResult& ImportResult)
+		{
+			++NextCalls;
+			NextResult = JobResult;
+			NextImport = ImportResult;
+		});
+
+	FAssetCsvSyncJobQueue& Queue = FAssetCsvSyncJobQueue::Get();
+	Queue.Enqueue(Cancelled);
+	Queue.Enqueue(Next);
+	Cancelled->Cancel();
+	Queue.Flush();
+
+	TestEqual(TEXT("Cancelled job callbacks"), CancelledCalls, 1);
+	TestTrue(TEXT("Cancelled job result"), CancelledResult == EAssetCsvSyncJobResult::Cancelled);
+	TestEqual(TEXT("Rows applied by the cancelled job"), CancelledImport.AssetsChanged, 0);
+	TestEqual(TEXT("Next job callbacks"), NextCalls, 1);
+	TestTrue(TEXT("Next job result"), NextResult == EAssetCsvSyncJobResult::Succeeded);
+	TestEqual(TEXT("Rows applied by the next job"), NextImport.AssetsChanged, AssetCsvSync_FunctionalRows);
+	TestEqual(TEXT("Queued jobs"), Queue.Num(), 0);
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS